@@ -0,0 +1,568 @@
+// bench.cpp
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+// decode throughput: how fast read() goes over a few synthetic corpora that each stick to one part of
+// the instruction set, and over the executable sections of real files. every corpus is swept linearly
+// (the same way the driver does it) `--warmup` times without looking at the clock, and then `--reps`
+// times with; the numbers are the median and the 99th percentile (nearest rank) of those sweeps.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+
+#include "zpr.h"
+#include "image.h"
+#include "x86/flow.h"
+
+struct Options
+{
+	int reps = 20;
+	int warmup = 3;
+	size_t size = 256 * 1024;       // of each synthetic corpus, in bytes
+
+	std::string json;               // "-" for stdout
+	std::string only;               // just the corpora with this in their name
+	std::vector<std::string> files;
+};
+
+struct Corpus
+{
+	std::string name;
+	std::string kind;               // "synthetic" or "text"
+	std::vector<instrad::x86::CodeRegion> regions;
+
+	std::vector<uint8_t> bytes;     // the synthetic ones own their bytes; the rest point into `image`
+	instrad::Image image;
+};
+
+struct Result
+{
+	size_t bytes = 0;
+	size_t instructions = 0;
+	size_t invalid = 0;
+
+	std::vector<double> ns;         // per sweep, sorted
+};
+
+// one way of encoding an instruction, which gets filled in with random operands. anything that comes out
+// not decoding (or decoding to a different length) is thrown away, so the forms can be a little loose.
+struct Form
+{
+	enum ModRM { None, Any, Reg, Mem };
+
+	std::vector<uint8_t> bytes;     // prefixes, escapes and the opcode
+	ModRM modrm = None;
+	int reg = -1;                   // modrm.reg, for the opcodes that it picks the instruction of
+	int imm = 0;                    // bytes of immediate
+	int suffix = -1;                // 3dnow puts the opcode after everything else
+};
+
+struct Random
+{
+	uint64_t state;
+
+	uint32_t next()
+	{
+		this->state ^= this->state << 13;
+		this->state ^= this->state >> 7;
+		this->state ^= this->state << 17;
+		return (uint32_t) (this->state >> 16);
+	}
+};
+
+static std::vector<Form> legacyForms()
+{
+	using F = Form;
+	return {
+		{ { 0x89 }, F::Any }, { { 0x8B }, F::Any }, { { 0x48, 0x89 }, F::Any }, { { 0x48, 0x8B }, F::Any },
+		{ { 0x4C, 0x8B }, F::Any }, { { 0x01 }, F::Any }, { { 0x48, 0x03 }, F::Any }, { { 0x29 }, F::Any },
+		{ { 0x48, 0x2B }, F::Any }, { { 0x31 }, F::Any }, { { 0x33 }, F::Reg }, { { 0x39 }, F::Any },
+		{ { 0x48, 0x3B }, F::Any }, { { 0x85 }, F::Reg }, { { 0x48, 0x85 }, F::Reg }, { { 0x21 }, F::Any },
+		{ { 0x8D }, F::Mem }, { { 0x48, 0x8D }, F::Mem }, { { 0x83 }, F::Any, -1, 1 }, { { 0x48, 0x83 }, F::Any, -1, 1 },
+		{ { 0x81 }, F::Any, -1, 4 }, { { 0xC7 }, F::Any, 0, 4 }, { { 0x48, 0xC7 }, F::Mem, 0, 4 },
+		{ { 0xC6 }, F::Mem, 0, 1 }, { { 0x0F, 0xB6 }, F::Any }, { { 0x0F, 0xB7 }, F::Any },
+		{ { 0x48, 0x0F, 0xBE }, F::Any }, { { 0x48, 0x63 }, F::Any }, { { 0x0F, 0xAF }, F::Any },
+		{ { 0x48, 0x0F, 0x44 }, F::Reg }, { { 0x0F, 0x4F }, F::Any }, { { 0x0F, 0x94 }, F::Reg, 0 },
+		{ { 0xC1 }, F::Reg, 4, 1 }, { { 0x48, 0xC1 }, F::Reg, 5, 1 }, { { 0xD1 }, F::Reg, 7 },
+		{ { 0xF7 }, F::Reg, 3 }, { { 0x48, 0xF7 }, F::Reg, 6 }, { { 0x48, 0xFF }, F::Any, 0 },
+		{ { 0xFF }, F::Any, 2 }, { { 0xFF }, F::Mem, 4 }, { { 0x0F, 0x1F }, F::Mem, 0 },
+		{ { 0x50 } }, { { 0x53 } }, { { 0x41, 0x54 } }, { { 0x5D } }, { { 0x41, 0x5F } }, { { 0xC3 } }, { { 0x90 } },
+		{ { 0xE8 }, F::None, -1, 4 }, { { 0xE9 }, F::None, -1, 4 }, { { 0xEB }, F::None, -1, 1 },
+		{ { 0x74 }, F::None, -1, 1 }, { { 0x75 }, F::None, -1, 1 }, { { 0x0F, 0x84 }, F::None, -1, 4 },
+		{ { 0x0F, 0x8E }, F::None, -1, 4 }, { { 0xB8 }, F::None, -1, 4 }, { { 0x48, 0xB8 }, F::None, -1, 8 },
+	};
+}
+
+static std::vector<Form> sseForms()
+{
+	using F = Form;
+	return {
+		{ { 0x0F, 0x10 }, F::Any }, { { 0x0F, 0x11 }, F::Any }, { { 0x0F, 0x28 }, F::Any }, { { 0x0F, 0x29 }, F::Mem },
+		{ { 0x0F, 0x58 }, F::Any }, { { 0x0F, 0x59 }, F::Any }, { { 0x0F, 0x5C }, F::Any }, { { 0x0F, 0x5E }, F::Any },
+		{ { 0x66, 0x0F, 0x58 }, F::Any }, { { 0x66, 0x0F, 0x59 }, F::Any }, { { 0xF3, 0x0F, 0x10 }, F::Any },
+		{ { 0xF3, 0x0F, 0x59 }, F::Any }, { { 0xF2, 0x0F, 0x10 }, F::Any }, { { 0xF2, 0x0F, 0x11 }, F::Any },
+		{ { 0xF2, 0x0F, 0x58 }, F::Any }, { { 0xF2, 0x0F, 0x5E }, F::Any }, { { 0x66, 0x0F, 0x6F }, F::Any },
+		{ { 0x66, 0x0F, 0x7F }, F::Any }, { { 0xF3, 0x0F, 0x6F }, F::Any }, { { 0x66, 0x0F, 0xEF }, F::Any },
+		{ { 0x66, 0x0F, 0xFE }, F::Any }, { { 0x66, 0x0F, 0xD4 }, F::Any }, { { 0x66, 0x0F, 0xFA }, F::Any },
+		{ { 0x66, 0x0F, 0xEB }, F::Any }, { { 0x66, 0x0F, 0xDB }, F::Any }, { { 0x66, 0x0F, 0x74 }, F::Any },
+		{ { 0x66, 0x0F, 0xD7 }, F::Reg }, { { 0x66, 0x0F, 0x70 }, F::Any, -1, 1 }, { { 0x0F, 0xC6 }, F::Any, -1, 1 },
+		{ { 0x66, 0x0F, 0x38, 0x00 }, F::Any }, { { 0x66, 0x0F, 0x38, 0x40 }, F::Any },
+		{ { 0x66, 0x0F, 0x3A, 0x0F }, F::Any, -1, 1 }, { { 0x66, 0x0F, 0x3A, 0x16 }, F::Any, -1, 1 },
+		{ { 0x66, 0x0F, 0x2E }, F::Any }, { { 0x0F, 0x2F }, F::Any }, { { 0xF2, 0x0F, 0x2A }, F::Any },
+		{ { 0xF2, 0x48, 0x0F, 0x2C }, F::Any }, { { 0x66, 0x0F, 0x73 }, F::Reg, 2, 1 },
+		{ { 0x66, 0x0F, 0x14 }, F::Any }, { { 0x66, 0x44, 0x0F, 0x6F }, F::Any }, { { 0x66, 0x0F, 0x6E }, F::Any },
+		{ { 0x66, 0x48, 0x0F, 0x7E }, F::Any },
+	};
+}
+
+// the VEX prefixes are all spelled out: C5 is [~R ~vvvv L pp], and C4 is [~R ~X ~B mmmmm] [W ~vvvv L pp].
+static std::vector<Form> avxForms()
+{
+	using F = Form;
+	return {
+		{ { 0xC5, 0xF8, 0x28 }, F::Any }, { { 0xC5, 0xFC, 0x28 }, F::Any }, { { 0xC5, 0xFC, 0x11 }, F::Any },
+		{ { 0xC5, 0xF4, 0x58 }, F::Any }, { { 0xC5, 0xF4, 0x59 }, F::Any }, { { 0xC5, 0xF5, 0xFE }, F::Any },
+		{ { 0xC5, 0xFD, 0x6F }, F::Any }, { { 0xC5, 0xFE, 0x6F }, F::Any }, { { 0xC5, 0xFE, 0x7F }, F::Any },
+		{ { 0xC5, 0xF5, 0xEF }, F::Any }, { { 0xC5, 0xF5, 0xDB }, F::Any }, { { 0xC5, 0xF5, 0x74 }, F::Any },
+		{ { 0xC5, 0xFB, 0x10 }, F::Mem }, { { 0xC5, 0xF3, 0x58 }, F::Any }, { { 0xC5, 0xFD, 0xD7 }, F::Reg },
+		{ { 0xC5, 0xF8, 0x77 } }, { { 0xC5, 0xF5, 0x70 }, F::Any, -1, 1 }, { { 0xC5, 0xF4, 0xC6 }, F::Any, -1, 1 },
+		{ { 0xC4, 0xE2, 0x7D, 0x58 }, F::Any }, { { 0xC4, 0xE2, 0x7D, 0x18 }, F::Any },
+		{ { 0xC4, 0xE2, 0x75, 0xB8 }, F::Any }, { { 0xC4, 0xE2, 0xF5, 0xB8 }, F::Any },
+		{ { 0xC4, 0xE2, 0x75, 0xA8 }, F::Any }, { { 0xC4, 0xE2, 0x75, 0x36 }, F::Any },
+		{ { 0xC4, 0xE2, 0x75, 0x00 }, F::Any }, { { 0xC4, 0xE2, 0x75, 0x40 }, F::Any },
+		{ { 0xC4, 0xE3, 0xFD, 0x00 }, F::Any, -1, 1 }, { { 0xC4, 0xE3, 0x75, 0x46 }, F::Any, -1, 1 },
+		{ { 0xC4, 0xE3, 0x7D, 0x19 }, F::Any, -1, 1 }, { { 0xC4, 0xE3, 0x75, 0x18 }, F::Any, -1, 1 },
+		{ { 0xC4, 0x41, 0x7C, 0x28 }, F::Any }, { { 0xC4, 0xC1, 0x75, 0xFE }, F::Any },
+		{ { 0xC4, 0xE2, 0x78, 0xF2 }, F::Any }, { { 0xC4, 0xE2, 0xFB, 0xF6 }, F::Any },
+	};
+}
+
+static std::vector<Form> x87Forms()
+{
+	using F = Form;
+	return {
+		{ { 0xD8 }, F::Any }, { { 0xD9 }, F::Mem, 0 }, { { 0xD9 }, F::Mem, 2 }, { { 0xD9 }, F::Mem, 3 },
+		{ { 0xD9 }, F::Reg, 0 }, { { 0xD9 }, F::Reg, 1 }, { { 0xD9, 0xE8 } }, { { 0xD9, 0xEE } },
+		{ { 0xD9, 0xE0 } }, { { 0xD9, 0xE1 } }, { { 0xD9, 0xFA } }, { { 0xDA }, F::Mem }, { { 0xDB }, F::Mem, 0 },
+		{ { 0xDB }, F::Mem, 5 }, { { 0xDB }, F::Mem, 7 }, { { 0xDC }, F::Any }, { { 0xDD }, F::Mem, 0 },
+		{ { 0xDD }, F::Mem, 3 }, { { 0xDD }, F::Reg, 3 }, { { 0xDE }, F::Any, 0 }, { { 0xDE }, F::Any, 1 },
+		{ { 0xDE }, F::Any, 4 }, { { 0xDE }, F::Any, 6 }, { { 0xDF }, F::Mem, 5 }, { { 0xDF }, F::Mem, 7 },
+		{ { 0xDF, 0xE0 } }, { { 0xDB, 0xE2 } },
+	};
+}
+
+static std::vector<Form> amd3dnowForms()
+{
+	using F = Form;
+
+	auto ret = std::vector<Form>();
+	for(int op : { 0x0C, 0x0D, 0x1C, 0x1D, 0x8A, 0x8E, 0x90, 0x94, 0x96, 0x97, 0x9A, 0x9E, 0xA0, 0xA4,
+		0xA6, 0xA7, 0xAA, 0xAE, 0xB0, 0xB4, 0xB6, 0xB7, 0xBB, 0xBF })
+	{
+		ret.push_back({ { 0x0F, 0x0F }, F::Any, -1, 0, op });
+	}
+
+	// the mmx that 3dnow code is mixed in with.
+	ret.push_back({ { 0x0F, 0x6F }, F::Any });
+	ret.push_back({ { 0x0F, 0x7F }, F::Mem });
+	ret.push_back({ { 0x0F, 0xFE }, F::Any });
+	ret.push_back({ { 0x0F, 0x0D }, F::Mem, 1 });
+	ret.push_back({ { 0x0F, 0x0E } });
+	return ret;
+}
+
+static std::vector<Form> prefixedForms()
+{
+	using F = Form;
+	return {
+		{ { 0x66, 0x2E, 0x0F, 0x1F }, F::Mem, 0 }, { { 0x66, 0x66, 0x2E, 0x0F, 0x1F }, F::Mem, 0 },
+		{ { 0xF0, 0x48, 0x0F, 0xB1 }, F::Mem }, { { 0xF0, 0x0F, 0xC1 }, F::Mem }, { { 0xF0, 0x48, 0xFF }, F::Mem, 0 },
+		{ { 0xF0, 0x83 }, F::Mem, 0, 1 }, { { 0x64, 0x48, 0x8B }, F::Mem }, { { 0x65, 0x48, 0x8B }, F::Mem },
+		{ { 0x64, 0x67, 0x48, 0x89 }, F::Mem }, { { 0xF3, 0x48, 0xAB } }, { { 0xF3, 0xA4 } }, { { 0xF3, 0x48, 0xA5 } },
+		{ { 0x66, 0xF3, 0xAB } }, { { 0xF2, 0xAE } }, { { 0x67, 0x48, 0x8B }, F::Mem }, { { 0x67, 0x66, 0x89 }, F::Mem },
+		{ { 0x66, 0x41, 0x89 }, F::Mem }, { { 0x66, 0x41, 0xC7 }, F::Mem, 0, 2 }, { { 0xF3, 0x0F, 0xB8 }, F::Any },
+		{ { 0xF3, 0x48, 0x0F, 0xBC }, F::Any }, { { 0xF3, 0x48, 0x0F, 0xBD }, F::Any },
+		{ { 0x2E, 0xF2, 0x48, 0x0F, 0x2A }, F::Any }, { { 0x3E, 0x74 }, F::None, -1, 1 }, { { 0x2E, 0x75 }, F::None, -1, 1 },
+		{ { 0xF2, 0xE9 }, F::None, -1, 4 }, { { 0xF2, 0xC3 } }, { { 0xF3, 0x0F, 0x1E, 0xFA } },
+		{ { 0x26, 0x36, 0x3E, 0x8B }, F::Mem }, { { 0x66, 0x66, 0x66, 0x66, 0x90 } },
+		{ { 0xF0, 0x66, 0x0F, 0xB1 }, F::Mem }, { { 0x2E, 0x66, 0x67, 0x0F, 0xB7 }, F::Mem },
+	};
+}
+
+// appends the modrm byte, and the sib and displacement that it asks for.
+static void appendModRM(Random& rng, const Form& form, std::vector<uint8_t>& out)
+{
+	auto r = rng.next();
+
+	int mod = 0;
+	if(form.modrm == Form::Reg)         mod = 3;
+	else if(form.modrm == Form::Mem)    mod = r % 3;
+	else                                mod = r % 4;
+
+	int reg = (form.reg >= 0) ? form.reg : (int) ((r >> 4) & 7);
+	int rm = (int) ((r >> 8) & 7);
+
+	out.push_back((uint8_t) ((mod << 6) | (reg << 3) | rm));
+	if(mod == 3)
+		return;
+
+	int disp = (mod == 1) ? 1 : (mod == 2) ? 4 : 0;
+	if(rm == 4)
+	{
+		auto sib = (uint8_t) (r >> 16);
+		out.push_back(sib);
+
+		if(mod == 0 && (sib & 7) == 5)
+			disp = 4;
+	}
+	else if(mod == 0 && rm == 5)
+	{
+		disp = 4;
+	}
+
+	for(int i = 0; i < disp; i++)
+		out.push_back((uint8_t) rng.next());
+}
+
+// random instructions of the given forms, until there are `size` bytes of them.
+static std::vector<uint8_t> generate(const std::vector<Form>& forms, size_t size, uint64_t seed)
+{
+	using namespace instrad::x86;
+
+	auto rng = Random { seed };
+	auto ret = std::vector<uint8_t>();
+	ret.reserve(size + 16);
+
+	auto instr = std::vector<uint8_t>();
+	size_t kept = 0;
+	size_t thrown = 0;
+
+	while(ret.size() < size)
+	{
+		auto& form = forms[rng.next() % forms.size()];
+
+		instr = form.bytes;
+		if(form.modrm != Form::None)
+			appendModRM(rng, form, instr);
+
+		for(int i = 0; i < form.imm; i++)
+			instr.push_back((uint8_t) rng.next());
+
+		if(form.suffix >= 0)
+			instr.push_back((uint8_t) form.suffix);
+
+		auto buf = instrad::Buffer(instr.data(), instr.size());
+		auto decoded = read(buf, ExecMode::Long);
+		if(decoded.op() == ops::INVALID || buf.overrun() || decoded.length() != instr.size())
+		{
+			// a form that never decodes is a mistake in the list, but it shouldn't hang.
+			if(++thrown > 1000 && thrown > 4 * kept)
+				break;
+
+			continue;
+		}
+
+		ret.insert(ret.end(), instr.begin(), instr.end());
+		kept++;
+	}
+
+	return ret;
+}
+
+static Result measure(const Options& opts, const Corpus& corpus)
+{
+	using namespace instrad::x86;
+
+	auto res = Result();
+	for(auto& region : corpus.regions)
+		res.bytes += region.size();
+
+	size_t check = 0;
+
+	auto sweep = [&]() -> size_t {
+		size_t sum = 0;
+		size_t count = 0;
+		size_t invalid = 0;
+
+		for(auto& region : corpus.regions)
+		{
+			for(auto ip = region.base(); ip < region.end(); )
+			{
+				auto instr = region.decode(ip);
+				sum += instr.op().id() + instr.length();
+				invalid += (instr.op() == ops::INVALID);
+				count++;
+
+				ip = region.nextBoundary(ip, instr);
+			}
+		}
+
+		res.instructions = count;
+		res.invalid = invalid;
+		return sum;
+	};
+
+	for(int i = 0; i < opts.warmup; i++)
+		check = sweep();
+
+	for(int i = 0; i < opts.reps; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		auto sum = sweep();
+		auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		// also keeps the compiler from throwing the decoding away.
+		if(i == 0 && opts.warmup == 0)
+			check = sum;
+
+		if(sum != check)
+			zpr::println("warning: %s decoded differently on sweep %d", corpus.name, i);
+
+		res.ns.push_back(ns);
+	}
+
+	std::sort(res.ns.begin(), res.ns.end());
+	return res;
+}
+
+// nearest rank.
+static double percentile(const std::vector<double>& sorted, double p)
+{
+	if(sorted.empty())
+		return 0;
+
+	auto rank = (size_t) ((p / 100.0) * (double) sorted.size() + 0.999999);
+	return sorted[std::min(std::max(rank, (size_t) 1), sorted.size()) - 1];
+}
+
+static std::string escape(const std::string& s)
+{
+	auto ret = std::string();
+	for(char c : s)
+	{
+		if(c == '"' || c == '\\')
+			ret += '\\';
+
+		ret += c;
+	}
+	return ret;
+}
+
+static std::string toJson(const Options& opts, const std::vector<Corpus>& corpora, const std::vector<Result>& results)
+{
+	auto ret = zpr::sprint("{\n  \"reps\": %d,\n  \"warmup\": %d,\n  \"corpora\": [", opts.reps, opts.warmup);
+
+	for(size_t i = 0; i < corpora.size(); i++)
+	{
+		auto& r = results[i];
+		auto med = percentile(r.ns, 50);
+		auto p99 = percentile(r.ns, 99);
+		auto n = (double) std::max(r.instructions, (size_t) 1);
+
+		// the p99 of a rate is the rate of the p99 sweep, ie. the slow end.
+		ret += zpr::sprint("%s\n    {\n      \"name\": \"%s\",\n      \"kind\": \"%s\",\n", i == 0 ? "" : ",",
+			escape(corpora[i].name), corpora[i].kind);
+		ret += zpr::sprint("      \"bytes\": %d,\n      \"instructions\": %d,\n      \"invalid\": %d,\n",
+			r.bytes, r.instructions, r.invalid);
+		ret += zpr::sprint("      \"ns_per_sweep\": { \"min\": %.0f, \"median\": %.0f, \"p99\": %.0f },\n",
+			r.ns.empty() ? 0 : r.ns.front(), med, p99);
+		ret += zpr::sprint("      \"ns_per_instruction\": { \"median\": %.3f, \"p99\": %.3f },\n", med / n, p99 / n);
+		ret += zpr::sprint("      \"instructions_per_sec\": { \"median\": %.0f, \"p99\": %.0f },\n",
+			n * 1e9 / med, n * 1e9 / p99);
+		ret += zpr::sprint("      \"bytes_per_sec\": { \"median\": %.0f, \"p99\": %.0f }\n    }",
+			(double) r.bytes * 1e9 / med, (double) r.bytes * 1e9 / p99);
+	}
+
+	ret += "\n  ]\n}\n";
+	return ret;
+}
+
+static bool readFile(const std::string& name, std::vector<uint8_t>& out)
+{
+	auto file = std::ifstream(name, std::ios::binary);
+	if(!file)
+	{
+		perror("failed to open file");
+		return false;
+	}
+
+	file.seekg(0, std::ios::end);
+	size_t length = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	out.resize(length);
+	file.read((char*) out.data(), length);
+	return true;
+}
+
+static instrad::x86::ExecMode modeForBits(int bits)
+{
+	if(bits == 16)      return instrad::x86::ExecMode::Legacy;
+	else if(bits == 32) return instrad::x86::ExecMode::Compat;
+	else                return instrad::x86::ExecMode::Long;
+}
+
+static void usage()
+{
+	zpr::println("usage: instrad_bench [options] [file...]");
+	zpr::println("  --reps <n>          timed sweeps of each corpus (default 20)");
+	zpr::println("  --warmup <n>        untimed sweeps before those (default 3)");
+	zpr::println("  --size <kb>         size of each synthetic corpus (default 256)");
+	zpr::println("  --only <name>       only the corpora with <name> in their name");
+	zpr::println("  --json <path>       also write the results as json ('-' for stdout)");
+	zpr::println("the executable sections of every file are a corpus of their own.");
+}
+
+static bool parseOptions(Options& opts, int argc, char** argv)
+{
+	for(int i = 1; i < argc; i++)
+	{
+		auto arg = std::string(argv[i]);
+		auto next = [&]() -> const char* {
+			if(i + 1 >= argc)
+			{
+				zpr::println("expected a value after '%s'", arg);
+				return nullptr;
+			}
+			return argv[++i];
+		};
+
+		if(arg == "--reps" || arg == "--warmup" || arg == "--size")
+		{
+			auto val = next();
+			if(val == nullptr)
+				return false;
+
+			auto n = atoi(val);
+			if(n < 0 || (n == 0 && arg != "--warmup"))
+			{
+				zpr::println("invalid value '%s' for '%s'", val, arg);
+				return false;
+			}
+
+			if(arg == "--reps")         opts.reps = n;
+			else if(arg == "--warmup")  opts.warmup = n;
+			else                        opts.size = (size_t) n * 1024;
+		}
+		else if(arg == "--json" || arg == "--only")
+		{
+			auto val = next();
+			if(val == nullptr)
+				return false;
+
+			(arg == "--json" ? opts.json : opts.only) = val;
+		}
+		else if(arg == "--help" || arg == "-h")
+		{
+			usage();
+			return false;
+		}
+		else if(arg.size() > 1 && arg[0] == '-')
+		{
+			zpr::println("unknown option '%s'", arg);
+			return false;
+		}
+		else
+		{
+			opts.files.push_back(arg);
+		}
+	}
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	auto opts = Options();
+	if(!parseOptions(opts, argc, argv))
+		return 1;
+
+	// the regions point into the corpus' own buffers, which stay put when the corpus moves.
+	auto corpora = std::vector<Corpus>();
+
+	auto synthetic = [&](const char* name, const std::vector<Form>& forms, uint64_t seed) {
+		auto& c = corpora.emplace_back();
+		c.name = name;
+		c.kind = "synthetic";
+		c.bytes = generate(forms, opts.size, seed);
+		c.regions.emplace_back(c.bytes.data(), c.bytes.size(), 0, instrad::x86::ExecMode::Long);
+	};
+
+	synthetic("legacy", legacyForms(), 0x1E6AC1);
+	synthetic("sse", sseForms(), 0x55E);
+	synthetic("avx", avxForms(), 0xA7C2);
+	synthetic("x87", x87Forms(), 0x87);
+	synthetic("3dnow", amd3dnowForms(), 0x3D);
+	synthetic("prefixed", prefixedForms(), 0x6667F3);
+
+	for(auto& file : opts.files)
+	{
+		auto bytes = std::vector<uint8_t>();
+		if(!readFile(file, bytes))
+			return 1;
+
+		auto& c = corpora.emplace_back();
+		c.name = zpr::sprint("text:%s", file.substr(file.find_last_of('/') + 1));
+		c.kind = "text";
+		c.image = instrad::loadImage(std::move(bytes), false, 0, 64);
+
+		for(auto& sec : c.image.sections)
+		{
+			if(sec.executable && sec.size > 0)
+				c.regions.emplace_back(c.image.data(sec), sec.size, sec.address, modeForBits(c.image.bits));
+		}
+	}
+
+	if(!opts.only.empty())
+	{
+		corpora.erase(std::remove_if(corpora.begin(), corpora.end(), [&opts](const Corpus& c) {
+			return c.name.find(opts.only) == std::string::npos;
+		}), corpora.end());
+	}
+
+	zpr::println("%-20s %10s %9s %8s %21s %9s %9s", "corpus", "bytes", "instrs", "invalid", "ns/instr (med / p99)",
+		"Minstr/s", "MB/s");
+
+	auto results = std::vector<Result>();
+	for(auto& c : corpora)
+	{
+		auto r = measure(opts, c);
+
+		auto med = percentile(r.ns, 50);
+		auto p99 = percentile(r.ns, 99);
+		auto n = (double) std::max(r.instructions, (size_t) 1);
+
+		zpr::println("%-20s %10d %9d %8d %10.2f / %8.2f %9.2f %9.2f", c.name, r.bytes, r.instructions, r.invalid,
+			med / n, p99 / n, n * 1e3 / med, (double) r.bytes * 1e3 / med);
+
+		results.push_back(std::move(r));
+	}
+
+	if(!opts.json.empty())
+	{
+		auto json = toJson(opts, corpora, results);
+		if(opts.json == "-")
+		{
+			zpr::print("%s", json);
+		}
+		else
+		{
+			auto out = std::ofstream(opts.json, std::ios::binary);
+			if(!out)
+			{
+				perror("failed to open json file");
+				return 1;
+			}
+
+			out.write(json.data(), json.size());
+		}
+	}
+
+	return 0;
+}
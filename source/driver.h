@@ -0,0 +1,64 @@
+// driver.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "zpr.h"
+#include "image.h"
+#include "buffer.h"
+#include "x86/flow.h"
+
+// stuff shared between the various bits of the example driver. none of this is part of the library.
+struct Options
+{
+	std::string filename;
+	std::vector<std::string> files;     // all of them, including the first
+
+	bool raw = false;
+	bool att = false;
+	bool descent = false;
+	bool cfg = false;
+	bool functions = false;
+	bool xrefs = false;
+	bool gadgets = false;
+	bool features = false;
+	bool filler = false;
+	bool stack = false;
+	bool decodeCache = false;
+	bool stats = false;
+	bool dupes = false;
+	bool diff = false;
+
+	int bits = 0;
+	uint64_t base = 0;
+	size_t threads = 0;
+	double similarity = 0.8;
+
+	std::vector<uint64_t> entries;
+	std::vector<uint64_t> xrefTargets;
+	std::vector<uint64_t> functionAddrs;
+	std::vector<uint64_t> seeks;
+
+	struct Patch
+	{
+		uint64_t address = 0;
+		std::vector<uint8_t> bytes;
+	};
+
+	std::vector<Patch> patches;
+
+	std::string search;
+	std::string uarch;
+	std::string allow;
+	std::string index;
+};
+
+std::string print_intel(const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes, size_t len);
+std::string print_att(const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes, size_t len);
@@ -16,15 +16,25 @@ namespace instrad
 		constexpr size_t position() const { return this->idx; }
 		constexpr size_t remaining() const { return this->len - this->idx; }
 
+		// true if the decoder tried to read past the end of the buffer, ie. the
+		// last instruction was truncated.
+		constexpr bool overrun() const { return this->didOverrun; }
+
 		constexpr uint8_t peek(size_t n = 0) const
 		{
+			if(this->idx + n >= this->len)
+				return 0;
+
 			return this->bytes[this->idx + n];
 		}
 
 		constexpr uint8_t pop()
 		{
 			if(this->remaining() == 0)
+			{
+				this->didOverrun = true;
 				return 0;
+			}
 
 			return this->bytes[this->idx++];
 		}
@@ -47,5 +57,6 @@ namespace instrad
 		const uint8_t* bytes;
 		size_t idx;
 		size_t len;
+		bool didOverrun = false;
 	};
 }
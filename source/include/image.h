@@ -0,0 +1,256 @@
+// image.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+namespace instrad
+{
+	// a (very) minimal view of an executable file: just enough to find the code in it.
+	// we don't use the system <elf.h>, because it doesn't exist on every platform.
+	struct Section
+	{
+		std::string name;
+		uint64_t address = 0;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+		bool executable = false;
+		bool loaded = false;        // actually mapped into memory at `address`
+	};
+
+	struct Symbol
+	{
+		std::string name;
+		uint64_t address = 0;
+		uint64_t size = 0;
+		bool function = false;
+	};
+
+	struct Image
+	{
+		std::vector<uint8_t> bytes;
+		std::vector<Section> sections;
+		std::vector<Symbol> symbols;
+
+		uint64_t entry = 0;
+		bool hasEntry = false;
+
+		// 16, 32 or 64.
+		int bits = 64;
+
+		const uint8_t* data(const Section& sec) const { return this->bytes.data() + sec.offset; }
+
+		// reads memory at a virtual address, as it would be when the image is loaded.
+		bool read(uint64_t addr, void* out, size_t n) const
+		{
+			for(auto& sec : this->sections)
+			{
+				if(sec.loaded && addr >= sec.address && addr + n <= sec.address + sec.size)
+				{
+					memcpy(out, this->data(sec) + (addr - sec.address), n);
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+
+	namespace elf
+	{
+		constexpr uint32_t SHT_SYMTAB       = 2;
+		constexpr uint32_t SHT_NOBITS       = 8;
+		constexpr uint32_t SHT_DYNSYM       = 11;
+		constexpr uint64_t SHF_ALLOC        = 0x2;
+		constexpr uint64_t SHF_EXECINSTR    = 0x4;
+		constexpr uint32_t PT_LOAD          = 1;
+		constexpr uint32_t PF_X             = 0x1;
+		constexpr uint8_t STT_FUNC          = 2;
+
+		struct Reader
+		{
+			const std::vector<uint8_t>& bytes;
+			bool is64;
+			bool ok = true;
+
+			uint64_t get(uint64_t ofs, size_t n)
+			{
+				if(ofs + n > this->bytes.size() || ofs + n < ofs)
+				{
+					this->ok = false;
+					return 0;
+				}
+
+				// elf files we care about are little-endian, and so are we.
+				uint64_t ret = 0;
+				memcpy(&ret, &this->bytes[ofs], n);
+				return ret;
+			}
+
+			// reads a field whose width depends on the elf class.
+			uint64_t word(uint64_t ofs) { return this->get(ofs, this->is64 ? 8 : 4); }
+
+			std::string string(uint64_t ofs)
+			{
+				std::string ret;
+				while(ofs < this->bytes.size() && this->bytes[ofs] != 0)
+					ret += (char) this->bytes[ofs++];
+
+				return ret;
+			}
+		};
+
+		inline bool isELF(const std::vector<uint8_t>& bytes)
+		{
+			return bytes.size() >= 0x34 && bytes[0] == 0x7F && bytes[1] == 'E' && bytes[2] == 'L' && bytes[3] == 'F';
+		}
+
+		inline bool load(Image& img)
+		{
+			auto& bytes = img.bytes;
+			if(!isELF(bytes))
+				return false;
+
+			// EI_CLASS: 1 = 32-bit, 2 = 64-bit. EI_DATA: 1 = little endian.
+			if(bytes[5] != 1 || (bytes[4] != 1 && bytes[4] != 2))
+				return false;
+
+			auto rd = Reader { bytes, bytes[4] == 2 };
+			img.bits = rd.is64 ? 64 : 32;
+
+			img.entry = rd.word(0x18);
+			img.hasEntry = (img.entry != 0);
+
+			uint64_t phoff = rd.word(rd.is64 ? 0x20 : 0x1C);
+			uint64_t shoff = rd.word(rd.is64 ? 0x28 : 0x20);
+			uint64_t phentsize = rd.get(rd.is64 ? 0x36 : 0x2A, 2);
+			uint64_t phnum = rd.get(rd.is64 ? 0x38 : 0x2C, 2);
+			uint64_t shentsize = rd.get(rd.is64 ? 0x3A : 0x2E, 2);
+			uint64_t shnum = rd.get(rd.is64 ? 0x3C : 0x30, 2);
+			uint64_t shstrndx = rd.get(rd.is64 ? 0x3E : 0x32, 2);
+
+			struct Raw { uint32_t name; uint32_t type; uint64_t flags; uint64_t addr; uint64_t offset; uint64_t size; uint32_t link; uint64_t entsize; };
+			auto section = [&](uint64_t i) -> Raw {
+				auto base = shoff + i * shentsize;
+				if(rd.is64)
+				{
+					return Raw { (uint32_t) rd.get(base + 0x00, 4), (uint32_t) rd.get(base + 0x04, 4), rd.get(base + 0x08, 8),
+						rd.get(base + 0x10, 8), rd.get(base + 0x18, 8), rd.get(base + 0x20, 8), (uint32_t) rd.get(base + 0x28, 4),
+						rd.get(base + 0x38, 8) };
+				}
+				else
+				{
+					return Raw { (uint32_t) rd.get(base + 0x00, 4), (uint32_t) rd.get(base + 0x04, 4), rd.get(base + 0x08, 4),
+						rd.get(base + 0x0C, 4), rd.get(base + 0x10, 4), rd.get(base + 0x14, 4), (uint32_t) rd.get(base + 0x18, 4),
+						rd.get(base + 0x24, 4) };
+				}
+			};
+
+			if(shoff != 0 && shnum > 0 && shstrndx < shnum)
+			{
+				auto strtab = section(shstrndx);
+				for(uint64_t i = 0; i < shnum && rd.ok; i++)
+				{
+					auto sh = section(i);
+					if(sh.type == SHT_NOBITS || sh.offset + sh.size > bytes.size())
+						continue;
+
+					auto sec = Section();
+					sec.name = rd.string(strtab.offset + sh.name);
+					sec.address = sh.addr;
+					sec.offset = sh.offset;
+					sec.size = sh.size;
+					sec.executable = (sh.flags & SHF_EXECINSTR);
+					sec.loaded = (sh.flags & SHF_ALLOC);
+					img.sections.push_back(sec);
+
+					if((sh.type == SHT_SYMTAB || sh.type == SHT_DYNSYM) && sh.entsize > 0 && sh.link < shnum)
+					{
+						auto names = section(sh.link);
+						for(uint64_t k = 1; k < sh.size / sh.entsize && rd.ok; k++)
+						{
+							auto s = sh.offset + k * sh.entsize;
+
+							auto sym = Symbol();
+							sym.name = rd.string(names.offset + rd.get(s, 4));
+							if(rd.is64)
+							{
+								sym.function = ((rd.get(s + 4, 1) & 0xF) == STT_FUNC);
+								sym.address = rd.get(s + 8, 8);
+								sym.size = rd.get(s + 16, 8);
+							}
+							else
+							{
+								sym.address = rd.get(s + 4, 4);
+								sym.size = rd.get(s + 8, 4);
+								sym.function = ((rd.get(s + 12, 1) & 0xF) == STT_FUNC);
+							}
+
+							if(sym.address != 0)
+								img.symbols.push_back(sym);
+						}
+					}
+				}
+			}
+			else
+			{
+				// no section headers (stripped harder than usual), so fall back to the executable segments.
+				for(uint64_t i = 0; i < phnum && rd.ok; i++)
+				{
+					auto base = phoff + i * phentsize;
+					if(rd.get(base, 4) != PT_LOAD)
+						continue;
+
+					auto flags = rd.get(base + (rd.is64 ? 0x04 : 0x18), 4);
+					auto sec = Section();
+					sec.name = "<segment>";
+					sec.offset = rd.word(base + (rd.is64 ? 0x08 : 0x04));
+					sec.address = rd.word(base + (rd.is64 ? 0x10 : 0x08));
+					sec.size = rd.word(base + (rd.is64 ? 0x20 : 0x10));
+					sec.executable = (flags & PF_X);
+					sec.loaded = true;
+
+					if(sec.offset + sec.size <= bytes.size())
+						img.sections.push_back(sec);
+				}
+			}
+
+			return rd.ok;
+		}
+	}
+
+	// if the file is not an elf, then treat the entire thing as code starting at `base`.
+	inline Image loadImage(std::vector<uint8_t> bytes, bool raw, uint64_t base, int bits)
+	{
+		auto img = Image();
+		img.bytes = std::move(bytes);
+
+		if(raw || !elf::load(img))
+		{
+			img.sections.clear();
+			img.symbols.clear();
+
+			auto sec = Section();
+			sec.name = "<raw>";
+			sec.address = base;
+			sec.offset = 0;
+			sec.size = img.bytes.size();
+			sec.executable = true;
+			sec.loaded = true;
+
+			img.sections.push_back(sec);
+			img.bits = bits;
+			img.entry = base;
+			img.hasEntry = true;
+		}
+
+		return img;
+	}
+}
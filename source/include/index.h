@@ -0,0 +1,515 @@
+// index.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "image.h"
+#include "x86/flow.h"
+
+namespace instrad
+{
+	// an on-disk index of a decoded image, meant to be mmap-ed and used in place: a linear sweep of every
+	// executable section, boiled down to one small record per instruction, plus a bitmap of the instruction
+	// starts, and the sections and symbols of the image. the whole thing is tied to the bytes it was built
+	// from by their hash, so a stale index is never used.
+	//
+	// the layout is (all little-endian, every table 8-byte aligned, and all offsets from the start):
+	//   Header
+	//   SectionEntry[sectionCount]
+	//   SymbolEntry[symbolCount]
+	//   OpEntry[opCount]
+	//   for every executable section: InstrRecord[instructionCount], then uint64_t[(size + 63) / 64]
+	//   the string table (names, each with a null terminator)
+	namespace index
+	{
+		constexpr char MAGIC[8] = { 'i', 'n', 's', 't', 'r', 'a', 'd', 'x' };
+		constexpr uint32_t VERSION = 1;
+
+		struct Header
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t bits;
+
+			uint64_t contentHash;       // of the image's bytes (the whole file)
+			uint64_t contentSize;
+
+			uint64_t entry;
+			uint32_t hasEntry;
+			uint32_t opCount;
+
+			uint32_t sectionCount;
+			uint32_t symbolCount;
+
+			uint64_t sectionsOffset;
+			uint64_t symbolsOffset;
+			uint64_t opsOffset;
+			uint64_t stringsOffset;
+			uint64_t stringsSize;
+			uint64_t totalSize;
+		};
+
+		struct SectionEntry
+		{
+			uint64_t address;
+			uint64_t size;
+			uint64_t fileOffset;
+
+			uint32_t name;              // in the string table
+			uint32_t flags;
+
+			// only for executable sections; 0 otherwise.
+			uint64_t instructionCount;
+			uint64_t recordsOffset;
+			uint64_t startsOffset;
+		};
+
+		struct SymbolEntry
+		{
+			uint64_t address;
+			uint64_t size;
+			uint32_t name;
+			uint32_t function;
+		};
+
+		// the ops in the index get their own numbering (the order they were first seen in), so that
+		// the records don't need the library's op table to make sense.
+		struct OpEntry
+		{
+			int64_t id;                 // Op::id()
+			uint32_t mnemonic;
+			uint32_t extension;
+		};
+
+		struct InstrRecord
+		{
+			uint32_t offset;            // from the start of the section
+			uint16_t op;                // into the OpEntry table
+			uint8_t length;             // how far the sweep stepped, so never 0
+			uint8_t flags;
+
+			// the branch target if FLAG_BRANCH, or the memory operand's address if FLAG_MEMORY.
+			uint64_t ref;
+		};
+
+		constexpr uint32_t SECTION_EXECUTABLE   = 0x1;
+		constexpr uint32_t SECTION_LOADED       = 0x2;
+
+		constexpr uint8_t FLAG_INVALID          = 0x01;
+		constexpr uint8_t FLAG_BRANCH           = 0x02;    // pc-relative jmp/jcc/call/loop
+		constexpr uint8_t FLAG_MEMORY           = 0x04;    // memory operand with a static address
+		constexpr uint8_t FLAG_CALL             = 0x08;
+		constexpr uint8_t FLAG_TERMINATOR       = 0x10;    // doesn't fall through
+
+		static_assert(sizeof(Header) == 104);
+		static_assert(sizeof(SectionEntry) == 56);
+		static_assert(sizeof(SymbolEntry) == 24);
+		static_assert(sizeof(OpEntry) == 16);
+		static_assert(sizeof(InstrRecord) == 16);
+
+		// not cryptographic; it only has to notice that the file changed. eats 8 bytes at a time, so
+		// hashing the file is a small fraction of what decoding it costs.
+		inline uint64_t contentHash(const uint8_t* bytes, size_t len)
+		{
+			constexpr uint64_t K = 0x9E3779B97F4A7C15;
+
+			auto mix = [](uint64_t h) -> uint64_t {
+				h ^= h >> 31;
+				h *= 0xBF58476D1CE4E5B9;
+				h ^= h >> 29;
+				return h;
+			};
+
+			uint64_t h = len * K;
+			size_t i = 0;
+			for(; i + 8 <= len; i += 8)
+			{
+				uint64_t w = 0;
+				memcpy(&w, bytes + i, 8);
+				h = mix(h ^ (w * K)) + K;
+			}
+
+			uint64_t tail = 0;
+			memcpy(&tail, bytes + i, len - i);
+
+			return mix(h ^ (tail * K) ^ (len - i));
+		}
+
+		inline size_t align8(size_t n) { return (n + 7) & ~(size_t) 7; }
+
+		// sweeps the image and lays out the whole index in memory.
+		inline std::vector<uint8_t> build(const Image& img)
+		{
+			using namespace x86;
+
+			auto strings = std::string();
+			auto addString = [&strings](const std::string& s) -> uint32_t {
+				auto ret = (uint32_t) strings.size();
+				strings += s;
+				strings += '\0';
+				return ret;
+			};
+
+			auto ops = std::vector<OpEntry>();
+			auto opIndex = std::vector<int32_t>();     // Op::id() + 2 (INVALID is -2) -> index into `ops`
+			auto addOp = [&](const Op& op) -> uint16_t {
+				auto k = (size_t) (op.id() + 2);
+				if(k >= opIndex.size())
+					opIndex.resize(k + 1, -1);
+
+				if(opIndex[k] < 0)
+				{
+					opIndex[k] = (int32_t) ops.size();
+					ops.push_back(OpEntry { (int64_t) op.id(), addString(op.mnemonic()), (uint32_t) op.extension() });
+				}
+
+				return (uint16_t) opIndex[k];
+			};
+
+			auto mode = img.bits == 16 ? ExecMode::Legacy : img.bits == 32 ? ExecMode::Compat : ExecMode::Long;
+
+			auto sections = std::vector<SectionEntry>();
+			auto records = std::vector<std::vector<InstrRecord>>();
+			auto starts = std::vector<std::vector<uint64_t>>();
+
+			for(auto& sec : img.sections)
+			{
+				auto entry = SectionEntry();
+				memset(&entry, 0, sizeof(entry));
+
+				entry.address = sec.address;
+				entry.size = sec.size;
+				entry.fileOffset = sec.offset;
+				entry.name = addString(sec.name);
+				entry.flags = (sec.executable ? SECTION_EXECUTABLE : 0) | (sec.loaded ? SECTION_LOADED : 0);
+
+				auto& recs = records.emplace_back();
+				auto& bits = starts.emplace_back();
+
+				// the record offsets are 32 bits; a section bigger than that doesn't get decoded.
+				if(sec.executable && sec.size <= UINT32_MAX)
+				{
+					auto region = CodeRegion(img.data(sec), sec.size, sec.address, mode);
+					bits.resize((sec.size + 63) / 64);
+
+					for(auto ip = region.base(); ip < region.end(); )
+					{
+						auto instr = region.decode(ip);
+						auto len = region.nextBoundary(ip, instr) - ip;
+
+						auto rec = InstrRecord();
+						memset(&rec, 0, sizeof(rec));
+
+						auto& op = instr.op();
+						rec.offset = (uint32_t) region.offsetOf(ip);
+						rec.op = addOp(op);
+						rec.length = (uint8_t) len;
+
+						if(op == ops::INVALID)                  rec.flags |= FLAG_INVALID;
+						if(isCall(op))                          rec.flags |= FLAG_CALL;
+						if(isFlowTerminator(op))                rec.flags |= FLAG_TERMINATOR;
+
+						if(hasRelativeTarget(instr))
+						{
+							rec.flags |= FLAG_BRANCH;
+							rec.ref = branchTarget(instr, ip);
+						}
+						else if(op != ops::INVALID && effectiveAddress(instr, ip, rec.ref))
+						{
+							rec.flags |= FLAG_MEMORY;
+						}
+
+						bits[rec.offset / 64] |= (uint64_t) 1 << (rec.offset % 64);
+						recs.push_back(rec);
+
+						ip += len;
+					}
+
+					entry.instructionCount = recs.size();
+				}
+
+				sections.push_back(entry);
+			}
+
+			auto symbols = std::vector<SymbolEntry>();
+			for(auto& sym : img.symbols)
+				symbols.push_back(SymbolEntry { sym.address, sym.size, addString(sym.name), sym.function ? 1u : 0u });
+
+			// now that everything is known, lay it out.
+			auto hdr = Header();
+			memset(&hdr, 0, sizeof(hdr));
+			memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+
+			hdr.version = VERSION;
+			hdr.bits = (uint32_t) img.bits;
+			hdr.contentHash = contentHash(img.bytes.data(), img.bytes.size());
+			hdr.contentSize = img.bytes.size();
+			hdr.entry = img.entry;
+			hdr.hasEntry = img.hasEntry;
+			hdr.opCount = (uint32_t) ops.size();
+			hdr.sectionCount = (uint32_t) sections.size();
+			hdr.symbolCount = (uint32_t) symbols.size();
+
+			size_t ofs = sizeof(Header);
+			hdr.sectionsOffset = ofs;   ofs += sections.size() * sizeof(SectionEntry);
+			hdr.symbolsOffset = ofs;    ofs += symbols.size() * sizeof(SymbolEntry);
+			hdr.opsOffset = ofs;        ofs += ops.size() * sizeof(OpEntry);
+
+			for(size_t i = 0; i < sections.size(); i++)
+			{
+				if(records[i].empty())
+					continue;
+
+				sections[i].recordsOffset = ofs;    ofs += records[i].size() * sizeof(InstrRecord);
+				sections[i].startsOffset = ofs;     ofs += starts[i].size() * sizeof(uint64_t);
+			}
+
+			hdr.stringsOffset = ofs;
+			hdr.stringsSize = strings.size();
+			hdr.totalSize = align8(ofs + strings.size());
+
+			auto out = std::vector<uint8_t>(hdr.totalSize);
+			auto put = [&out](uint64_t at, const void* src, size_t n) {
+				if(n > 0)
+					memcpy(out.data() + at, src, n);
+			};
+
+			put(0, &hdr, sizeof(hdr));
+			put(hdr.sectionsOffset, sections.data(), sections.size() * sizeof(SectionEntry));
+			put(hdr.symbolsOffset, symbols.data(), symbols.size() * sizeof(SymbolEntry));
+			put(hdr.opsOffset, ops.data(), ops.size() * sizeof(OpEntry));
+
+			for(size_t i = 0; i < sections.size(); i++)
+			{
+				put(sections[i].recordsOffset, records[i].data(), records[i].size() * sizeof(InstrRecord));
+				put(sections[i].startsOffset, starts[i].data(), starts[i].size() * sizeof(uint64_t));
+			}
+
+			put(hdr.stringsOffset, strings.data(), strings.size());
+			return out;
+		}
+
+		// writes to a temporary file next to `path` and renames it over, so that someone else opening
+		// the index at the same time either gets the old one or the new one, never half of it.
+		inline bool write(const std::string& path, const std::vector<uint8_t>& data)
+		{
+			auto tmp = path + ".tmp." + std::to_string(getpid());
+			auto f = fopen(tmp.c_str(), "wb");
+			if(f == nullptr)
+				return false;
+
+			bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+			ok &= (fclose(f) == 0);
+
+			if(!ok || rename(tmp.c_str(), path.c_str()) != 0)
+			{
+				remove(tmp.c_str());
+				return false;
+			}
+
+			return true;
+		}
+	}
+
+	// a read-only view of an index file, mapped into memory. nothing gets copied out of it.
+	struct ImageIndex
+	{
+		ImageIndex() { }
+		~ImageIndex() { this->close(); }
+
+		ImageIndex(const ImageIndex&) = delete;
+		ImageIndex& operator = (const ImageIndex&) = delete;
+
+		// maps the index at `path`, and checks that it belongs to `img` (by the size and hash of its
+		// bytes, and the layout of its sections) and that its tables are where they say they are. returns
+		// false if any of that fails, in which case the index should be rebuilt.
+		bool open(const std::string& path, const Image& img)
+		{
+			this->close();
+
+			auto fd = ::open(path.c_str(), O_RDONLY);
+			if(fd < 0)
+				return false;
+
+			struct stat st;
+			if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(index::Header))
+			{
+				::close(fd);
+				return false;
+			}
+
+			auto ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			::close(fd);
+
+			if(ptr == MAP_FAILED)
+				return false;
+
+			this->m_data = (const uint8_t*) ptr;
+			this->m_size = st.st_size;
+
+			if(!this->validate(img))
+			{
+				this->close();
+				return false;
+			}
+
+			return true;
+		}
+
+		void close()
+		{
+			if(this->m_data != nullptr)
+				munmap((void*) this->m_data, this->m_size);
+
+			this->m_data = nullptr;
+			this->m_size = 0;
+		}
+
+		bool isOpen() const { return this->m_data != nullptr; }
+
+		const index::Header& header() const { return *this->at<index::Header>(0); }
+
+		size_t sectionCount() const { return this->header().sectionCount; }
+		size_t symbolCount() const { return this->header().symbolCount; }
+
+		const index::SectionEntry& section(size_t i) const { return this->at<index::SectionEntry>(this->header().sectionsOffset)[i]; }
+		const index::SymbolEntry& symbol(size_t i) const { return this->at<index::SymbolEntry>(this->header().symbolsOffset)[i]; }
+		const char* string(uint32_t ofs) const { return (const char*) this->m_data + this->header().stringsOffset + ofs; }
+
+		const char* mnemonic(const index::InstrRecord& rec) const
+		{
+			if(rec.op >= this->header().opCount)
+				return "??";
+
+			return this->string(this->at<index::OpEntry>(this->header().opsOffset)[rec.op].mnemonic);
+		}
+
+		const index::InstrRecord* records(const index::SectionEntry& sec) const
+		{
+			return this->at<index::InstrRecord>(sec.recordsOffset);
+		}
+
+		// true if the sweep had an instruction starting at addr.
+		bool isInstructionStart(const index::SectionEntry& sec, uint64_t addr) const
+		{
+			if(sec.instructionCount == 0 || addr < sec.address || addr >= sec.address + sec.size)
+				return false;
+
+			auto ofs = addr - sec.address;
+			return this->at<uint64_t>(sec.startsOffset)[ofs / 64] & ((uint64_t) 1 << (ofs % 64));
+		}
+
+		// the record of the instruction containing addr, or null if no executable section has it.
+		const index::InstrRecord* instructionAt(uint64_t addr) const
+		{
+			for(size_t i = 0; i < this->sectionCount(); i++)
+			{
+				auto& sec = this->section(i);
+				if(sec.instructionCount == 0 || addr < sec.address || addr >= sec.address + sec.size)
+					continue;
+
+				auto begin = this->records(sec);
+				auto end = begin + sec.instructionCount;
+
+				auto ofs = addr - sec.address;
+				auto it = std::upper_bound(begin, end, ofs, [](uint64_t o, const index::InstrRecord& r) { return o < r.offset; });
+
+				return it == begin ? nullptr : (it - 1);
+			}
+
+			return nullptr;
+		}
+
+	private:
+		template <typename T>
+		const T* at(uint64_t ofs) const { return (const T*) (this->m_data + ofs); }
+
+		bool fits(uint64_t ofs, uint64_t count, size_t size) const
+		{
+			return ofs % 8 == 0 && ofs <= this->m_size && count <= (this->m_size - ofs) / size;
+		}
+
+		bool validate(const Image& img) const
+		{
+			auto& hdr = this->header();
+			if(memcmp(hdr.magic, index::MAGIC, sizeof(index::MAGIC)) != 0 || hdr.version != index::VERSION)
+				return false;
+
+			if(hdr.totalSize != this->m_size || hdr.contentSize != img.bytes.size())
+				return false;
+
+			if(!this->fits(hdr.sectionsOffset, hdr.sectionCount, sizeof(index::SectionEntry))
+				|| !this->fits(hdr.symbolsOffset, hdr.symbolCount, sizeof(index::SymbolEntry))
+				|| !this->fits(hdr.opsOffset, hdr.opCount, sizeof(index::OpEntry))
+				|| hdr.stringsOffset > this->m_size || hdr.stringsSize > this->m_size - hdr.stringsOffset)
+				return false;
+
+			// every name is looked up without a length, so the table had better end in a terminator.
+			if(hdr.stringsSize == 0 || this->m_data[hdr.stringsOffset + hdr.stringsSize - 1] != 0)
+				return false;
+
+			// the same bytes loaded differently (--raw, --base, --bits) don't make the same index either.
+			if(hdr.bits != (uint32_t) img.bits || hdr.sectionCount != img.sections.size())
+				return false;
+
+			for(size_t i = 0; i < hdr.sectionCount; i++)
+			{
+				auto& sec = this->section(i);
+				if(sec.name >= hdr.stringsSize || sec.address != img.sections[i].address || sec.size != img.sections[i].size)
+					return false;
+
+				if(sec.instructionCount > 0 && (!this->fits(sec.recordsOffset, sec.instructionCount, sizeof(index::InstrRecord))
+					|| !this->fits(sec.startsOffset, (sec.size + 63) / 64, sizeof(uint64_t))))
+					return false;
+			}
+
+			for(size_t i = 0; i < hdr.symbolCount; i++)
+			{
+				if(this->symbol(i).name >= hdr.stringsSize)
+					return false;
+			}
+
+			// the records themselves aren't checked (there are millions of them); mnemonic() copes with a
+			// bad op index instead.
+			for(size_t i = 0; i < hdr.opCount; i++)
+			{
+				if(this->at<index::OpEntry>(hdr.opsOffset)[i].mnemonic >= hdr.stringsSize)
+					return false;
+			}
+
+			// last, because it's the only check that has to read the whole image.
+			return hdr.contentHash == index::contentHash(img.bytes.data(), img.bytes.size());
+		}
+
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0;
+	};
+
+	// maps the index at `path` if it matches the image; otherwise (it doesn't exist, it's for another
+	// version of the file, or it's damaged) decodes the image, writes a new one and maps that. `rebuilt`
+	// says which happened. returns false only if a new index couldn't be written or read back.
+	inline bool openIndex(const std::string& path, const Image& img, ImageIndex& out, bool* rebuilt = nullptr)
+	{
+		if(rebuilt != nullptr)
+			*rebuilt = false;
+
+		if(out.open(path, img))
+			return true;
+
+		if(rebuilt != nullptr)
+			*rebuilt = true;
+
+		return index::write(path, index::build(img)) && out.open(path, img);
+	}
+}
@@ -0,0 +1,382 @@
+// bindiff.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+#include "flow.h"
+#include "similarity.h"
+
+namespace instrad::x86
+{
+	// diffs two builds of the same program function by function, at the level of instructions. the point is
+	// to see what the compiler did differently, so anything that only changes because code moved around
+	// doesn't count: branch and call offsets, and rip-relative displacements. everything else (registers,
+	// immediates, other displacements, prefixes) does.
+	namespace bindiff
+	{
+		inline uint64_t hashRegister(const Register& reg)
+		{
+			return reg.present() ? minhash::combine(reg.index(), reg.width()) : 0;
+		}
+
+		constexpr bool isRipRelative(const MemoryRef& mem)
+		{
+			return mem.base().present() && (mem.base().index() & regs::REG_FLAG_IP);
+		}
+
+		// the hash of one instruction, with the address-dependent parts left out. undecodable bytes hash
+		// to the byte itself, so that junk still has to match junk.
+		inline uint64_t hashInstruction(const Instruction& instr, const uint8_t* bytes)
+		{
+			using minhash::combine;
+
+			if(instr.op() == ops::INVALID)
+				return combine(0xFFFF, bytes[0]);
+
+			auto h = combine(instr.op().id(), instr.operandCount());
+			h = combine(h, (instr.lockPrefix() ? 1 : 0) | (instr.repPrefix() ? 2 : 0) | (instr.repnzPrefix() ? 4 : 0));
+
+			const Operand* operands[] = { &instr.dst(), &instr.src(), &instr.ext(), &instr.op4() };
+			for(int i = 0; i < instr.operandCount() && i < 4; i++)
+			{
+				auto& o = *operands[i];
+				if(o.isRegister())
+				{
+					h = combine(h, 1);
+					h = combine(h, hashRegister(o.reg()));
+				}
+				else if(o.isImmediate())
+				{
+					h = combine(h, 2);
+					h = combine(h, o.immediateSize());
+					h = combine(h, o.imm());
+				}
+				else if(o.isMemory())
+				{
+					auto& mem = o.mem();
+					h = combine(h, 3);
+					h = combine(h, mem.bits());
+					h = combine(h, hashRegister(mem.base()));
+					h = combine(h, hashRegister(mem.index()));
+					h = combine(h, mem.index().present() ? mem.scale() : 0);
+					h = combine(h, hashRegister(mem.segment()));
+					h = combine(h, isRipRelative(mem) ? 0 : mem.displacement());
+				}
+				else if(o.isRelativeOffset())
+				{
+					// not even the size: a jmp that turned from rel32 into rel8 only moved.
+					h = combine(h, 4);
+				}
+				else
+				{
+					auto& far = o.far();
+					h = combine(h, 5);
+					h = combine(h, far.isMemory() ? 0 : far.segment());
+					h = combine(h, far.isMemory() ? far.memory().displacement() : far.offset());
+				}
+			}
+
+			return h;
+		}
+	}
+
+	struct DiffFunction
+	{
+		std::string name;                   // can be empty, if there's no symbol for it
+		uint64_t address = 0;
+		uint64_t size = 0;
+
+		std::vector<uint64_t> addresses;    // of each instruction
+		std::vector<uint64_t> hashes;       // and its hash (bindiff::hashInstruction)
+
+		uint64_t hash = 0;                  // of the whole sequence
+	};
+
+	// a run of instructions that changed: [before, beforeEnd) in the old function was replaced by
+	// [after, afterEnd) in the new one (either can be empty). these are indices, not addresses.
+	struct DiffHunk
+	{
+		size_t before = 0;
+		size_t beforeEnd = 0;
+		size_t after = 0;
+		size_t afterEnd = 0;
+	};
+
+	struct FunctionDiff
+	{
+		enum class Match { Name, Hash };
+
+		size_t before = 0;          // indices into the two lists of functions
+		size_t after = 0;
+		Match match = Match::Name;
+
+		// empty if nothing changed. if there were too many changes to line them up (more than the
+		// `maxEdits` given to diffBinaries), it's one hunk covering everything that differs.
+		std::vector<DiffHunk> hunks;
+		bool rewritten = false;
+	};
+
+	struct BinaryDiff
+	{
+		std::vector<FunctionDiff> functions;    // in the order of the new functions
+
+		std::vector<size_t> removed;            // old functions that weren't matched
+		std::vector<size_t> added;              // new functions that weren't matched
+	};
+
+	// decodes [lo, hi) linearly, the same way as a sweep.
+	inline DiffFunction makeDiffFunction(const CodeRegion& region, uint64_t lo, uint64_t hi, std::string name)
+	{
+		auto ret = DiffFunction();
+		ret.name = std::move(name);
+
+		lo = std::max(lo, region.base());
+		hi = std::min(hi, region.end());
+
+		ret.address = lo;
+		ret.size = hi > lo ? hi - lo : 0;
+
+		for(auto ip = lo; ip < hi; )
+		{
+			auto instr = region.decode(ip);
+
+			ret.addresses.push_back(ip);
+			ret.hashes.push_back(bindiff::hashInstruction(instr, region.bytes() + region.offsetOf(ip)));
+			ret.hash = minhash::combine(ret.hash, ret.hashes.back());
+
+			ip = region.nextBoundary(ip, instr);
+		}
+
+		return ret;
+	}
+
+	// the shortest edit script between two sequences (myers' O(ND) algorithm), as hunks. gives up and
+	// returns one hunk for the whole differing middle if it would take more than maxEdits.
+	inline std::vector<DiffHunk> diffSequences(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b,
+		size_t maxEdits, bool* gaveUp = nullptr)
+	{
+		if(gaveUp)
+			*gaveUp = false;
+
+		// the common prefix and suffix don't need the expensive part.
+		size_t pre = 0;
+		while(pre < a.size() && pre < b.size() && a[pre] == b[pre])
+			pre++;
+
+		size_t suf = 0;
+		while(suf < a.size() - pre && suf < b.size() - pre && a[a.size() - 1 - suf] == b[b.size() - 1 - suf])
+			suf++;
+
+		auto n = (int64_t) (a.size() - pre - suf);
+		auto m = (int64_t) (b.size() - pre - suf);
+		if(n == 0 && m == 0)
+			return { };
+
+		auto whole = DiffHunk { pre, pre + (size_t) n, pre, pre + (size_t) m };
+		if(n == 0 || m == 0)
+			return { whole };
+
+		auto A = a.data() + pre;
+		auto B = b.data() + pre;
+
+		// v[k + max + 1] is the furthest x reached on diagonal k; trace[d] keeps the part of it that was
+		// live after d edits (diagonals -d to d), for walking back.
+		auto max = std::min(n + m, (int64_t) maxEdits);
+		auto v = std::vector<int64_t>(2 * max + 3, 0);
+		auto trace = std::vector<std::vector<int64_t>>();
+
+		int64_t found = -1;
+		for(int64_t d = 0; d <= max && found < 0; d++)
+		{
+			for(int64_t k = -d; k <= d; k += 2)
+			{
+				auto& here = v[k + max + 1];
+				int64_t x = 0;
+				if(k == -d || (k != d && v[k - 1 + max + 1] < v[k + 1 + max + 1]))
+					x = v[k + 1 + max + 1];
+				else
+					x = v[k - 1 + max + 1] + 1;
+
+				auto y = x - k;
+				while(x < n && y < m && A[x] == B[y])
+					x++, y++;
+
+				here = x;
+				if(x >= n && y >= m)
+				{
+					found = d;
+					break;
+				}
+			}
+
+			trace.emplace_back(v.begin() + (max + 1 - d), v.begin() + (max + 1 + d + 1));
+		}
+
+		if(found < 0)
+		{
+			if(gaveUp)
+				*gaveUp = true;
+
+			return { whole };
+		}
+
+		// walk back from the end, one edit at a time; each edit comes after a (maybe empty) run of equal
+		// elements. 'E'qual, 'D'elete (from a), 'I'nsert (from b), in reverse.
+		auto script = std::string();
+		int64_t x = n;
+		int64_t y = m;
+		for(int64_t d = found; d > 0; d--)
+		{
+			auto& prev = trace[d - 1];
+			auto at = [&](int64_t k) { return prev[k + (d - 1)]; };
+
+			auto k = x - y;
+			auto prevK = (k == -d || (k != d && at(k - 1) < at(k + 1))) ? k + 1 : k - 1;
+			auto prevX = at(prevK);
+			auto prevY = prevX - prevK;
+
+			while(x > prevX && y > prevY)
+				script += 'E', x--, y--;
+
+			script += (x == prevX) ? 'I' : 'D';
+			x = prevX;
+			y = prevY;
+		}
+
+		script.append((size_t) x, 'E');
+		std::reverse(script.begin(), script.end());
+
+		auto hunks = std::vector<DiffHunk>();
+		size_t i = pre;
+		size_t j = pre;
+		bool open = false;
+		for(auto c : script)
+		{
+			if(c == 'E')
+			{
+				open = false;
+				i++, j++;
+				continue;
+			}
+
+			if(!open)
+				hunks.push_back(DiffHunk { i, i, j, j });
+
+			open = true;
+			if(c == 'D')    hunks.back().beforeEnd = ++i;
+			else            hunks.back().afterEnd = ++j;
+		}
+
+		return hunks;
+	}
+
+	// matches the functions of two builds, first by name and then (for the ones left over) by the hash of
+	// their instructions, both with hash joins: the k-th function with some name (or hash) in the old build
+	// goes with the k-th one in the new build. then diffs every matched pair, on `threads` threads
+	// (0 for one per core).
+	inline BinaryDiff diffBinaries(const std::vector<DiffFunction>& before, const std::vector<DiffFunction>& after,
+		size_t threads = 0, size_t maxEdits = 1024)
+	{
+		auto ret = BinaryDiff();
+
+		auto matchedBefore = std::vector<bool>(before.size());
+		auto matchedAfter = std::vector<bool>(after.size());
+
+		auto pairs = std::vector<FunctionDiff>();
+
+		// functions without a name only get matched by their hash.
+		auto join = [&](auto keyOf, FunctionDiff::Match how) {
+			using Key = std::decay_t<decltype(keyOf(before[0]))>;
+			auto usable = [how](const DiffFunction& f) { return how != FunctionDiff::Match::Name || !f.name.empty(); };
+
+			auto table = std::unordered_map<Key, std::vector<size_t>>();
+			for(size_t i = before.size(); i-- > 0; )
+			{
+				if(!matchedBefore[i] && usable(before[i]))
+					table[keyOf(before[i])].push_back(i);
+			}
+
+			for(size_t j = 0; j < after.size(); j++)
+			{
+				if(matchedAfter[j] || !usable(after[j]))
+					continue;
+
+				auto it = table.find(keyOf(after[j]));
+				if(it == table.end() || it->second.empty())
+					continue;
+
+				// the buckets were filled backwards, so this takes them in order.
+				auto i = it->second.back();
+				it->second.pop_back();
+
+				matchedBefore[i] = true;
+				matchedAfter[j] = true;
+
+				auto fd = FunctionDiff();
+				fd.before = i;
+				fd.after = j;
+				fd.match = how;
+				pairs.push_back(std::move(fd));
+			}
+		};
+
+		if(!before.empty())
+		{
+			join([](const DiffFunction& f) -> const std::string& { return f.name; }, FunctionDiff::Match::Name);
+			join([](const DiffFunction& f) -> uint64_t { return f.hash; }, FunctionDiff::Match::Hash);
+		}
+
+		std::sort(pairs.begin(), pairs.end(), [](auto& a, auto& b) { return a.after < b.after; });
+
+		auto cursor = std::atomic<size_t>(0);
+		auto work = [&]() {
+			size_t i = 0;
+			while((i = cursor.fetch_add(1)) < pairs.size())
+			{
+				auto& fd = pairs[i];
+				auto& a = before[fd.before];
+				auto& b = after[fd.after];
+
+				if(a.hash == b.hash && a.hashes.size() == b.hashes.size())
+					continue;
+
+				fd.hunks = diffSequences(a.hashes, b.hashes, maxEdits, &fd.rewritten);
+			}
+		};
+
+		if(threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		auto pool = std::vector<std::thread>();
+		for(size_t t = 1; t < std::min(threads, pairs.size()); t++)
+			pool.emplace_back(work);
+
+		work();
+		for(auto& t : pool)
+			t.join();
+
+		ret.functions = std::move(pairs);
+		for(size_t i = 0; i < before.size(); i++)
+		{
+			if(!matchedBefore[i])
+				ret.removed.push_back(i);
+		}
+
+		for(size_t j = 0; j < after.size(); j++)
+		{
+			if(!matchedAfter[j])
+				ret.added.push_back(j);
+		}
+
+		return ret;
+	}
+}
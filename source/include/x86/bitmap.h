@@ -0,0 +1,213 @@
+// bitmap.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	// the instruction starts of a region (one bit per byte of code, as Disassembly::starts and friends
+	// have them), plus enough on the side to count and find them in constant time:
+	// - rank: for every block of 8 words, the number of starts before it, and the running counts of the
+	//   first 7 words inside it (9 bits each, packed into one more word); so 1/4 of a bit per byte on top.
+	// - select: the block that the every 512th start is in; the k-th start is then between two samples,
+	//   which is a handful of blocks for code (there's usually a start every 3-4 bytes), and a binary
+	//   search finds it in those.
+	//
+	// this doesn't change after it's built; sweep again (or update an IncrementalSweep) and make a new one.
+	struct InstructionBitmap
+	{
+		static constexpr size_t NOT_FOUND = (size_t) -1;
+
+		InstructionBitmap() { }
+
+		// `starts` has bit N set if an instruction starts at region.base() + N.
+		InstructionBitmap(const CodeRegion& region, std::vector<uint64_t> starts)
+			: m_base(region.base()), m_size(region.size()), m_words(std::move(starts))
+		{
+			this->m_words.resize((this->m_size + 63) / 64);
+
+			// don't let anything past the end of the region count.
+			if(this->m_size % 64 != 0)
+				this->m_words.back() &= ((uint64_t) 1 << (this->m_size % 64)) - 1;
+
+			auto blocks = (this->m_words.size() + 7) / 8;
+			this->m_ranks.resize(2 * blocks + 2);
+
+			uint64_t total = 0;
+			for(size_t b = 0; b < blocks; b++)
+			{
+				uint64_t inside = 0;
+				uint64_t packed = 0;
+				for(size_t k = 0; k < 8; k++)
+				{
+					if(k > 0)
+						packed |= inside << (9 * (k - 1));
+
+					auto w = (b * 8) + k;
+					if(w < this->m_words.size())
+					{
+						auto bits = this->m_words[w];
+						for(; bits != 0; bits &= (bits - 1))
+						{
+							if(total + inside == this->m_samples.size() * SAMPLE)
+								this->m_samples.push_back((uint32_t) b);
+
+							inside++;
+						}
+					}
+				}
+
+				this->m_ranks[2 * b] = total;
+				this->m_ranks[2 * b + 1] = packed;
+				total += inside;
+			}
+
+			// a sentinel block, so that rank() at the very end and select()'s search both have an upper end.
+			this->m_ranks[2 * blocks] = total;
+			this->m_samples.push_back((uint32_t) blocks);
+
+			this->m_count = total;
+		}
+
+		uint64_t base() const { return this->m_base; }
+		uint64_t end() const { return this->m_base + this->m_size; }
+		size_t count() const { return this->m_count; }
+
+		const std::vector<uint64_t>& words() const { return this->m_words; }
+
+		// bytes used, including the bitmap itself.
+		size_t memoryUsage() const
+		{
+			return (this->m_words.size() + this->m_ranks.size()) * sizeof(uint64_t) + this->m_samples.size() * sizeof(uint32_t);
+		}
+
+		bool contains(uint64_t addr) const { return addr >= this->m_base && addr < this->end(); }
+
+		bool isInstructionStart(uint64_t addr) const
+		{
+			if(!this->contains(addr))
+				return false;
+
+			auto ofs = addr - this->m_base;
+			return this->m_words[ofs / 64] & ((uint64_t) 1 << (ofs % 64));
+		}
+
+		// the number of instructions that start before addr (which can be anywhere; it's clamped).
+		size_t rank(uint64_t addr) const
+		{
+			if(addr <= this->m_base)
+				return 0;
+
+			if(addr >= this->end())
+				return this->m_count;
+
+			auto ofs = addr - this->m_base;
+			auto w = ofs / 64;
+
+			auto bits = this->m_words[w] & (((uint64_t) 1 << (ofs % 64)) - 1);
+			return this->wordRank(w) + __builtin_popcountll(bits);
+		}
+
+		// the index (in address order) of the instruction that contains addr, ie. the last one starting at
+		// or before it; NOT_FOUND if there isn't one.
+		size_t indexOf(uint64_t addr) const
+		{
+			if(!this->contains(addr))
+				return NOT_FOUND;
+
+			auto r = this->rank(addr + 1);
+			return r == 0 ? NOT_FOUND : r - 1;
+		}
+
+		// the address of the k-th instruction (from 0); end() if there aren't that many.
+		uint64_t select(size_t k) const
+		{
+			if(k >= this->m_count)
+				return this->end();
+
+			// the last block whose starting rank is <= k, somewhere between the two samples around k.
+			auto lo = (size_t) this->m_samples[k / SAMPLE];
+			auto hi = (size_t) this->m_samples[k / SAMPLE + 1];
+			while(lo < hi)
+			{
+				auto mid = (lo + hi + 1) / 2;
+				if(this->m_ranks[2 * mid] <= k)    lo = mid;
+				else                                hi = mid - 1;
+			}
+
+			auto b = lo;
+			auto left = k - this->m_ranks[2 * b];
+
+			// then the word inside the block, from the packed running counts.
+			size_t w = 0;
+			auto packed = this->m_ranks[2 * b + 1];
+			while(w < 7 && ((packed >> (9 * w)) & 0x1FF) <= left)
+				w++;
+
+			if(w > 0)
+				left -= (packed >> (9 * (w - 1))) & 0x1FF;
+
+			auto word = (b * 8) + w;
+			return this->m_base + (word * 64) + selectInWord(this->m_words[word], left);
+		}
+
+		// the start of the instruction containing addr; NOT_FOUND if there isn't one.
+		uint64_t boundaryBefore(uint64_t addr) const
+		{
+			auto i = this->indexOf(addr);
+			return i == NOT_FOUND ? NOT_FOUND : this->select(i);
+		}
+
+		// the first start after addr; end() if there isn't one.
+		uint64_t boundaryAfter(uint64_t addr) const
+		{
+			return this->select(this->rank(addr + 1));
+		}
+
+	private:
+		static constexpr size_t SAMPLE = 512;
+
+		size_t wordRank(size_t w) const
+		{
+			auto b = w / 8;
+			auto k = w % 8;
+
+			auto ret = this->m_ranks[2 * b];
+			if(k > 0)
+				ret += (this->m_ranks[2 * b + 1] >> (9 * (k - 1))) & 0x1FF;
+
+			return ret;
+		}
+
+		// the position of the n-th set bit (from 0) of x, which has to have more than n of them.
+		static size_t selectInWord(uint64_t x, size_t n)
+		{
+		#if defined(__BMI2__)
+			return __builtin_ctzll(_pdep_u64((uint64_t) 1 << n, x));
+		#else
+			for(size_t i = 0; i < n; i++)
+				x &= (x - 1);
+
+			return __builtin_ctzll(x);
+		#endif
+		}
+
+		uint64_t m_base = 0;
+		size_t m_size = 0;
+		size_t m_count = 0;
+
+		std::vector<uint64_t> m_words;
+		std::vector<uint64_t> m_ranks;      // per block: starts before it, then the packed counts inside it
+		std::vector<uint32_t> m_samples;    // the block holding start number (i * SAMPLE)
+	};
+}
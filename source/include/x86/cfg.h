@@ -0,0 +1,349 @@
+// cfg.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "flow.h"
+#include "jumptable.h"
+
+namespace instrad::x86
+{
+	enum class EdgeKind : uint8_t
+	{
+		Fallthrough,    // the next block, with no branch
+		Branch,         // taken side of a jcc/loop
+		Jump,           // unconditional jmp
+		CallReturn,     // the instruction after a call
+		Switch,         // one of the targets of a jump table
+	};
+
+	// the graph is stored in compressed-sparse-row form: the successors of block `i` are
+	// edgeTargets[edgeOffsets[i] .. edgeOffsets[i + 1]]. there are no per-node allocations, so
+	// a graph costs 16 bytes per block and 5 bytes per edge.
+	struct ControlFlowGraph
+	{
+		std::vector<uint64_t> blockStarts;  // sorted by address
+		std::vector<uint32_t> blockSizes;   // in bytes
+		std::vector<uint32_t> edgeOffsets;  // blockStarts.size() + 1 entries
+		std::vector<uint32_t> edgeTargets;  // block indices
+		std::vector<EdgeKind> edgeKinds;
+
+		uint32_t entryBlock = 0;
+
+		size_t numBlocks() const { return this->blockStarts.size(); }
+		size_t numEdges() const { return this->edgeTargets.size(); }
+
+		uint32_t firstEdge(size_t block) const { return this->edgeOffsets[block]; }
+		uint32_t lastEdge(size_t block) const { return this->edgeOffsets[block + 1]; }
+
+		// returns the index of the block containing `addr`, or -1 if there isn't one.
+		int64_t blockContaining(uint64_t addr) const
+		{
+			auto it = std::upper_bound(this->blockStarts.begin(), this->blockStarts.end(), addr);
+			if(it == this->blockStarts.begin())
+				return -1;
+
+			auto idx = (it - this->blockStarts.begin()) - 1;
+			if(addr >= this->blockStarts[idx] + this->blockSizes[idx])
+				return -1;
+
+			return idx;
+		}
+	};
+
+	namespace cfg
+	{
+		// a tiny open-addressing hash set, so that the builder doesn't allocate per instruction.
+		struct AddressSet
+		{
+			void reset(size_t expected)
+			{
+				size_t cap = 64;
+				while(cap < 2 * expected)
+					cap *= 2;
+
+				if(this->slots.size() != cap)   this->slots.assign(cap, EMPTY);
+				else                            std::fill(this->slots.begin(), this->slots.end(), EMPTY);
+
+				this->count = 0;
+			}
+
+			// returns true if the address was newly inserted.
+			bool insert(uint64_t addr)
+			{
+				if(2 * (this->count + 1) > this->slots.size())
+					this->grow();
+
+				auto mask = this->slots.size() - 1;
+				for(auto i = hash(addr) & mask; ; i = (i + 1) & mask)
+				{
+					if(this->slots[i] == addr)
+						return false;
+
+					if(this->slots[i] == EMPTY)
+					{
+						this->slots[i] = addr;
+						this->count++;
+						return true;
+					}
+				}
+			}
+
+		private:
+			static constexpr uint64_t EMPTY = ~(uint64_t) 0;
+			static uint64_t hash(uint64_t x) { return (x * 0x9E3779B97F4A7C15) >> 20; }
+
+			void grow()
+			{
+				auto old = std::move(this->slots);
+				this->slots.assign(std::max((size_t) 64, old.size() * 2), EMPTY);
+				this->count = 0;
+
+				for(auto a : old)
+				{
+					if(a != EMPTY)
+						this->insert(a);
+				}
+			}
+
+			std::vector<uint64_t> slots;
+			size_t count = 0;
+		};
+
+		struct Insn
+		{
+			uint64_t addr;
+			uint64_t target;        // branch target, if any
+			uint8_t length;
+			uint8_t flags;
+		};
+
+		constexpr uint8_t FLAG_TERMINATOR   = 0x1;  // ends a block
+		constexpr uint8_t FLAG_FALLTHROUGH  = 0x2;  // ...but execution can continue to the next instruction
+		constexpr uint8_t FLAG_HAS_TARGET   = 0x4;
+		constexpr uint8_t FLAG_CALL         = 0x8;
+		constexpr uint8_t FLAG_CONDITIONAL  = 0x10;
+
+		constexpr uint8_t classify(const Instruction& instr)
+		{
+			auto& op = instr.op();
+			uint8_t flags = 0;
+
+			if(isConditionalJump(op) || isLoop(op))     flags = FLAG_TERMINATOR | FLAG_FALLTHROUGH | FLAG_CONDITIONAL;
+			else if(isCall(op))                         flags = FLAG_TERMINATOR | FLAG_FALLTHROUGH | FLAG_CALL;
+			else if(isFlowTerminator(op))               flags = FLAG_TERMINATOR;
+
+			if(hasRelativeTarget(instr))
+				flags |= FLAG_HAS_TARGET;
+
+			return flags;
+		}
+	}
+
+	// builds the intra-procedural control flow graph of the function starting at `entry`. calls are
+	// not followed (but they do end blocks), and neither are branches that leave [lo, hi) -- those
+	// are treated as tail calls. the builder keeps its scratch space between calls, so reuse one
+	// (per thread) when building graphs for many functions.
+	struct CFGBuilder
+	{
+		ControlFlowGraph build(const CodeRegion& region, uint64_t entry)
+		{
+			return this->build(region, entry, region.base(), region.end(), RegionReader { region });
+		}
+
+		// `read` is used to get at the contents of jump tables; see jumptable.h.
+		template <typename Reader>
+		ControlFlowGraph build(const CodeRegion& region, uint64_t entry, uint64_t lo, uint64_t hi, const Reader& read)
+		{
+			lo = std::max(lo, region.base());
+			hi = std::min(hi, region.end());
+
+			this->insns.clear();
+			this->leaders.clear();
+			this->pending.clear();
+			this->switches.clear();
+			this->seen.reset(this->lastCount);
+
+			auto inside = [&](uint64_t a) -> bool { return a >= lo && a < hi; };
+
+			if(inside(entry))
+			{
+				this->pending.push_back(entry);
+				this->leaders.push_back(entry);
+			}
+
+			uint64_t lastEnd = 0;
+			while(!this->pending.empty())
+			{
+				auto addr = this->pending.back();
+				this->pending.pop_back();
+
+				// the fallthrough of a conditional branch gets popped right after the branch, so keep
+				// the history going; the bounds check for a switch usually sits just before it.
+				if(addr != lastEnd)
+					this->history.clear();
+
+				while(inside(addr) && this->seen.insert(addr))
+				{
+					auto instr = region.decode(addr);
+					auto flags = cfg::classify(instr);
+					this->history.push(addr);
+					lastEnd = addr + instr.length();
+
+					auto insn = cfg::Insn { addr, 0, (uint8_t) instr.length(), flags };
+					if(flags & cfg::FLAG_HAS_TARGET)
+						insn.target = branchTarget(instr, addr);
+
+					this->insns.push_back(insn);
+
+					if((flags & cfg::FLAG_HAS_TARGET) && !(flags & cfg::FLAG_CALL) && inside(insn.target))
+					{
+						this->leaders.push_back(insn.target);
+						this->pending.push_back(insn.target);
+					}
+
+					if(instr.op() == ops::INVALID)
+						break;
+
+					if(isJump(instr.op()) && !(flags & cfg::FLAG_HAS_TARGET))
+					{
+						auto jt = JumpTable();
+						if(resolveJumpTable(region, this->history, read, jt))
+						{
+							for(auto t : jt.targets)
+							{
+								if(!inside(t))
+									continue;
+
+								this->switches.push_back({ addr, t });
+								this->leaders.push_back(t);
+								this->pending.push_back(t);
+							}
+						}
+					}
+
+					if(flags & cfg::FLAG_TERMINATOR)
+					{
+						if(flags & cfg::FLAG_FALLTHROUGH)
+						{
+							this->leaders.push_back(addr + instr.length());
+							this->pending.push_back(addr + instr.length());
+						}
+
+						break;
+					}
+
+					addr += instr.length();
+				}
+			}
+
+			this->lastCount = this->insns.size();
+			return this->assemble(entry);
+		}
+
+	private:
+		ControlFlowGraph assemble(uint64_t entry)
+		{
+			auto ret = ControlFlowGraph();
+			if(this->insns.empty())
+				return ret;
+
+			std::sort(this->insns.begin(), this->insns.end(), [](auto& a, auto& b) { return a.addr < b.addr; });
+			std::sort(this->leaders.begin(), this->leaders.end());
+			this->leaders.erase(std::unique(this->leaders.begin(), this->leaders.end()), this->leaders.end());
+
+			std::sort(this->switches.begin(), this->switches.end());
+			this->switches.erase(std::unique(this->switches.begin(), this->switches.end()), this->switches.end());
+
+			auto isLeader = [&](uint64_t a) -> bool {
+				return std::binary_search(this->leaders.begin(), this->leaders.end(), a);
+			};
+
+			// first pass: carve the instructions into blocks. remember the last instruction of each.
+			this->blockEnds.clear();
+			for(size_t i = 0; i < this->insns.size(); i++)
+			{
+				auto& in = this->insns[i];
+				bool starts = (i == 0) || isLeader(in.addr)
+					|| (this->insns[i - 1].addr + this->insns[i - 1].length != in.addr)
+					|| (this->insns[i - 1].flags & cfg::FLAG_TERMINATOR);
+
+				if(starts)
+				{
+					ret.blockStarts.push_back(in.addr);
+					ret.blockSizes.push_back(0);
+					this->blockEnds.push_back(i);
+				}
+
+				ret.blockSizes.back() += in.length;
+				this->blockEnds.back() = i;
+			}
+
+			// the entry block isn't necessarily the first one, if the function has code at lower addresses.
+			auto entryIdx = std::lower_bound(ret.blockStarts.begin(), ret.blockStarts.end(), entry) - ret.blockStarts.begin();
+
+			auto indexOf = [&](uint64_t a) -> int64_t {
+				auto it = std::lower_bound(ret.blockStarts.begin(), ret.blockStarts.end(), a);
+				if(it == ret.blockStarts.end() || *it != a)
+					return -1;
+
+				return it - ret.blockStarts.begin();
+			};
+
+			// second pass: edges, in CSR form.
+			ret.edgeOffsets.reserve(ret.blockStarts.size() + 1);
+			for(size_t b = 0; b < ret.blockStarts.size(); b++)
+			{
+				ret.edgeOffsets.push_back(ret.edgeTargets.size());
+
+				auto& last = this->insns[this->blockEnds[b]];
+				auto next = last.addr + last.length;
+
+				auto add = [&](uint64_t target, EdgeKind kind) {
+					if(auto idx = indexOf(target); idx >= 0)
+					{
+						ret.edgeTargets.push_back(idx);
+						ret.edgeKinds.push_back(kind);
+					}
+				};
+
+				if(!(last.flags & cfg::FLAG_TERMINATOR))
+				{
+					if(last.length > 0)
+						add(next, EdgeKind::Fallthrough);
+				}
+				else
+				{
+					if((last.flags & cfg::FLAG_HAS_TARGET) && !(last.flags & cfg::FLAG_CALL))
+						add(last.target, (last.flags & cfg::FLAG_CONDITIONAL) ? EdgeKind::Branch : EdgeKind::Jump);
+
+					if(last.flags & cfg::FLAG_FALLTHROUGH)
+						add(next, (last.flags & cfg::FLAG_CALL) ? EdgeKind::CallReturn : EdgeKind::Fallthrough);
+
+					auto sw = std::lower_bound(this->switches.begin(), this->switches.end(), std::make_pair(last.addr, (uint64_t) 0));
+					for(; sw != this->switches.end() && sw->first == last.addr; ++sw)
+						add(sw->second, EdgeKind::Switch);
+				}
+			}
+
+			ret.edgeOffsets.push_back(ret.edgeTargets.size());
+			ret.entryBlock = entryIdx;
+
+			return ret;
+		}
+
+		std::vector<cfg::Insn> insns;
+		std::vector<uint64_t> leaders;
+		std::vector<uint64_t> pending;
+		std::vector<size_t> blockEnds;
+		std::vector<std::pair<uint64_t, uint64_t>> switches;    // (jump, target)
+		InstrHistory history;
+		cfg::AddressSet seen;
+		size_t lastCount = 0;
+	};
+}
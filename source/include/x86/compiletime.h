@@ -0,0 +1,93 @@
+// compiletime.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <array>
+#include <utility>
+
+#include "decode.h"
+
+namespace instrad::x86
+{
+	// decoding a constant array of bytes at compile time, eg. a hand-written stub:
+	//
+	//   constexpr uint8_t stub[] = { 0x48, 0x8b, 0x07, 0xff, 0xe0 };   // mov rax, [rdi]; jmp rax
+	//   constexpr auto instrs = instrad::x86::decode_all<stub>();
+	//   static_assert(instrs.size() == 2 && instrs[1].op() == instrad::x86::ops::JMP);
+	//
+	// the array has to have static storage duration (so it can be a template argument). every byte of it
+	// has to be part of an instruction that decodes; if not, it's a compile error.
+	namespace compiletime
+	{
+		template <size_t N>
+		constexpr Instruction decodeAt(const uint8_t (&bytes)[N], size_t ofs, ExecMode mode)
+		{
+			auto buf = Buffer(bytes + ofs, N - ofs);
+			auto ret = read(buf, mode);
+			if(buf.overrun())
+				return Instruction(ops::INVALID);
+
+			return ret;
+		}
+
+		// the number of instructions, or 0 if something doesn't decode (or runs off the end).
+		template <size_t N>
+		constexpr size_t countInstructions(const uint8_t (&bytes)[N], ExecMode mode)
+		{
+			size_t count = 0;
+			for(size_t ofs = 0; ofs < N; count++)
+			{
+				auto instr = decodeAt(bytes, ofs, mode);
+				if(instr.op() == ops::INVALID || instr.length() == 0)
+					return 0;
+
+				ofs += instr.length();
+			}
+
+			return count;
+		}
+
+		template <auto& Bytes, ExecMode Mode>
+		constexpr size_t instructionCount()
+		{
+			constexpr auto count = countInstructions(Bytes, Mode);
+			static_assert(count > 0 || sizeof(Bytes) == 0, "bytes do not decode into whole instructions");
+
+			return count;
+		}
+
+		template <auto& Bytes, ExecMode Mode, size_t... Is>
+		constexpr std::array<Instruction, sizeof...(Is)> decodeEach(const std::array<size_t, sizeof...(Is)>& offsets,
+			std::index_sequence<Is...>)
+		{
+			return { decodeAt(Bytes, offsets[Is], Mode)... };
+		}
+	}
+
+	// the offset of every instruction in Bytes.
+	template <auto& Bytes, ExecMode Mode = ExecMode::Long>
+	constexpr std::array<size_t, compiletime::instructionCount<Bytes, Mode>()> instruction_offsets()
+	{
+		auto ret = std::array<size_t, compiletime::instructionCount<Bytes, Mode>()>();
+
+		size_t ofs = 0;
+		for(size_t i = 0; i < ret.size(); i++)
+		{
+			ret[i] = ofs;
+			ofs += compiletime::decodeAt(Bytes, ofs, Mode).length();
+		}
+
+		return ret;
+	}
+
+	// every instruction in Bytes, in order; the lengths are in Instruction::length().
+	template <auto& Bytes, ExecMode Mode = ExecMode::Long>
+	constexpr std::array<Instruction, compiletime::instructionCount<Bytes, Mode>()> decode_all()
+	{
+		// Instruction can't be default-constructed, so the array has to be built in one go.
+		constexpr auto offsets = instruction_offsets<Bytes, Mode>();
+		return compiletime::decodeEach<Bytes, Mode>(offsets, std::make_index_sequence<offsets.size()>());
+	}
+}
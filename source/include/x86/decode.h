@@ -168,8 +168,8 @@ namespace instrad::x86
 		mods.modrm = ModRM(buf.pop());
 
 		// furthermore, they all have the form OP mmx, mmx/mem64
-		auto op1 = getOperand(buf, OpKind::RegMmx, mods);
-		auto op2 = getOperand(buf, OpKind::RegMmxMem64, mods);
+		auto op1 = decodeOperand<OpKind::RegMmx>(buf, mods);
+		auto op2 = decodeOperand<OpKind::RegMmxMem64>(buf, mods);
 
 		// now, we should have the opcode at our disposal.
 		auto opcode = buf.pop();
@@ -313,8 +313,22 @@ namespace instrad::x86
 				{
 					if(auto modrm = xs.peek(1); mode == ExecMode::Long || ((modrm & 0xC0) == 0xC0))
 					{
-						if(op == 0xC4) modifiers.vex = VexPrefix(xs.pop(), xs.pop());
-						if(op == 0xC5) modifiers.vex = VexPrefix(xs.pop());
+						// skip the C4/C5 itself. the order of evaluation of function arguments is
+						// unspecified, so pop the two bytes of the 3-byte form one at a time.
+						xs.pop();
+						if(op == 0xC4)
+						{
+							auto b1 = xs.pop();
+							modifiers.vex = VexPrefix(b1, xs.pop());
+						}
+						else
+						{
+							modifiers.vex = VexPrefix(xs.pop());
+						}
+
+						// the opcode comes straight after a vex prefix; it might look like a legacy
+						// prefix (eg. andn is F2), a REX, or an escape, but it isn't any of them.
+						break;
 					}
 					else
 					{
@@ -329,14 +343,14 @@ namespace instrad::x86
 		}
 
 		// next, REX prefix.
-		if(mode == ExecMode::Long && (xs.peek() & 0xF0) == 0x40)
+		if(mode == ExecMode::Long && !modifiers.vex.present() && (xs.peek() & 0xF0) == 0x40)
 			modifiers.rex = RexPrefix(xs.pop());
 
 		auto table = tables::PrimaryOpcodeMap;
 		bool is3dnow = false;
 
-		// next, check for escape
-		if(xs.match(0x0F))
+		// next, check for escape (vex has the map in it instead)
+		if(!modifiers.vex.present() && xs.match(0x0F))
 		{
 			if(xs.match(0x0F))          is3dnow = true;
 			else if(xs.match(0x38))     table = tables::SecondaryOpcodeMap_0F_38;
@@ -0,0 +1,195 @@
+// decodecache.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <string.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	struct DecodeCacheStats
+	{
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;     // misses that threw out a valid entry to make room
+		uint64_t uncached = 0;      // misses that weren't stored: truncated or invalid reads
+
+		double hitRate() const
+		{
+			auto total = this->hits + this->misses;
+			return total == 0 ? 0 : (double) this->hits / (double) total;
+		}
+	};
+
+	// a set-associative cache in front of read(), for when the same encodings get decoded over and over
+	// (plt stubs, `mov rdi, rbx`, `call rel32` into the same function from everywhere else...).
+	//
+	// the decoder only ever looks at the bytes it consumes, and nothing it produces depends on where the
+	// instruction is (relative offsets stay relative), so an instruction of length L can be reused for any
+	// input that starts with the same L bytes in the same mode. the set is picked from (up to) the first three
+	// bytes, which is usually enough to get past the rex prefix, the opcode and the modrm; more than that
+	// scatters the short instructions over too many sets. a hit compares the stored length's worth of bytes.
+	//
+	// an Instruction isn't small, and copying one out isn't free; this only pays off when the hit rate is
+	// high and the instructions are the expensive kind to decode. see the driver's --decode-cache for numbers.
+	// not thread-safe: use one per thread (threadDecodeCache() does that for you).
+	struct DecodeCache
+	{
+		static constexpr size_t WAYS = 4;
+		static constexpr size_t KEY_BYTES = 15;
+
+		// `sets` is rounded up to a power of two.
+		explicit DecodeCache(size_t sets = 1024)
+		{
+			size_t n = 1;
+			while(n < sets)
+				n *= 2;
+
+			this->m_mask = n - 1;
+			this->m_tags.resize(n * WAYS);
+			this->m_instrs.resize(n * WAYS, Instruction(ops::INVALID));
+			this->m_next.resize(n);
+		}
+
+		// the same as x86::read(), buffer position and all.
+		Instruction read(Buffer& buf, ExecMode mode)
+		{
+			uint8_t key[KEY_BYTES] = { };
+			auto avail = std::min(buf.remaining(), KEY_BYTES);
+			for(size_t i = 0; i < avail; i++)
+				key[i] = buf.peek(i);
+
+			if(auto hit = this->lookup(key, avail, mode); hit != nullptr)
+			{
+				for(size_t i = 0; i < hit->length(); i++)
+					buf.pop();
+
+				return *hit;
+			}
+
+			auto ret = x86::read(buf, mode);
+			if(buf.overrun())
+				this->m_stats.uncached++;
+			else
+				this->insert(key, avail, mode, ret);
+
+			return ret;
+		}
+
+		// the same as CodeRegion::decode().
+		Instruction decode(const CodeRegion& region, uint64_t addr)
+		{
+			auto ofs = region.offsetOf(addr);
+			auto avail = std::min(region.size() - ofs, KEY_BYTES);
+
+			if(auto hit = this->lookup(region.bytes() + ofs, avail, region.mode()); hit != nullptr)
+				return *hit;
+
+			auto buf = Buffer(region.bytes() + ofs, region.size() - ofs);
+			auto ret = x86::read(buf, region.mode());
+			if(buf.overrun())
+			{
+				this->m_stats.uncached++;
+				return Instruction(ops::INVALID);
+			}
+
+			this->insert(region.bytes() + ofs, avail, region.mode(), ret);
+			return ret;
+		}
+
+		const DecodeCacheStats& stats() const { return this->m_stats; }
+		void resetStats() { this->m_stats = DecodeCacheStats(); }
+
+		void clear()
+		{
+			std::fill(this->m_tags.begin(), this->m_tags.end(), Tag());
+			std::fill(this->m_next.begin(), this->m_next.end(), 0);
+		}
+
+	private:
+		struct Tag
+		{
+			uint8_t bytes[KEY_BYTES] = { };
+			uint8_t length = 0;         // 0 means the way is empty
+			ExecMode mode = ExecMode::Long;
+		};
+
+		size_t setOf(const uint8_t* bytes, size_t avail, ExecMode mode) const
+		{
+			uint32_t h = (uint32_t) mode;
+			for(size_t i = 0; i < std::min(avail, (size_t) 3); i++)
+				h = (h << 8) ^ bytes[i];
+
+			return ((h * 0x9E3779B1u) >> 12) & this->m_mask;
+		}
+
+		const Instruction* lookup(const uint8_t* bytes, size_t avail, ExecMode mode)
+		{
+			if(avail == 0)
+				return nullptr;
+
+			auto set = this->setOf(bytes, avail, mode) * WAYS;
+			for(size_t w = set; w < set + WAYS; w++)
+			{
+				auto& tag = this->m_tags[w];
+				if(tag.length != 0 && tag.length <= avail && tag.mode == mode
+					&& memcmp(tag.bytes, bytes, tag.length) == 0)
+				{
+					this->m_stats.hits++;
+					return &this->m_instrs[w];
+				}
+			}
+
+			this->m_stats.misses++;
+			return nullptr;
+		}
+
+		// only called after a lookup of the same bytes missed; `avail` has to be the same as it was there,
+		// so that the instruction goes in the set it'll be looked for in.
+		void insert(const uint8_t* bytes, size_t avail, ExecMode mode, const Instruction& instr)
+		{
+			// the decoder can give up on a group opcode after peeking at a modrm that it never consumed,
+			// so an invalid result depends on more than its length's worth of bytes; those don't go in.
+			auto len = instr.length();
+			if(instr.op() == ops::INVALID || len == 0 || len > KEY_BYTES)
+			{
+				this->m_stats.uncached++;
+				return;
+			}
+
+			auto set = this->setOf(bytes, avail, mode);
+			auto w = (set * WAYS) + this->m_next[set];
+			this->m_next[set] = (this->m_next[set] + 1) % WAYS;
+
+			auto& tag = this->m_tags[w];
+			if(tag.length != 0)
+				this->m_stats.evictions++;
+
+			memcpy(tag.bytes, bytes, len);
+			tag.length = (uint8_t) len;
+			tag.mode = mode;
+
+			this->m_instrs[w] = instr;
+		}
+
+		size_t m_mask = 0;
+		std::vector<Tag> m_tags;
+		std::vector<Instruction> m_instrs;
+		std::vector<uint8_t> m_next;    // round-robin victim, per set
+
+		DecodeCacheStats m_stats;
+	};
+
+	// one cache per thread, created on first use.
+	inline DecodeCache& threadDecodeCache()
+	{
+		static thread_local DecodeCache cache;
+		return cache;
+	}
+}
@@ -0,0 +1,316 @@
+// descent.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include "flow.h"
+#include "jumptable.h"
+
+namespace instrad::x86
+{
+	// one bit per byte of code, shared between worker threads. we only ever set bits,
+	// so a fetch_or tells us (atomically) whether somebody else got there first.
+	struct AtomicBitmap
+	{
+		AtomicBitmap(size_t bits) : m_words((bits + 63) / 64) { }
+
+		// returns true if the bit was previously clear, ie. we were the one to set it.
+		bool claim(size_t i)
+		{
+			auto mask = (uint64_t) 1 << (i % 64);
+			return (this->m_words[i / 64].fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+		}
+
+		bool test(size_t i) const
+		{
+			return this->m_words[i / 64].load(std::memory_order_relaxed) & ((uint64_t) 1 << (i % 64));
+		}
+
+		std::vector<uint64_t> snapshot() const
+		{
+			auto ret = std::vector<uint64_t>(this->m_words.size());
+			for(size_t i = 0; i < ret.size(); i++)
+				ret[i] = this->m_words[i].load(std::memory_order_relaxed);
+
+			return ret;
+		}
+
+	private:
+		std::vector<std::atomic<uint64_t>> m_words;
+	};
+
+	struct Disassembly
+	{
+		CodeRegion region;
+
+		// bit N is set if an instruction starts at region.base() + N.
+		std::vector<uint64_t> starts;
+
+		// sorted and unique; all the direct call targets that landed inside the region.
+		std::vector<uint64_t> calls;
+
+		// sorted by the address of the jump.
+		std::vector<JumpTable> jumpTables;
+
+		size_t instructionCount = 0;
+
+		bool isInstructionStart(uint64_t addr) const
+		{
+			if(!this->region.contains(addr))
+				return false;
+
+			auto ofs = this->region.offsetOf(addr);
+			return this->starts[ofs / 64] & ((uint64_t) 1 << (ofs % 64));
+		}
+
+		// calls fn(addr, instr) for every discovered instruction, in address order.
+		template <typename Fn>
+		void forEach(Fn&& fn) const
+		{
+			for(size_t w = 0; w < this->starts.size(); w++)
+			{
+				for(auto bits = this->starts[w]; bits != 0; bits &= (bits - 1))
+				{
+					auto addr = this->region.base() + (w * 64) + __builtin_ctzll(bits);
+					fn(addr, this->region.decode(addr));
+				}
+			}
+		}
+	};
+
+	namespace descent
+	{
+		// below this many pending entry points, it's not worth waking up any threads.
+		constexpr size_t MIN_PARALLEL_FRONTIER = 64;
+
+		struct State
+		{
+			State(const CodeRegion& r) : region(r), visited(r.size()), queued(r.size()) { }
+
+			const CodeRegion& region;
+			AtomicBitmap visited;
+			AtomicBitmap queued;
+		};
+
+		struct Worker
+		{
+			std::vector<uint64_t> next;
+			std::vector<uint64_t> calls;
+			std::vector<JumpTable> tables;
+			InstrHistory history;
+			size_t count = 0;
+		};
+
+		// hands each round to the (long-lived) helper threads, and waits until all of them are done with it.
+		struct Rounds
+		{
+			// called by the helpers; returns false when there are no more rounds.
+			bool wait(size_t& seen)
+			{
+				auto lk = std::unique_lock<std::mutex>(this->m_lock);
+				this->m_wake.wait(lk, [&]() { return this->m_quit || this->m_round != seen; });
+
+				seen = this->m_round;
+				return !this->m_quit;
+			}
+
+			void finished()
+			{
+				auto lk = std::unique_lock<std::mutex>(this->m_lock);
+				if(--this->m_busy == 0)
+					this->m_done.notify_one();
+			}
+
+			void start(size_t helpers)
+			{
+				{
+					auto lk = std::unique_lock<std::mutex>(this->m_lock);
+					this->m_busy = helpers;
+					this->m_round++;
+				}
+				this->m_wake.notify_all();
+			}
+
+			void join()
+			{
+				auto lk = std::unique_lock<std::mutex>(this->m_lock);
+				this->m_done.wait(lk, [&]() { return this->m_busy == 0; });
+			}
+
+			void stop()
+			{
+				{
+					auto lk = std::unique_lock<std::mutex>(this->m_lock);
+					this->m_quit = true;
+				}
+				this->m_wake.notify_all();
+			}
+
+		private:
+			std::mutex m_lock;
+			std::condition_variable m_wake;
+			std::condition_variable m_done;
+
+			size_t m_round = 0;
+			size_t m_busy = 0;
+			bool m_quit = false;
+		};
+
+		inline void enqueue(State& st, Worker& wk, uint64_t target)
+		{
+			if(st.region.contains(target) && st.queued.claim(st.region.offsetOf(target)))
+				wk.next.push_back(target);
+		}
+
+		// decode linearly from `addr` until we hit something that doesn't fall through,
+		// or an instruction that some other path (or thread) already decoded.
+		template <typename Reader>
+		void walk(State& st, Worker& wk, uint64_t addr, const Reader& read)
+		{
+			auto& region = st.region;
+			wk.history.clear();
+
+			while(region.contains(addr))
+			{
+				auto instr = region.decode(addr);
+				if(instr.op() == ops::INVALID)
+					break;
+
+				if(!st.visited.claim(region.offsetOf(addr)))
+					break;
+
+				wk.count++;
+				wk.history.push(addr);
+
+				if(hasRelativeTarget(instr))
+				{
+					auto target = branchTarget(instr, addr);
+					if(isCall(instr.op()) && region.contains(target))
+						wk.calls.push_back(target);
+
+					enqueue(st, wk, target);
+				}
+				else if(isJump(instr.op()) && !instr.dst().isFarOffset())
+				{
+					auto jt = JumpTable();
+					if(resolveJumpTable(region, wk.history, read, jt))
+					{
+						for(auto t : jt.targets)
+							enqueue(st, wk, t);
+
+						wk.tables.push_back(std::move(jt));
+					}
+				}
+
+				if(isFlowTerminator(instr.op()))
+					break;
+
+				addr += instr.length();
+			}
+		}
+	}
+
+	// recursive-descent disassembly: starting from the given entry points, follow every direct
+	// jump, branch, call and loop, and record where the instructions start. indirect jumps are
+	// followed if they look like a switch table (see jumptable.h); `read` is used to get at the
+	// table, which usually lives in some other section. the work is done in rounds; each round,
+	// the current set of pending targets is shared between `threads` workers (0 = one per core),
+	// who pull from it with an atomic index. the threads stay around between rounds.
+	template <typename Reader>
+	Disassembly recursiveDescent(const CodeRegion& region, const std::vector<uint64_t>& entries,
+		size_t threads, const Reader& read)
+	{
+		if(threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		auto st = descent::State(region);
+		auto workers = std::vector<descent::Worker>(threads);
+
+		auto frontier = std::vector<uint64_t>();
+		for(auto e : entries)
+			descent::enqueue(st, workers[0], e);
+
+		frontier.swap(workers[0].next);
+
+		auto cursor = std::atomic<size_t>(0);
+		auto run = [&](descent::Worker& wk) {
+			size_t i = 0;
+			while((i = cursor.fetch_add(1, std::memory_order_relaxed)) < frontier.size())
+				descent::walk(st, wk, frontier[i], read);
+		};
+
+		// the helpers are only started once, the first time a round is big enough to need them.
+		auto rounds = descent::Rounds();
+		auto pool = std::vector<std::thread>();
+
+		while(!frontier.empty())
+		{
+			cursor.store(0, std::memory_order_relaxed);
+			if(threads == 1 || frontier.size() < descent::MIN_PARALLEL_FRONTIER)
+			{
+				run(workers[0]);
+			}
+			else
+			{
+				for(size_t t = pool.size() + 1; t < threads; t++)
+				{
+					pool.emplace_back([&](size_t t) {
+						size_t seen = 0;
+						while(rounds.wait(seen))
+						{
+							run(workers[t]);
+							rounds.finished();
+						}
+					}, t);
+				}
+
+				rounds.start(pool.size());
+				run(workers[0]);
+				rounds.join();
+			}
+
+			frontier.clear();
+			for(auto& wk : workers)
+			{
+				frontier.insert(frontier.end(), wk.next.begin(), wk.next.end());
+				wk.next.clear();
+			}
+		}
+
+		rounds.stop();
+		for(auto& t : pool)
+			t.join();
+
+		auto ret = Disassembly();
+		ret.region = region;
+		ret.starts = st.visited.snapshot();
+
+		for(auto& wk : workers)
+		{
+			ret.instructionCount += wk.count;
+			ret.calls.insert(ret.calls.end(), wk.calls.begin(), wk.calls.end());
+			std::move(wk.tables.begin(), wk.tables.end(), std::back_inserter(ret.jumpTables));
+		}
+
+		std::sort(ret.calls.begin(), ret.calls.end());
+		ret.calls.erase(std::unique(ret.calls.begin(), ret.calls.end()), ret.calls.end());
+
+		std::sort(ret.jumpTables.begin(), ret.jumpTables.end(), [](auto& a, auto& b) { return a.jump < b.jump; });
+
+		return ret;
+	}
+
+	inline Disassembly recursiveDescent(const CodeRegion& region, const std::vector<uint64_t>& entries, size_t threads = 0)
+	{
+		return recursiveDescent(region, entries, threads, RegionReader { region });
+	}
+}
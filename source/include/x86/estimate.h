@@ -0,0 +1,425 @@
+// estimate.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <string.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "semantics.h"
+
+namespace instrad::x86
+{
+	// a (very) rough static estimate of how fast a basic block runs in a loop, in the spirit of
+	// llvm-mca. every instruction is put into a class (simple alu, shift, multiply, fp add, etc.),
+	// and each microarchitecture profile gives each class a latency, a reciprocal throughput and
+	// a set of ports. memory operands add a load (and stores a store) on top of that.
+	//
+	// the estimate is the largest of three bounds: the busiest port, the longest loop-carried
+	// dependency chain through registers and flags, and the front-end's issue width. dependencies
+	// through memory, macro-fusion, move elimination and the like are not modelled.
+	enum class TimingClass : uint8_t
+	{
+		Alu, Shift, Mul, Div, Lea, Branch, Nop,
+		VecAlu, VecShuffle, VecMul, FpAdd, FpMul, Fma, FpDiv, FpSqrt, Convert, VecMove,
+		Complex,
+
+		Count_
+	};
+
+	constexpr size_t NUM_TIMING_CLASSES = (size_t) TimingClass::Count_;
+
+	struct ClassTiming
+	{
+		uint16_t latency;
+		double rthroughput;     // cycles between two independent instructions of this class
+		uint16_t ports;         // bitmask
+	};
+
+	struct Microarch
+	{
+		static constexpr size_t MAX_PORTS = 16;
+
+		const char* name;
+		size_t numPorts;
+		const char* portNames[MAX_PORTS];
+
+		size_t issueWidth;      // uops per cycle
+
+		uint16_t loadLatency;
+		uint16_t loadPorts;
+		double loadThroughput;
+		uint16_t storePorts;
+		double storeThroughput;
+
+		ClassTiming classes[NUM_TIMING_CLASSES];
+
+		constexpr const ClassTiming& timing(TimingClass c) const { return this->classes[(size_t) c]; }
+	};
+
+	namespace uarch
+	{
+		// intel skylake (client); ports 0-7.
+		constexpr auto Skylake = Microarch {
+			"skylake", 8, { "p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7" }, 4,
+			5, 0x0C, 0.5, 0x10, 1,
+			{
+				{ 1,  0.25, 0x63 },     // Alu          p0156
+				{ 1,  0.5,  0x41 },     // Shift        p06
+				{ 3,  1,    0x02 },     // Mul          p1
+				{ 26, 6,    0x01 },     // Div          p0
+				{ 1,  0.5,  0x22 },     // Lea          p15
+				{ 1,  0.5,  0x41 },     // Branch       p06
+				{ 0,  0,    0x00 },     // Nop
+				{ 1,  0.33, 0x23 },     // VecAlu       p015
+				{ 1,  1,    0x20 },     // VecShuffle   p5
+				{ 5,  0.5,  0x03 },     // VecMul       p01
+				{ 4,  0.5,  0x03 },     // FpAdd        p01
+				{ 4,  0.5,  0x03 },     // FpMul        p01
+				{ 4,  0.5,  0x03 },     // Fma          p01
+				{ 11, 4,    0x01 },     // FpDiv        p0
+				{ 12, 4,    0x01 },     // FpSqrt       p0
+				{ 4,  1,    0x03 },     // Convert      p01
+				{ 1,  0.33, 0x23 },     // VecMove      p015
+				{ 20, 20,   0x63 },     // Complex      microcoded
+			}
+		};
+
+		// amd zen 2; four integer alus, three agus and four fp pipes.
+		constexpr auto Zen2 = Microarch {
+			"zen2", 11, { "alu0", "alu1", "alu2", "alu3", "agu0", "agu1", "agu2", "fp0", "fp1", "fp2", "fp3" }, 5,
+			4, 0x70, 0.5, 0x70, 1,
+			{
+				{ 1,  0.25, 0x00F },    // Alu          alu0-3
+				{ 1,  0.5,  0x006 },    // Shift        alu1, alu2
+				{ 3,  1,    0x002 },    // Mul          alu1
+				{ 20, 14,   0x004 },    // Div          alu2
+				{ 1,  0.25, 0x00F },    // Lea          alu0-3
+				{ 1,  0.5,  0x009 },    // Branch       alu0, alu3
+				{ 0,  0,    0x000 },    // Nop
+				{ 1,  0.25, 0x780 },    // VecAlu       fp0-3
+				{ 1,  0.5,  0x300 },    // VecShuffle   fp1, fp2
+				{ 3,  1,    0x080 },    // VecMul       fp0
+				{ 3,  0.5,  0x600 },    // FpAdd        fp2, fp3
+				{ 3,  0.5,  0x180 },    // FpMul        fp0, fp1
+				{ 5,  0.5,  0x180 },    // Fma          fp0, fp1
+				{ 10, 3.5,  0x400 },    // FpDiv        fp3
+				{ 14, 5,    0x400 },    // FpSqrt       fp3
+				{ 4,  1,    0x400 },    // Convert      fp3
+				{ 1,  0.25, 0x780 },    // VecMove      fp0-3
+				{ 20, 20,   0x00F },    // Complex      microcoded
+			}
+		};
+
+		constexpr const Microarch* All[] = { &Skylake, &Zen2 };
+
+		inline const Microarch* find(const char* name)
+		{
+			for(auto u : All)
+			{
+				if(strcmp(u->name, name) == 0)
+					return u;
+			}
+
+			return nullptr;
+		}
+	}
+
+	namespace timing
+	{
+		// 0xFF = not in the table; the class is then guessed from the operands.
+		constexpr uint8_t UNKNOWN = 0xFF;
+
+		struct Table
+		{
+			uint8_t cls[semantics::TABLE_SIZE] = { };
+		};
+
+		constexpr Table makeTable()
+		{
+			auto ret = Table();
+			for(auto& c : ret.cls)
+				c = UNKNOWN;
+
+			auto set = [&ret](std::initializer_list<Op> ops, TimingClass c) {
+				for(auto& op : ops)
+					ret.cls[op.id()] = (uint8_t) c;
+			};
+
+			set({ ops::SHL, ops::SAL, ops::SHR, ops::SAR, ops::ROL, ops::ROR, ops::RCL, ops::RCR, ops::SHLD, ops::SHRD,
+				ops::BT, ops::BTS, ops::BTR, ops::BTC }, TimingClass::Shift);
+
+			set({ ops::IMUL, ops::MUL, ops::POPCNT, ops::LZCNT, ops::TZCNT, ops::BSF, ops::BSR, ops::CRC32 }, TimingClass::Mul);
+			set({ ops::DIV, ops::IDIV }, TimingClass::Div);
+			set({ ops::LEA }, TimingClass::Lea);
+
+			set({ ops::JMP, ops::CALL, ops::RET, ops::JO, ops::JNO, ops::JB, ops::JNB, ops::JBO, ops::JZ, ops::JNZ, ops::JA, ops::JNA,
+				ops::JS, ops::JNS, ops::JP, ops::JNP, ops::JL, ops::JGE, ops::JLE, ops::JG, ops::JCXZ, ops::LOOP, ops::LOOPZ,
+				ops::LOOPNZ }, TimingClass::Branch);
+
+			set({ ops::NOP, ops::PAUSE, ops::LFENCE, ops::SFENCE, ops::PREFETCH }, TimingClass::Nop);
+
+			// the vex forms (128- or 256-bit) cost the same as their legacy ones on both profiles, so they
+			// go in the same classes.
+			set({ ops::PSHUFB, ops::PSHUFD, ops::PSHUFHW, ops::PSHUFLW, ops::SHUFPS, ops::SHUFPD, ops::UNPCKLPS, ops::UNPCKHPS,
+				ops::UNPCKLPD, ops::UNPCKHPD, ops::PUNPCKLBW, ops::PUNPCKLWD, ops::PUNPCKLDQ, ops::PUNPCKLQDQ, ops::PUNPCKHBW,
+				ops::PUNPCKHWD, ops::PUNPCKHDQ, ops::PUNPCKHQDQ, ops::PACKSSWB, ops::PACKSSDW, ops::PACKUSWB, ops::PACKUSDW,
+				ops::PALIGNR, ops::PSLLDQ, ops::PSRLDQ, ops::INSERTPS, ops::PINSRB, ops::PINSRW, ops::PINSRD, ops::PINSRQ,
+				ops::PEXTRB, ops::PEXTRW, ops::PEXTRD, ops::EXTRACTPS, ops::MOVHLPS, ops::MOVLHPS, ops::PMOVSXBW, ops::PMOVSXBD,
+				ops::PMOVSXBQ, ops::PMOVSXWD, ops::PMOVSXWQ, ops::PMOVSXDQ, ops::PMOVZXBW, ops::PMOVZXBD, ops::PMOVZXBQ,
+				ops::PMOVZXWD, ops::PMOVZXWQ, ops::PMOVZXDQ }, TimingClass::VecShuffle);
+
+			set({ ops::VPSHUFB, ops::VPSHUFD, ops::VPSHUFHW, ops::VPSHUFLW, ops::VSHUFPS, ops::VSHUFPD, ops::VUNPCKLPS,
+				ops::VUNPCKHPS, ops::VUNPCKLPD, ops::VUNPCKHPD, ops::VPUNPCKLBW, ops::VPUNPCKLWD, ops::VPUNPCKLDQ,
+				ops::VPUNPCKLQDQ, ops::VPUNPCKHBW, ops::VPUNPCKHWD, ops::VPUNPCKHDQ, ops::VPUNPCKHQDQ, ops::VPACKSSWB,
+				ops::VPACKSSDW, ops::VPACKUSWB, ops::VPACKUSDW, ops::VPALIGNR, ops::VPSLLDQ, ops::VPSRLDQ, ops::VINSERTPS,
+				ops::VPINSRB, ops::VPINSRW, ops::VPINSRD, ops::VPINSRQ, ops::VPEXTRB, ops::VPEXTRW, ops::VPEXTRD, ops::VPEXTRQ,
+				ops::VEXTRACTPS, ops::VMOVHLPS, ops::VMOVLHPS, ops::VPMOVSXBW, ops::VPMOVSXBD, ops::VPMOVSXBQ, ops::VPMOVSXWD,
+				ops::VPMOVSXWQ, ops::VPMOVSXDQ, ops::VPMOVZXBW, ops::VPMOVZXBD, ops::VPMOVZXBQ, ops::VPMOVZXWD, ops::VPMOVZXWQ,
+				ops::VPMOVZXDQ, ops::VPERMILPS, ops::VPERMILPD, ops::VPERMPS, ops::VPERMPD, ops::VPERMD, ops::VPERMQ,
+				ops::VPERM2F128, ops::VPERM2I128, ops::VINSERTF128, ops::VINSERTI128, ops::VEXTRACTF128, ops::VEXTRACTI128,
+				ops::VBROADCASTSS, ops::VBROADCASTSD, ops::VBROADCASTF128, ops::VPBROADCASTB, ops::VPBROADCASTW,
+				ops::VPBROADCASTD, ops::VPBROADCASTI128 }, TimingClass::VecShuffle);
+
+			set({ ops::PMULLW, ops::PMULLD, ops::PMULHW, ops::PMULHUW, ops::PMULUDQ, ops::PMULDQ, ops::PMADDWD, ops::PMADDUBSW,
+				ops::PMULHRSW, ops::PSADBW, ops::MPSADBW, ops::PCLMULQDQ, ops::AESENC, ops::AESENCLAST, ops::AESDEC,
+				ops::AESDECLAST }, TimingClass::VecMul);
+
+			set({ ops::VPMULLW, ops::VPMULLD, ops::VPMULHW, ops::VPMULHUW, ops::VPMULUDQ, ops::VPMULDQ, ops::VPMADDWD,
+				ops::VPMADDUBSW, ops::VPMULHRSW, ops::VPSADBW, ops::VMPSADBW, ops::VPCLMULQDQ, ops::VAESENC, ops::VAESENCLAST,
+				ops::VAESDEC, ops::VAESDECLAST }, TimingClass::VecMul);
+
+			set({ ops::ADDPS, ops::ADDPD, ops::ADDSS, ops::ADDSD, ops::SUBPS, ops::SUBPD, ops::SUBSS, ops::SUBSD, ops::ADDSUBPS,
+				ops::ADDSUBPD, ops::HADDPS, ops::HADDPD, ops::HSUBPS, ops::HSUBPD, ops::MINPS, ops::MINPD, ops::MINSS, ops::MINSD,
+				ops::MAXPS, ops::MAXPD, ops::MAXSS, ops::MAXSD, ops::CMPPS, ops::CMPPD, ops::CMPSS, ops::UCOMISS, ops::UCOMISD,
+				ops::COMISS, ops::COMISD, ops::ROUNDPS, ops::ROUNDPD, ops::ROUNDSS, ops::ROUNDSD }, TimingClass::FpAdd);
+
+			set({ ops::VADDPS, ops::VADDPD, ops::VADDSS, ops::VADDSD, ops::VSUBPS, ops::VSUBPD, ops::VSUBSS, ops::VSUBSD,
+				ops::VADDSUBPS, ops::VADDSUBPD, ops::VHADDPS, ops::VHADDPD, ops::VHSUBPS, ops::VHSUBPD, ops::VMINPS, ops::VMINPD,
+				ops::VMINSS, ops::VMINSD, ops::VMAXPS, ops::VMAXPD, ops::VMAXSS, ops::VMAXSD, ops::VCMPPS, ops::VCMPPD,
+				ops::VCMPSS, ops::VUCOMISS, ops::VUCOMISD, ops::VCOMISS, ops::VCOMISD, ops::VROUNDPS, ops::VROUNDPD,
+				ops::VROUNDSS, ops::VROUNDSD }, TimingClass::FpAdd);
+
+			set({ ops::MULPS, ops::MULPD, ops::MULSS, ops::MULSD, ops::DPPS, ops::DPPD }, TimingClass::FpMul);
+			set({ ops::VMULPS, ops::VMULPD, ops::VMULSS, ops::VMULSD, ops::VDPPS, ops::VDPPD }, TimingClass::FpMul);
+
+			// only fma3; neither profile has fma4, so those ops are left to the fallback.
+			set({ ops::VFMADD132PS, ops::VFMADD132PD, ops::VFMADD132SS, ops::VFMADD132SD, ops::VFMADD213PS, ops::VFMADD213PD,
+				ops::VFMADD213SS, ops::VFMADD213SD, ops::VFMADD231PS, ops::VFMADD231PD, ops::VFMADD231SS, ops::VFMADD231SD,
+				ops::VFMSUB132PS, ops::VFMSUB132PD, ops::VFMSUB132SS, ops::VFMSUB132SD, ops::VFMSUB213PS, ops::VFMSUB213PD,
+				ops::VFMSUB213SS, ops::VFMSUB213SD, ops::VFMSUB231PS, ops::VFMSUB231PD, ops::VFMSUB231SS, ops::VFMSUB231SD,
+				ops::VFNMADD132PS, ops::VFNMADD132PD, ops::VFNMADD132SS, ops::VFNMADD132SD, ops::VFNMADD213PS,
+				ops::VFNMADD213PD, ops::VFNMADD213SS, ops::VFNMADD213SD, ops::VFNMADD231PS, ops::VFNMADD231PD,
+				ops::VFNMADD231SS, ops::VFNMADD231SD, ops::VFNMSUB132PS, ops::VFNMSUB132PD, ops::VFNMSUB132SS,
+				ops::VFNMSUB132SD, ops::VFNMSUB213PS, ops::VFNMSUB213PD, ops::VFNMSUB213SS, ops::VFNMSUB213SD,
+				ops::VFNMSUB231PS, ops::VFNMSUB231PD, ops::VFNMSUB231SS, ops::VFNMSUB231SD, ops::VFMADDSUB132PS,
+				ops::VFMADDSUB132PD, ops::VFMADDSUB213PS, ops::VFMADDSUB213PD, ops::VFMADDSUB231PS, ops::VFMADDSUB231PD,
+				ops::VFMSUBADD132PS, ops::VFMSUBADD132PD, ops::VFMSUBADD213PS, ops::VFMSUBADD213PD, ops::VFMSUBADD231PS,
+				ops::VFMSUBADD231PD }, TimingClass::Fma);
+
+			set({ ops::DIVPS, ops::DIVPD, ops::DIVSS, ops::DIVSD, ops::RCPPS, ops::RCPSS, ops::RSQRTPS, ops::RSQRTSS }, TimingClass::FpDiv);
+			set({ ops::VDIVPS, ops::VDIVPD, ops::VDIVSS, ops::VDIVSD, ops::VRCPPS, ops::VRCPSS, ops::VRSQRTPS, ops::VRSQRTSS },
+				TimingClass::FpDiv);
+
+			set({ ops::SQRTPS, ops::SQRTPD, ops::SQRTSS, ops::SQRTSD }, TimingClass::FpSqrt);
+			set({ ops::VSQRTPS, ops::VSQRTPD, ops::VSQRTSS, ops::VSQRTSD }, TimingClass::FpSqrt);
+
+			set({ ops::CVTDQ2PS, ops::CVTDQ2PD, ops::CVTTPD2DQ, ops::CVTPD2DQ, ops::CVTPS2PD, ops::CVTPD2PS, ops::CVTPS2DQ,
+				ops::CVTTPS2DQ, ops::CVTSI2SS, ops::CVTSI2SD, ops::CVTTSS2SI, ops::CVTSS2SI, ops::CVTTSD2SI, ops::CVTSD2SI,
+				ops::CVTSS2SD, ops::CVTSD2SS }, TimingClass::Convert);
+
+			set({ ops::VCVTDQ2PS, ops::VCVTDQ2PD, ops::VCVTTPD2DQ, ops::VCVTPD2DQ, ops::VCVTPS2PD, ops::VCVTPD2PS,
+				ops::VCVTPS2DQ, ops::VCVTTPS2DQ, ops::VCVTSI2SS, ops::VCVTSI2SD, ops::VCVTTSS2SI, ops::VCVTSS2SI,
+				ops::VCVTTSD2SI, ops::VCVTSD2SI, ops::VCVTSS2SD, ops::VCVTSD2SS, ops::VCVTPH2PS, ops::VCVTPS2PH },
+				TimingClass::Convert);
+
+			set({ ops::MOVAPS, ops::MOVAPD, ops::MOVUPS, ops::MOVUPD, ops::MOVDQA, ops::MOVDQU, ops::LDDQU, ops::MOVD, ops::MOVQ,
+				ops::MOVSS, ops::MOVNTPS, ops::MOVNTPD, ops::MOVNTDQ, ops::MOVNTDQA }, TimingClass::VecMove);
+
+			set({ ops::VMOVAPS, ops::VMOVAPD, ops::VMOVUPS, ops::VMOVUPD, ops::VMOVDQA, ops::VMOVDQU, ops::VLDDQU, ops::VMOVD,
+				ops::VMOVQ, ops::VMOVSS, ops::VMOVSD, ops::VMOVNTPS, ops::VMOVNTPD, ops::VMOVNTDQ, ops::VMOVNTDQA },
+				TimingClass::VecMove);
+
+			set({ ops::CPUID, ops::RDTSC, ops::RDTSCP, ops::RDRAND, ops::RDSEED, ops::XGETBV, ops::SYSCALL, ops::INT, ops::CMPXCHG,
+				ops::CMPXCHG8B, ops::CMPXCHG16B, ops::XCHG, ops::ENTER, ops::PUSHF, ops::POPF, ops::MFENCE }, TimingClass::Complex);
+
+			return ret;
+		}
+
+		constexpr auto ClassTable = makeTable();
+
+		constexpr bool isVector(const Register& r) { return r.present() && (r.index() & regs::REG_FLAG_SSE); }
+
+		constexpr TimingClass classify(const Instruction& instr)
+		{
+			auto id = instr.op().id();
+			if(id < semantics::TABLE_SIZE && ClassTable.cls[id] != UNKNOWN)
+			{
+				// xchg reg, reg is cheap; it's only the memory form that locks.
+				if(instr.op() == ops::XCHG && !instr.dst().isMemory() && !instr.src().isMemory())
+					return TimingClass::Alu;
+
+				return (TimingClass) ClassTable.cls[id];
+			}
+
+			for(int i = 0; i < instr.operandCount() && i < 4; i++)
+			{
+				auto& op = operandAt(instr, i);
+				if(op.isRegister() && isVector(op.reg()))
+					return TimingClass::VecAlu;
+			}
+
+			return TimingClass::Alu;
+		}
+
+		// regmask:: has room up here; the flags are treated as one more register.
+		constexpr uint64_t FLAGS_BIT = (uint64_t) 1 << 63;
+	}
+
+	struct BlockEstimate
+	{
+		double cyclesPerIteration = 0;
+
+		double portBound = 0;
+		double latencyBound = 0;
+		double frontendBound = 0;
+
+		// "port", "dependency" or "frontend"; if it's a port, which one.
+		const char* bottleneck = "";
+		int bottleneckPort = -1;
+
+		size_t uops = 0;
+		double portPressure[Microarch::MAX_PORTS] = { };    // cycles per iteration
+	};
+
+	// estimates the steady-state cost of running `instrs` back to back (as the body of a loop).
+	inline BlockEstimate estimateBlock(const Microarch& arch, const std::vector<Instruction>& instrs, size_t iterations = 32)
+	{
+		auto ret = BlockEstimate();
+		if(instrs.empty())
+			return ret;
+
+		// first, the ports. like llvm-mca, each uop is spread evenly over the ports it can use; with
+		// n ports and a reciprocal throughput of 1/n, that's one cycle's worth of work in total.
+		auto issue = [&](uint16_t ports, double rthroughput) {
+			ret.uops++;
+			for(size_t p = 0; p < arch.numPorts; p++)
+			{
+				if(ports & (1 << p))
+					ret.portPressure[p] += rthroughput;
+			}
+		};
+
+		auto loads = std::vector<bool>(instrs.size());
+		for(size_t i = 0; i < instrs.size(); i++)
+		{
+			auto& instr = instrs[i];
+			auto& t = arch.timing(timing::classify(instr));
+
+			bool load = false;
+			bool store = false;
+			for(int k = 0; k < instr.operandCount() && k < 4; k++)
+			{
+				if(!operandAt(instr, k).isMemory() || instr.op() == ops::LEA)
+					continue;
+
+				auto acc = operandAccess(instr, k);
+				load |= (acc & access::READ) != 0;
+				store |= (acc & access::WRITE) != 0;
+			}
+
+			// push and pop (and call and ret) touch the stack without a memory operand.
+			if(instr.op() == ops::PUSH || instr.op() == ops::CALL)   store = true;
+			if(instr.op() == ops::POP || instr.op() == ops::RET)     load = true;
+
+			loads[i] = load;
+
+			// a plain load or store doesn't need an alu.
+			bool pureMove = (instr.op() == ops::MOV || instr.op() == ops::PUSH || instr.op() == ops::POP
+				|| timing::classify(instr) == TimingClass::VecMove) && (load || store);
+
+			if(!pureMove)
+				issue(t.ports, t.rthroughput);
+
+			if(load)    issue(arch.loadPorts, arch.loadThroughput);
+			if(store)   issue(arch.storePorts, arch.storeThroughput);
+		}
+
+		for(size_t p = 0; p < arch.numPorts; p++)
+		{
+			if(ret.portPressure[p] > ret.portBound)
+			{
+				ret.portBound = ret.portPressure[p];
+				ret.bottleneckPort = (int) p;
+			}
+		}
+
+		ret.frontendBound = (double) ret.uops / arch.issueWidth;
+
+		// then, the dependency chains. run the block a few times, keeping track of when each register
+		// becomes ready; the steady-state growth per iteration is the loop-carried latency.
+		uint64_t ready[64] = { };
+		uint64_t half = 0;
+		uint64_t last = 0;
+
+		for(size_t it = 0; it < iterations; it++)
+		{
+			for(size_t i = 0; i < instrs.size(); i++)
+			{
+				auto& instr = instrs[i];
+				auto use = registerUse(instr);
+				auto reads = use.reads | (use.flagsRead ? timing::FLAGS_BIT : 0);
+				auto writes = use.writes | (use.flagsWritten ? timing::FLAGS_BIT : 0);
+
+				// a load only waits for its address; the operation waits for the loaded value and the
+				// other inputs, so the load latency is only on the path through the address registers.
+				uint64_t addrRegs = 0;
+				for(int k = 0; k < instr.operandCount() && k < 4; k++)
+				{
+					if(auto& op = operandAt(instr, k); op.isMemory())
+						addrRegs |= regmask::of(op.mem().base()) | regmask::of(op.mem().index());
+				}
+
+				uint64_t start = 0;
+				for(auto r = reads; r != 0; r &= (r - 1))
+				{
+					auto bit = (uint64_t) 1 << __builtin_ctzll(r);
+					auto extra = (loads[i] && (addrRegs & bit)) ? arch.loadLatency : 0;
+					start = std::max(start, ready[__builtin_ctzll(r)] + extra);
+				}
+
+				auto done = start + arch.timing(timing::classify(instr)).latency;
+				for(auto w = writes; w != 0; w &= (w - 1))
+					ready[__builtin_ctzll(w)] = done;
+
+				last = std::max(last, done);
+			}
+
+			if(it + 1 == iterations / 2)
+				half = last;
+		}
+
+		ret.latencyBound = (double) (last - half) / (iterations - iterations / 2);
+
+		ret.cyclesPerIteration = std::max({ ret.portBound, ret.latencyBound, ret.frontendBound });
+		if(ret.cyclesPerIteration == ret.latencyBound && ret.latencyBound > ret.portBound)
+		{
+			ret.bottleneck = "dependency";
+			ret.bottleneckPort = -1;
+		}
+		else if(ret.cyclesPerIteration == ret.frontendBound && ret.frontendBound > ret.portBound)
+		{
+			ret.bottleneck = "frontend";
+			ret.bottleneckPort = -1;
+		}
+		else
+		{
+			ret.bottleneck = "port";
+		}
+
+		return ret;
+	}
+}
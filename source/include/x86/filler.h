@@ -0,0 +1,446 @@
+// filler.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <math.h>
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "descent.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#include <immintrin.h>
+	#define INSTRAD_FILLER_AVX2 1
+#endif
+
+namespace instrad::x86
+{
+	enum class FillerKind : uint8_t
+	{
+		Int3,       // cc cc ...
+		Nop,        // 90, 66 90, 0f 1f /0 and the prefixed `data16 cs nopw` forms, with zero displacements
+		Zero,       // 00 00 ...
+		Data,       // high-entropy bytes; tables, constants, compressed blobs
+	};
+
+	// the end of an int3, nop or zero range is a reliable instruction boundary (the next function,
+	// or loop, starts there); its start is not, since the first few bytes might really be the tail of
+	// the instruction before. the edges of a data range are only as precise as the entropy window.
+	struct FillerRange
+	{
+		uint64_t lo = 0;
+		uint64_t hi = 0;
+		FillerKind kind = FillerKind::Data;
+
+		constexpr bool contains(uint64_t addr) const { return addr >= this->lo && addr < this->hi; }
+		constexpr bool reliableEnd() const { return this->kind != FillerKind::Data; }
+	};
+
+	struct FillerOptions
+	{
+		size_t align = 16;              // padding has to end on one of these (or be long enough not to care)
+		bool entropy = true;            // also look for data
+		size_t entropyWindow = 256;
+		size_t entropyStep = 64;
+
+		// bits per byte, over one window. in 256 bytes, code stays under about 6.3 and random (or compressed)
+		// bytes stay above about 7.0; a table of small integers doesn't get anywhere near either.
+		double entropyThreshold = 6.8;
+
+		// the same, for the 64 bytes at either edge of a data range; code stays under about 5.5 here, and
+		// random bytes over 5.7. the edges are trimmed 16 bytes at a time until they look like data.
+		double edgeThreshold = 5.6;
+	};
+
+	namespace filler
+	{
+		// runs shorter than this need to end on an alignment boundary to count.
+		constexpr size_t MIN_INT3 = 2;
+		constexpr size_t MIN_NOP  = 2;
+		constexpr size_t MIN_ZERO = 8;
+
+		// runs at least this long count wherever they end.
+		constexpr size_t ANY_INT3 = 8;
+		constexpr size_t ANY_NOP  = 16;
+		constexpr size_t ANY_ZERO = 32;
+
+		// the length of the canonical nop at p, or 0. these are what assemblers and compilers emit for
+		// alignment: 90, 66 90, 0f 1f 00, 0f 1f 40 00, 0f 1f 44 00 00, 0f 1f 80 <0:32>, 0f 1f 84 00 <0:32>,
+		// with any number of 66 prefixes and an optional cs prefix, up to 15 bytes.
+		constexpr size_t matchNop(const uint8_t* p, size_t n)
+		{
+			size_t i = 0;
+			while(i < n && i < 14 && p[i] == 0x66)
+				i++;
+
+			if(i < n && p[i] == 0x90)
+				return i + 1;
+
+			if(i < n && p[i] == 0x2E && i > 0)
+				i++;
+
+			if(i + 2 >= n || p[i] != 0x0F || p[i + 1] != 0x1F)
+				return 0;
+
+			auto modrm = p[i + 2];
+			size_t disp = 0;
+			if(modrm == 0x00)       disp = 0;
+			else if(modrm == 0x40)  disp = 1;
+			else if(modrm == 0x44)  disp = 2;   // sib + disp8
+			else if(modrm == 0x80)  disp = 4;
+			else if(modrm == 0x84)  disp = 5;   // sib + disp32
+			else                    return 0;
+
+			auto len = i + 3 + disp;
+			if(len > n || len > 15)
+				return 0;
+
+			for(size_t k = i + 3; k < len; k++)
+			{
+				if(p[k] != 0)
+					return 0;
+			}
+
+			return len;
+		}
+
+		// the length of the run of `kind` starting at p.
+		constexpr size_t runLength(const uint8_t* p, size_t n, FillerKind kind)
+		{
+			size_t i = 0;
+			if(kind == FillerKind::Nop)
+			{
+				while(i < n)
+				{
+					auto k = matchNop(p + i, n - i);
+					if(k == 0)
+						break;
+
+					i += k;
+				}
+			}
+			else
+			{
+				auto b = (kind == FillerKind::Int3 ? 0xCC : 0x00);
+				while(i < n && p[i] == b)
+					i++;
+			}
+
+			return i;
+		}
+
+		// these only say where to look; runLength() decides. a 1 bit at position i means something
+		// might start at i: two int3s, two canonical-nop bytes, or four zeros.
+		constexpr bool isCandidate(const uint8_t* p, size_t n)
+		{
+			if(n < 2)
+				return false;
+
+			if(p[0] == 0xCC && p[1] == 0xCC)
+				return true;
+
+			if((p[0] == 0x0F && p[1] == 0x1F) || (p[0] == 0x66 && (p[1] == 0x66 || p[1] == 0x2E || p[1] == 0x0F
+				|| p[1] == 0x90)) || (p[0] == 0x90 && p[1] == 0x90))
+				return true;
+
+			return n >= 4 && p[0] == 0 && p[1] == 0 && p[2] == 0 && p[3] == 0;
+		}
+
+		template <typename Fn>
+		void scanScalar(const uint8_t* bytes, size_t lo, size_t hi, size_t size, Fn&& fn)
+		{
+			for(size_t i = lo; i < hi; i++)
+			{
+				if(isCandidate(bytes + i, size - i))
+					i = fn(i) - 1;
+			}
+		}
+
+	#if INSTRAD_FILLER_AVX2
+		// the same as scanScalar, 32 bytes at a time, comparing each byte with the one (or three) after it.
+		// fn(i) returns where to carry on from, which can be in a later block.
+		template <typename Fn>
+		__attribute__((target("avx2")))
+		void scanAVX2(const uint8_t* bytes, size_t lo, size_t hi, size_t size, Fn&& fn)
+		{
+			auto xCC = _mm256_set1_epi8((char) 0xCC);
+			auto x00 = _mm256_setzero_si256();
+			auto x0F = _mm256_set1_epi8(0x0F);
+			auto x1F = _mm256_set1_epi8(0x1F);
+			auto x2E = _mm256_set1_epi8(0x2E);
+			auto x66 = _mm256_set1_epi8(0x66);
+			auto x90 = _mm256_set1_epi8((char) 0x90);
+
+			size_t i = lo;
+			while(i + 35 <= std::min(hi + 3, size))
+			{
+				auto v0 = _mm256_loadu_si256((const __m256i*) (bytes + i));
+				auto v1 = _mm256_loadu_si256((const __m256i*) (bytes + i + 1));
+				auto v2 = _mm256_loadu_si256((const __m256i*) (bytes + i + 2));
+				auto v3 = _mm256_loadu_si256((const __m256i*) (bytes + i + 3));
+
+				auto int3 = _mm256_and_si256(_mm256_cmpeq_epi8(v0, xCC), _mm256_cmpeq_epi8(v1, xCC));
+				auto zero = _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(v0, x00), _mm256_cmpeq_epi8(v1, x00)),
+					_mm256_and_si256(_mm256_cmpeq_epi8(v2, x00), _mm256_cmpeq_epi8(v3, x00)));
+
+				auto after66 = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v1, x66), _mm256_cmpeq_epi8(v1, x2E)),
+					_mm256_or_si256(_mm256_cmpeq_epi8(v1, x0F), _mm256_cmpeq_epi8(v1, x90)));
+
+				auto nop = _mm256_or_si256(_mm256_and_si256(_mm256_cmpeq_epi8(v0, x0F), _mm256_cmpeq_epi8(v1, x1F)),
+					_mm256_and_si256(_mm256_cmpeq_epi8(v0, x90), _mm256_cmpeq_epi8(v1, x90)));
+				nop = _mm256_or_si256(nop, _mm256_and_si256(_mm256_cmpeq_epi8(v0, x66), after66));
+
+				auto mask = (uint32_t) _mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(int3, zero), nop));
+				if(i + 32 > hi)
+					mask &= (uint32_t) ((1ull << (hi - i)) - 1);
+
+				auto next = i + 32;
+				while(mask != 0)
+				{
+					auto at = i + __builtin_ctz(mask);
+					auto resume = fn(at);
+					if(resume >= next)
+					{
+						next = resume;
+						break;
+					}
+
+					mask &= ~(uint32_t) ((1ull << (resume - i)) - 1);
+				}
+
+				i = next;
+			}
+
+			if(i < hi)
+				scanScalar(bytes, i, hi, size, fn);
+		}
+	#endif
+
+		template <typename Fn>
+		void scan(const uint8_t* bytes, size_t lo, size_t hi, size_t size, Fn&& fn)
+		{
+		#if INSTRAD_FILLER_AVX2
+			if(__builtin_cpu_supports("avx2"))
+				return scanAVX2(bytes, lo, hi, size, fn);
+		#endif
+
+			scanScalar(bytes, lo, hi, size, fn);
+		}
+
+		constexpr size_t EDGE_BYTES = 64;
+		constexpr size_t EDGE_STEP = 16;
+
+		inline double entropyOf(const uint8_t* bytes, size_t n)
+		{
+			uint32_t counts[256] = { };
+			for(size_t i = 0; i < n; i++)
+				counts[bytes[i]]++;
+
+			double ret = 0;
+			for(auto c : counts)
+			{
+				if(c > 0)
+					ret -= (c / (double) n) * log2(c / (double) n);
+			}
+
+			return ret;
+		}
+
+		// ranges of at least `window` bytes (starting every `step` bytes) whose byte entropy is over the
+		// threshold. the byte counts slide along with the window, so each byte is counted twice (in and
+		// out) and each window costs one pass over the 256 counters.
+		inline void findData(const CodeRegion& region, const FillerOptions& opts, std::vector<FillerRange>& out)
+		{
+			auto n = region.size();
+			auto window = std::max(opts.entropyWindow, opts.entropyStep);
+			auto step = std::max((size_t) 1, opts.entropyStep);
+			if(n < window)
+				return;
+
+			// sum of c * log2(c) for each count; the entropy of the window is log2(w) - sum / w.
+			double clog[257] = { };
+			for(size_t c = 1; c <= 256; c++)
+				clog[c] = c * log2((double) c);
+
+			uint32_t counts[256] = { };
+			auto bytes = region.bytes();
+			auto add = [&](size_t lo, size_t hi, int d) {
+				for(size_t i = lo; i < hi; i++)
+					counts[bytes[i]] += d;
+			};
+
+			add(0, window, 1);
+			for(size_t lo = 0; lo + window <= n; lo += step)
+			{
+				if(lo > 0)
+				{
+					add(lo - step, lo, -1);
+					add(lo + window - step, lo + window, 1);
+				}
+
+				double sum = 0;
+				for(size_t b = 0; b < 256; b++)
+					sum += (counts[b] <= 256 ? clog[counts[b]] : counts[b] * log2((double) counts[b]));
+
+				auto entropy = log2((double) window) - sum / window;
+				if(entropy < opts.entropyThreshold)
+					continue;
+
+				auto a = region.base() + lo;
+				auto b = a + window;
+				if(!out.empty() && out.back().hi >= a)
+					out.back().hi = b;
+				else
+					out.push_back(FillerRange { a, b, FillerKind::Data });
+			}
+
+			// a window only needs to be mostly data to get over the threshold, so the ranges overhang.
+			for(auto& r : out)
+			{
+				auto at = [&](uint64_t addr) { return bytes + region.offsetOf(addr); };
+				while(r.hi - r.lo > EDGE_BYTES && entropyOf(at(r.lo), EDGE_BYTES) < opts.edgeThreshold)
+					r.lo += EDGE_STEP;
+
+				while(r.hi - r.lo > EDGE_BYTES && entropyOf(at(r.hi - EDGE_BYTES), EDGE_BYTES) < opts.edgeThreshold)
+					r.hi -= EDGE_STEP;
+			}
+		}
+	}
+
+	// finds padding (runs of int3, canonical nops, and zeros) and high-entropy data in a region, without
+	// decoding anything: a vectorised scan picks out the few places where a run could start, and only
+	// those are looked at byte by byte. returns the ranges sorted by address, not overlapping; padding
+	// inside (or overlapping) data is left out.
+	inline std::vector<FillerRange> classifyFiller(const CodeRegion& region, const FillerOptions& opts = FillerOptions())
+	{
+		auto padding = std::vector<FillerRange>();
+		auto bytes = region.bytes();
+		auto size = region.size();
+		auto align = std::max((size_t) 1, opts.align);
+
+		size_t lastEnd = 0;
+		filler::scan(bytes, 0, size, size, [&](size_t at) -> size_t {
+			auto kind = (bytes[at] == 0xCC ? FillerKind::Int3 : (bytes[at] == 0x00 ? FillerKind::Zero : FillerKind::Nop));
+			auto len = filler::runLength(bytes + at, size - at, kind);
+			if(len == 0)
+				return at + 1;
+
+			// the scan only looks at pairs (or fours), so the run can start a few single bytes earlier.
+			auto lo = at;
+			auto single = (kind == FillerKind::Nop ? 0x90 : bytes[at]);
+			while(lo > lastEnd && bytes[lo - 1] == single)
+				lo--;
+
+			auto hi = at + len;
+			auto total = hi - lo;
+			auto addr = region.base() + hi;
+
+			size_t minimum = (kind == FillerKind::Int3 ? filler::MIN_INT3 : (kind == FillerKind::Nop ? filler::MIN_NOP : filler::MIN_ZERO));
+			size_t anywhere = (kind == FillerKind::Int3 ? filler::ANY_INT3 : (kind == FillerKind::Nop ? filler::ANY_NOP : filler::ANY_ZERO));
+
+			bool aligned = (addr % align) == 0 || hi == size;
+			if(total >= anywhere || (total >= minimum && aligned))
+			{
+				padding.push_back(FillerRange { region.base() + lo, addr, kind });
+				lastEnd = hi;
+			}
+
+			return hi;
+		});
+
+		auto data = std::vector<FillerRange>();
+		if(opts.entropy)
+			filler::findData(region, opts, data);
+
+		auto ret = std::vector<FillerRange>();
+		ret.reserve(padding.size() + data.size());
+
+		size_t d = 0;
+		for(auto& p : padding)
+		{
+			while(d < data.size() && data[d].hi <= p.lo)
+				ret.push_back(data[d++]);
+
+			if(d < data.size() && data[d].lo < p.hi)
+				continue;
+
+			ret.push_back(p);
+		}
+
+		ret.insert(ret.end(), data.begin() + d, data.end());
+		return ret;
+	}
+
+	// a linear sweep that steps over the filler (whenever it lands inside one; an instruction that runs
+	// into the start of one is still decoded whole). the region is split between threads at the ends of
+	// padding ranges, which are real instruction boundaries, so the chunks can be swept independently. a
+	// chunk with no padding near its start is just swept by the thread before it. undecodable bytes are
+	// (unlike in a descent) marked as starts. the result can go anywhere a recursive descent's could.
+	inline Disassembly sweepRegion(const CodeRegion& region, const std::vector<FillerRange>& fillers, size_t threads = 0)
+	{
+		if(threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		auto starts = std::vector<uint64_t> { region.base() };
+		for(size_t t = 1; t < threads; t++)
+		{
+			auto want = region.base() + (region.size() * t) / threads;
+			auto it = std::lower_bound(fillers.begin(), fillers.end(), want, [](auto& f, uint64_t a) { return f.hi < a; });
+			while(it != fillers.end() && !it->reliableEnd())
+				++it;
+
+			if(it != fillers.end() && it->hi < region.end() && it->hi > starts.back())
+				starts.push_back(it->hi);
+		}
+
+		starts.push_back(region.end());
+
+		auto bitmap = AtomicBitmap(region.size());
+		auto counts = std::vector<size_t>(starts.size() - 1);
+
+		auto work = [&](size_t c) {
+			auto ip = starts[c];
+			auto f = std::lower_bound(fillers.begin(), fillers.end(), ip, [](auto& r, uint64_t a) { return r.hi <= a; });
+
+			while(ip < starts[c + 1])
+			{
+				while(f != fillers.end() && f->hi <= ip)
+					++f;
+
+				if(f != fillers.end() && f->contains(ip))
+				{
+					ip = f->hi;
+					continue;
+				}
+
+				auto instr = region.decode(ip);
+				bitmap.claim(region.offsetOf(ip));
+				if(instr.op() != ops::INVALID)
+					counts[c]++;
+
+				ip = region.nextBoundary(ip, instr);
+			}
+		};
+
+		auto pool = std::vector<std::thread>();
+		for(size_t c = 1; c < counts.size(); c++)
+			pool.emplace_back(work, c);
+
+		work(0);
+		for(auto& t : pool)
+			t.join();
+
+		auto ret = Disassembly();
+		ret.region = region;
+		ret.starts = bitmap.snapshot();
+
+		for(auto n : counts)
+			ret.instructionCount += n;
+
+		return ret;
+	}
+}
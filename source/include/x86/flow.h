@@ -0,0 +1,144 @@
+// flow.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <algorithm>
+
+#include "decode.h"
+
+namespace instrad::x86
+{
+	// a contiguous chunk of machine code, mapped at some address. this does not own the bytes.
+	struct CodeRegion
+	{
+		constexpr CodeRegion() { }
+		constexpr CodeRegion(const uint8_t* bytes, size_t size, uint64_t base, ExecMode mode)
+			: m_bytes(bytes), m_size(size), m_base(base), m_mode(mode) { }
+
+		constexpr const uint8_t* bytes() const { return this->m_bytes; }
+		constexpr size_t size() const { return this->m_size; }
+		constexpr uint64_t base() const { return this->m_base; }
+		constexpr uint64_t end() const { return this->m_base + this->m_size; }
+		constexpr ExecMode mode() const { return this->m_mode; }
+
+		constexpr bool contains(uint64_t addr) const { return addr >= this->m_base && addr < this->end(); }
+		constexpr size_t offsetOf(uint64_t addr) const { return addr - this->m_base; }
+
+		// decodes the instruction at the given address. the caller must check that the address
+		// is actually inside the region; if the bytes run out halfway, the result is INVALID.
+		constexpr Instruction decode(uint64_t addr) const
+		{
+			auto ofs = this->offsetOf(addr);
+			auto buf = Buffer(this->m_bytes + ofs, this->m_size - ofs);
+
+			auto ret = read(buf, this->m_mode);
+			if(buf.overrun())
+				return Instruction(ops::INVALID);
+
+			return ret;
+		}
+
+		// where a linear sweep goes after the instruction at `ip`. undecodable bytes are
+		// stepped over one at a time, and the result never goes past the end of the region.
+		constexpr uint64_t nextBoundary(uint64_t ip, const Instruction& instr) const
+		{
+			return ip + std::min(std::max((size_t) 1, instr.length()), (size_t) (this->end() - ip));
+		}
+
+		constexpr uint64_t nextBoundary(uint64_t ip) const { return this->nextBoundary(ip, this->decode(ip)); }
+
+	private:
+		const uint8_t* m_bytes = nullptr;
+		size_t m_size = 0;
+		uint64_t m_base = 0;
+		ExecMode m_mode = ExecMode::Long;
+	};
+
+
+	// the jcc ops are numbered contiguously, from js to jcxz.
+	constexpr bool isConditionalJump(const Op& op) { return op.id() >= ops::JS.id() && op.id() <= ops::JCXZ.id(); }
+
+	constexpr bool isLoop(const Op& op)     { return op == ops::LOOP || op == ops::LOOPZ || op == ops::LOOPNZ; }
+	constexpr bool isJump(const Op& op)     { return op == ops::JMP; }
+	constexpr bool isCall(const Op& op)     { return op == ops::CALL; }
+	constexpr bool isReturn(const Op& op)   { return op == ops::RET || op == ops::RETF || op == ops::IRET; }
+
+	// instructions after which execution never falls through to the next instruction.
+	constexpr bool isFlowTerminator(const Op& op)
+	{
+		return isJump(op) || isReturn(op) || op == ops::HLT || op == ops::UD2 || op == ops::INVALID;
+	}
+
+	// true if the instruction transfers control to a pc-relative target (jmp/jcc/call/loop rel)
+	constexpr bool hasRelativeTarget(const Instruction& instr)
+	{
+		auto& op = instr.op();
+		return (isConditionalJump(op) || isLoop(op) || isJump(op) || isCall(op))
+			&& instr.operandCount() > 0 && instr.dst().isRelativeOffset();
+	}
+
+	// relative offsets are measured from the end of the instruction, not the start.
+	constexpr uint64_t branchTarget(const Instruction& instr, uint64_t ip)
+	{
+		return ip + instr.length() + instr.dst().ofs().offset();
+	}
+
+	// the first memory operand of an instruction, or null if there isn't one.
+	constexpr const Operand* memoryOperand(const Instruction& instr)
+	{
+		if(instr.operandCount() > 0 && instr.dst().isMemory()) return &instr.dst();
+		if(instr.operandCount() > 1 && instr.src().isMemory()) return &instr.src();
+		if(instr.operandCount() > 2 && instr.ext().isMemory()) return &instr.ext();
+		if(instr.operandCount() > 3 && instr.op4().isMemory()) return &instr.op4();
+
+		return nullptr;
+	}
+
+	// true if the address of the operand can be known without knowing any registers (except rip). a segment
+	// override other than ds or cs means the address is relative to that segment's base (fs:[0x28] is the
+	// stack canary in the tls block, not address 0x28), which we don't know.
+	constexpr bool hasStaticAddress(const MemoryRef& mem)
+	{
+		auto& seg = mem.segment();
+		if(seg.present() && seg != regs::DS && seg != regs::CS)
+			return false;
+
+		return mem.base() == regs::RIP || (!mem.base().present() && !mem.index().present());
+	}
+
+	// the absolute address of a memory operand (for which hasStaticAddress() is true): [rip + disp] is
+	// measured from the end of the instruction, like branches. the decoder stores displacements without
+	// extending them, so a disp32 is sign-extended here (as the cpu does in long mode), and the result is
+	// then cut down to the address size: 32 bits in 32-bit mode (or with 0x67 in long mode), 16 in 16-bit
+	// mode. moffs forms (`mov rax, [imm64]`) have the full 64 bits already.
+	constexpr uint64_t effectiveAddress(const Instruction& instr, uint64_t ip, const MemoryRef& mem)
+	{
+		auto disp = mem.isDisplacement64Bits() ? mem.displacement() : (uint64_t) (int64_t) (int32_t) mem.displacement();
+		auto rel = (mem.base() == regs::RIP) ? ip + instr.length() : 0;
+
+		auto& mods = instr.mods();
+		int bits = mods.legacyAddressingMode ? 16 : (mods.compatibilityMode ? 32 : 64);
+		if(mods.addressSizeOverride)
+			bits = (bits == 32 ? 16 : 32);
+
+		auto ret = rel + disp;
+		if(bits < 64)
+			ret &= ((uint64_t) 1 << bits) - 1;
+
+		return ret;
+	}
+
+	// the absolute address of the instruction's memory operand. returns false if it doesn't have one,
+	// or if the address depends on the value of some register.
+	constexpr bool effectiveAddress(const Instruction& instr, uint64_t ip, uint64_t& out)
+	{
+		auto op = memoryOperand(instr);
+		if(op == nullptr || !hasStaticAddress(op->mem()))
+			return false;
+
+		out = effectiveAddress(instr, ip, op->mem());
+		return true;
+	}
+}
@@ -0,0 +1,148 @@
+// functions.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	struct FunctionStart
+	{
+		static constexpr uint8_t CALL_TARGET    = 0x01;     // target of a direct call
+		static constexpr uint8_t ENDBR          = 0x02;     // starts with endbr64/endbr32
+		static constexpr uint8_t FRAME_SETUP    = 0x04;     // push rbp; mov rbp, rsp
+		static constexpr uint8_t STACK_ALLOC    = 0x08;     // sub rsp, imm after a terminator
+		static constexpr uint8_t AFTER_PADDING  = 0x10;     // aligned, right after int3/nop padding
+
+		uint64_t address;
+		uint8_t reasons;
+	};
+
+	namespace funcs
+	{
+		struct ByteTable
+		{
+			bool set[256] = { };
+		};
+
+		// bytes that can start one of the prologues we look for. everything else is rejected
+		// with one table lookup, without looking at the instruction at all.
+		constexpr ByteTable makePrologueTable()
+		{
+			auto ret = ByteTable();
+			ret.set[0x48] = true;   // sub rsp, imm
+			ret.set[0x55] = true;   // push rbp / push ebp
+			ret.set[0xF3] = true;   // endbr
+			return ret;
+		}
+
+		constexpr auto PrologueFirstByte = makePrologueTable();
+
+		constexpr uint8_t matchPrologue(const uint8_t* p, size_t n, bool afterTerminator)
+		{
+			if(!PrologueFirstByte.set[p[0]])
+				return 0;
+
+			// f3 0f 1e fa = endbr64, f3 0f 1e fb = endbr32
+			if(n >= 4 && p[0] == 0xF3 && p[1] == 0x0F && p[2] == 0x1E && (p[3] == 0xFA || p[3] == 0xFB))
+				return FunctionStart::ENDBR;
+
+			// 55 48 89 e5 = push rbp; mov rbp, rsp. 55 89 e5 = push ebp; mov ebp, esp
+			if(n >= 4 && p[0] == 0x55 && p[1] == 0x48 && p[2] == 0x89 && p[3] == 0xE5)
+				return FunctionStart::FRAME_SETUP;
+
+			if(n >= 3 && p[0] == 0x55 && p[1] == 0x89 && p[2] == 0xE5)
+				return FunctionStart::FRAME_SETUP;
+
+			// 48 83 ec ib / 48 81 ec id = sub rsp, imm. this appears in the middle of functions
+			// all the time, so it only counts right after something that doesn't fall through.
+			if(afterTerminator && n >= 3 && p[0] == 0x48 && (p[1] == 0x83 || p[1] == 0x81) && p[2] == 0xEC)
+				return FunctionStart::STACK_ALLOC;
+
+			return 0;
+		}
+
+		constexpr bool isPadding(const Instruction& instr)
+		{
+			return instr.op() == ops::INT3 || instr.op() == ops::NOP;
+		}
+	}
+
+	// finds likely function starts in a stripped region of code, with one linear sweep: the targets
+	// of direct calls, known prologue byte sequences at instruction boundaries, and the first
+	// instruction after a run of padding at an `align`-byte boundary. returns them sorted by address.
+	inline std::vector<FunctionStart> findFunctionStarts(const CodeRegion& region, size_t align = 16)
+	{
+		auto found = std::vector<FunctionStart>();
+		auto mark = [&](uint64_t addr, uint8_t why) { found.push_back(FunctionStart { addr, why }); };
+
+		// padding after a jmp is often just the alignment of a loop header, so only trust it if it
+		// follows something that really leaves the function, or if it's int3s (which compilers only
+		// emit between functions).
+		bool afterTerminator = true;
+		bool afterExit = true;
+		bool afterPadding = false;
+
+		uint64_t ip = region.base();
+		while(ip < region.end())
+		{
+			auto ofs = region.offsetOf(ip);
+			auto instr = region.decode(ip);
+
+			if(instr.op() == ops::INVALID)
+			{
+				ip += 1;
+				afterTerminator = true;
+				afterExit = true;
+				afterPadding = false;
+				continue;
+			}
+
+			if(funcs::isPadding(instr))
+			{
+				afterPadding = afterPadding || (afterTerminator && (afterExit || instr.op() == ops::INT3));
+			}
+			else
+			{
+				uint8_t why = funcs::matchPrologue(region.bytes() + ofs, region.size() - ofs, afterTerminator || afterPadding);
+				if(afterPadding && (ip % align) == 0)
+					why |= FunctionStart::AFTER_PADDING;
+
+				if(why != 0)
+					mark(ip, why);
+
+				if(hasRelativeTarget(instr) && isCall(instr.op()))
+				{
+					if(auto target = branchTarget(instr, ip); region.contains(target))
+						mark(target, FunctionStart::CALL_TARGET);
+				}
+
+				afterPadding = false;
+				afterTerminator = isFlowTerminator(instr.op());
+				afterExit = afterTerminator && !isJump(instr.op());
+			}
+
+			ip += instr.length();
+		}
+
+		// merge the duplicates, combining their reasons.
+		std::sort(found.begin(), found.end(), [](auto& a, auto& b) { return a.address < b.address; });
+
+		auto ret = std::vector<FunctionStart>();
+		for(auto& f : found)
+		{
+			if(!ret.empty() && ret.back().address == f.address)
+				ret.back().reasons |= f.reasons;
+
+			else
+				ret.push_back(f);
+		}
+
+		return ret;
+	}
+}
@@ -0,0 +1,198 @@
+// gadgets.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#include <immintrin.h>
+	#define INSTRAD_GADGETS_AVX2 1
+#endif
+
+namespace instrad::x86
+{
+	// a sequence of instructions ending in ret, ret imm16, jmp reg or call reg.
+	struct Gadget
+	{
+		uint64_t address = 0;       // of the first instruction
+		uint64_t terminator = 0;    // address of the ret/jmp/call
+		uint32_t length = 0;        // in bytes, including the terminator
+		uint32_t instructions = 0;  // including the terminator
+	};
+
+	struct GadgetOptions
+	{
+		size_t maxBytes = 20;       // how far back from the terminator to start decoding
+		size_t maxInstructions = 6; // including the terminator
+		size_t threads = 0;         // 0 = one per core
+	};
+
+	namespace gadget
+	{
+		// c3 = ret, c2 iw = ret imm16, ff /2 = call r/m, ff /4 = jmp r/m.
+		constexpr bool isCandidateByte(uint8_t b) { return b == 0xC3 || b == 0xC2 || b == 0xFF; }
+
+		// calls fn(offset) for every offset in [lo, hi) whose byte could start a terminator.
+		template <typename Fn>
+		void scanScalar(const uint8_t* bytes, size_t lo, size_t hi, Fn&& fn)
+		{
+			for(size_t i = lo; i < hi; i++)
+			{
+				if(isCandidateByte(bytes[i]))
+					fn(i);
+			}
+		}
+
+	#if INSTRAD_GADGETS_AVX2
+		// the same as scanScalar, 32 bytes at a time. the interesting bytes are rare, so almost every
+		// block is rejected with three compares and a movemask.
+		template <typename Fn>
+		__attribute__((target("avx2")))
+		void scanAVX2(const uint8_t* bytes, size_t lo, size_t hi, Fn&& fn)
+		{
+			auto ret = _mm256_set1_epi8((char) 0xC3);
+			auto retn = _mm256_set1_epi8((char) 0xC2);
+			auto grp5 = _mm256_set1_epi8((char) 0xFF);
+
+			size_t i = lo;
+			for(; i + 32 <= hi; i += 32)
+			{
+				auto v = _mm256_loadu_si256((const __m256i*) (bytes + i));
+				auto hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, ret), _mm256_cmpeq_epi8(v, retn)),
+					_mm256_cmpeq_epi8(v, grp5));
+
+				for(auto mask = (uint32_t) _mm256_movemask_epi8(hit); mask != 0; mask &= (mask - 1))
+					fn(i + __builtin_ctz(mask));
+			}
+
+			scanScalar(bytes, i, hi, fn);
+		}
+	#endif
+
+		template <typename Fn>
+		void scan(const uint8_t* bytes, size_t lo, size_t hi, Fn&& fn)
+		{
+		#if INSTRAD_GADGETS_AVX2
+			if(__builtin_cpu_supports("avx2"))
+				return scanAVX2(bytes, lo, hi, fn);
+		#endif
+
+			scanScalar(bytes, lo, hi, fn);
+		}
+
+		constexpr bool isTerminator(const Instruction& instr)
+		{
+			auto& op = instr.op();
+			return op == ops::RET || ((isJump(op) || isCall(op)) && instr.operandCount() > 0 && instr.dst().isRegister());
+		}
+
+		// anything that would take control away before we get to the terminator.
+		constexpr bool breaksGadget(const Instruction& instr)
+		{
+			auto& op = instr.op();
+			return isFlowTerminator(op) || isConditionalJump(op) || isLoop(op) || isCall(op) || op == ops::INT3;
+		}
+
+		// scratch space for one terminator's window; kept per thread.
+		struct Window
+		{
+			std::vector<uint8_t> lengths;
+			std::vector<int8_t> depth;      // instructions from here to the end of the gadget, or -1
+		};
+
+		// each offset in the window before the terminator is decoded exactly once; working backwards,
+		// an offset starts a gadget if its instruction is harmless and ends right where another gadget
+		// (or the terminator itself) starts.
+		inline void collect(const CodeRegion& region, uint64_t term, size_t termLen, const GadgetOptions& opts,
+			Window& win, std::vector<Gadget>& out)
+		{
+			auto ofs = region.offsetOf(term);
+			auto n = std::min(opts.maxBytes, ofs);
+
+			win.lengths.assign(n + 1, 0);
+			win.depth.assign(n + 1, -1);
+
+			// index i in the window is the address term - n + i; the terminator is at index n.
+			win.depth[n] = 1;
+			out.push_back(Gadget { term, term, (uint32_t) termLen, 1 });
+
+			for(size_t i = n; i-- > 0; )
+			{
+				auto addr = term - n + i;
+				auto instr = region.decode(addr);
+				if(instr.op() == ops::INVALID || breaksGadget(instr))
+					continue;
+
+				auto next = i + instr.length();
+				if(next > n || win.depth[next] < 0 || (size_t) win.depth[next] + 1 > opts.maxInstructions)
+					continue;
+
+				win.depth[i] = win.depth[next] + 1;
+				out.push_back(Gadget { addr, term, (uint32_t) (term + termLen - addr), (uint32_t) win.depth[i] });
+			}
+		}
+	}
+
+	// finds gadgets in a region of code. candidate terminators are found with a vectorised byte scan,
+	// then confirmed by decoding; only then do we decode the few bytes in front of each one. the region
+	// is split into equal chunks (by the terminator's address) between threads. returns the gadgets
+	// sorted by address (and then by terminator).
+	inline std::vector<Gadget> findGadgets(const CodeRegion& region, const GadgetOptions& opts = GadgetOptions())
+	{
+		auto threads = opts.threads;
+		if(threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		// not worth splitting tiny regions.
+		threads = std::max((size_t) 1, std::min(threads, region.size() / 4096));
+
+		auto results = std::vector<std::vector<Gadget>>(threads);
+		auto work = [&](size_t t) {
+			auto chunk = (region.size() + threads - 1) / threads;
+			auto lo = std::min(region.size(), t * chunk);
+			auto hi = std::min(region.size(), lo + chunk);
+
+			auto win = gadget::Window();
+			auto& out = results[t];
+
+			gadget::scan(region.bytes(), lo, hi, [&](size_t ofs) {
+				auto addr = region.base() + ofs;
+				auto instr = region.decode(addr);
+				if(instr.op() != ops::INVALID && gadget::isTerminator(instr))
+					gadget::collect(region, addr, instr.length(), opts, win, out);
+
+				// `jmp r8` and friends need a rex prefix, which comes before the ff.
+				if(ofs > 0 && (region.bytes()[ofs - 1] & 0xF0) == 0x40 && region.bytes()[ofs] == 0xFF)
+				{
+					auto rex = region.decode(addr - 1);
+					if(rex.op() != ops::INVALID && gadget::isTerminator(rex))
+						gadget::collect(region, addr - 1, rex.length(), opts, win, out);
+				}
+			});
+		};
+
+		auto pool = std::vector<std::thread>();
+		for(size_t t = 1; t < threads; t++)
+			pool.emplace_back(work, t);
+
+		work(0);
+		for(auto& t : pool)
+			t.join();
+
+		auto ret = std::vector<Gadget>();
+		for(auto& r : results)
+			ret.insert(ret.end(), r.begin(), r.end());
+
+		std::sort(ret.begin(), ret.end(), [](auto& a, auto& b) {
+			return a.address < b.address || (a.address == b.address && a.terminator < b.terminator);
+		});
+
+		return ret;
+	}
+}
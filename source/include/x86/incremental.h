@@ -0,0 +1,169 @@
+// incremental.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	// a byte range [lo, hi) that was changed since the last sweep.
+	struct PatchRange
+	{
+		uint64_t lo = 0;
+		uint64_t hi = 0;
+	};
+
+	struct ResyncStats
+	{
+		size_t ranges = 0;          // walks; a patch that an earlier walk ran into doesn't get its own
+		size_t bytes = 0;           // re-decoded, from the boundary before each patch to the resync point
+		size_t instructions = 0;    // re-decoded
+	};
+
+	// the instruction boundaries of a linear sweep (the same one the driver does, see
+	// CodeRegion::nextBoundary), kept around so that they can be fixed
+	// up after the bytes change instead of sweeping the whole region again.
+	//
+	// the bytes belong to the caller, who patches them in place and then calls update() with the ranges
+	// that changed. an instruction's length only depends on its own bytes, so everything before the last
+	// boundary at or before a patch is still right; from there we decode until we're past the patch and
+	// land on a boundary that the old sweep also had, after which the two streams are identical.
+	struct IncrementalSweep
+	{
+		IncrementalSweep() { }
+		IncrementalSweep(const CodeRegion& region) : m_region(region), m_starts((region.size() + 63) / 64)
+		{
+			size_t n = 0;
+			this->resync(region.base(), [&region](uint64_t) { return region.end(); }, n);
+		}
+
+		const CodeRegion& region() const { return this->m_region; }
+		const std::vector<uint64_t>& starts() const { return this->m_starts; }
+		size_t instructionCount() const { return this->m_count; }
+
+		bool isInstructionStart(uint64_t addr) const
+		{
+			return this->m_region.contains(addr) && this->test(this->m_region.offsetOf(addr));
+		}
+
+		// the last boundary at or before addr (which must be inside the region). the first byte is always
+		// a boundary, so there always is one.
+		uint64_t boundaryBefore(uint64_t addr) const
+		{
+			auto ofs = this->m_region.offsetOf(addr);
+			auto w = ofs / 64;
+
+			auto bits = this->m_starts[w] & (~(uint64_t) 0 >> (63 - (ofs % 64)));
+			while(bits == 0)
+				bits = this->m_starts[--w];
+
+			return this->m_region.base() + (w * 64) + (63 - __builtin_clzll(bits));
+		}
+
+		// calls fn(addr, instr) for every instruction (and undecodable byte), in address order.
+		template <typename Fn>
+		void forEach(Fn&& fn) const
+		{
+			for(size_t w = 0; w < this->m_starts.size(); w++)
+			{
+				for(auto bits = this->m_starts[w]; bits != 0; bits &= (bits - 1))
+				{
+					auto addr = this->m_region.base() + (w * 64) + __builtin_ctzll(bits);
+					fn(addr, this->m_region.decode(addr));
+				}
+			}
+		}
+
+		// re-decodes around the patched ranges, which don't need to be sorted, and may overlap.
+		ResyncStats update(std::vector<PatchRange> patches)
+		{
+			auto& region = this->m_region;
+			for(auto& p : patches)
+			{
+				p.lo = std::max(p.lo, region.base());
+				p.hi = std::min(p.hi, region.end());
+			}
+
+			patches.erase(std::remove_if(patches.begin(), patches.end(), [](auto& p) { return p.lo >= p.hi; }),
+				patches.end());
+
+			std::sort(patches.begin(), patches.end(), [](auto& a, auto& b) { return a.lo < b.lo; });
+
+			auto stats = ResyncStats();
+			for(size_t i = 0; i < patches.size(); i++)
+			{
+				// an undecodable byte might have looked at (up to 15) bytes past itself before giving up, so
+				// back up far enough that anything which could have seen the patch gets decoded again.
+				auto lo = patches[i].lo;
+				auto from = this->boundaryBefore(lo - std::min(lo - region.base(), (uint64_t) 14));
+				auto hi = patches[i].hi;
+
+				auto end = this->resync(from, [&](uint64_t ip) {
+					// the walk can run into the next patch, in which case it has to get past that one too.
+					while(i + 1 < patches.size() && patches[i + 1].lo <= ip)
+						hi = std::max(hi, patches[++i].hi);
+
+					return hi;
+				}, stats.instructions);
+
+				stats.ranges++;
+				stats.bytes += end - from;
+			}
+
+			return stats;
+		}
+
+	private:
+		bool test(size_t ofs) const { return this->m_starts[ofs / 64] & ((uint64_t) 1 << (ofs % 64)); }
+		void set(size_t ofs) { this->m_starts[ofs / 64] |= ((uint64_t) 1 << (ofs % 64)); }
+		void clear(size_t ofs) { this->m_starts[ofs / 64] &= ~((uint64_t) 1 << (ofs % 64)); }
+
+		// sweeps from `from` (a boundary) until it lands on a boundary at or past `hi(ip)` that the old
+		// sweep also had, or runs off the end. returns where it stopped.
+		template <typename Hi>
+		uint64_t resync(uint64_t from, Hi&& hi, size_t& decoded)
+		{
+			auto& region = this->m_region;
+
+			auto ip = from;
+			while(ip < region.end())
+			{
+				// nothing has touched this bit yet, so it's still the old sweep's.
+				auto ofs = region.offsetOf(ip);
+				if(ip >= hi(ip) && this->test(ofs))
+					break;
+
+				auto len = region.nextBoundary(ip) - ip;
+
+				if(!this->test(ofs))
+				{
+					this->set(ofs);
+					this->m_count++;
+				}
+
+				for(size_t k = 1; k < len; k++)
+				{
+					if(this->test(ofs + k))
+					{
+						this->clear(ofs + k);
+						this->m_count--;
+					}
+				}
+
+				decoded++;
+				ip += len;
+			}
+
+			return ip;
+		}
+
+		CodeRegion m_region;
+		std::vector<uint64_t> m_starts;
+		size_t m_count = 0;
+	};
+}
@@ -0,0 +1,254 @@
+// isa.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <string.h>
+#include <strings.h>
+
+#include <string>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	constexpr size_t NUM_EXTENSIONS = (size_t) Ext::Count;
+
+	// one bit per extension.
+	struct ExtSet
+	{
+		constexpr ExtSet() { }
+		constexpr ExtSet(Ext ext) : m_bits(1ull << (size_t) ext) { }
+
+		constexpr bool has(Ext ext) const { return this->m_bits & (1ull << (size_t) ext); }
+		constexpr bool empty() const { return this->m_bits == 0; }
+		constexpr uint64_t bits() const { return this->m_bits; }
+
+		constexpr bool intersects(ExtSet other) const { return (this->m_bits & other.m_bits) != 0; }
+
+		constexpr ExtSet operator | (ExtSet other) const { return fromBits(this->m_bits | other.m_bits); }
+		constexpr ExtSet operator & (ExtSet other) const { return fromBits(this->m_bits & other.m_bits); }
+		constexpr ExtSet operator ~ () const { return fromBits(~this->m_bits & ((1ull << NUM_EXTENSIONS) - 1)); }
+
+		constexpr ExtSet& operator |= (ExtSet other) { this->m_bits |= other.m_bits; return *this; }
+
+		constexpr bool operator == (ExtSet other) const { return this->m_bits == other.m_bits; }
+		constexpr bool operator != (ExtSet other) const { return this->m_bits != other.m_bits; }
+
+		static constexpr ExtSet fromBits(uint64_t bits) { auto ret = ExtSet(); ret.m_bits = bits; return ret; }
+
+	private:
+		uint64_t m_bits = 0;
+	};
+
+	static_assert(NUM_EXTENSIONS <= 64);
+
+	namespace isa
+	{
+		// in the same order as the enum.
+		constexpr const char* NAMES[] = {
+			"base", "x87", "cmov", "cx8", "cx16", "fxsr", "mmx", "3dnow", "sse", "sse2", "sse3", "ssse3", "sse4.1",
+			"sse4.2", "sse4a", "popcnt", "lzcnt", "movbe", "aes", "pclmul", "avx", "avx2", "fma", "fma4", "f16c",
+			"bmi1", "bmi2", "rdrand", "rdseed", "rdtscp", "fsgsbase", "xsave", "monitorx", "vmx", "svm",
+		};
+
+		static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == NUM_EXTENSIONS);
+
+		// the x86-64 psABI microarchitecture levels, as far as this decoder knows the instructions. v4 is
+		// all avx-512, which we can't decode, so it isn't here.
+		constexpr auto X86_64_V1 = ExtSet(Ext::Base) | Ext::X87 | Ext::CMOV | Ext::CX8 | Ext::FXSR | Ext::MMX
+			| Ext::SSE | Ext::SSE2;
+
+		constexpr auto X86_64_V2 = X86_64_V1 | Ext::CX16 | Ext::POPCNT | Ext::SSE3 | Ext::SSSE3 | Ext::SSE41 | Ext::SSE42;
+
+		constexpr auto X86_64_V3 = X86_64_V2 | Ext::AVX | Ext::AVX2 | Ext::BMI1 | Ext::BMI2 | Ext::F16C | Ext::FMA
+			| Ext::LZCNT | Ext::MOVBE | Ext::XSAVE;
+
+		constexpr bool startsWith(const char* str, const char* prefix)
+		{
+			while(*prefix)
+			{
+				if(*str++ != *prefix++)
+					return false;
+			}
+
+			return true;
+		}
+
+		constexpr bool hasVectorRegister(const Instruction& instr, int width)
+		{
+			const Operand* operands[] = { &instr.dst(), &instr.src(), &instr.ext(), &instr.op4() };
+			for(int i = 0; i < instr.operandCount() && i < 4; i++)
+			{
+				if(operands[i]->isRegister() && (operands[i]->reg().index() & regs::REG_FLAG_SSE)
+					&& operands[i]->reg().width() == width)
+					return true;
+			}
+
+			return false;
+		}
+
+		// vex integer ops only got 256-bit forms in avx2; the vex float ops (and the two that
+		// look like integer ones but aren't) had them from the start.
+		constexpr bool isVexIntegerOp(const Op& op)
+		{
+			auto m = op.mnemonic();
+			return op.extension() == Ext::AVX && (startsWith(m, "vp") || startsWith(m, "vmovntdqa"))
+				&& !startsWith(m, "vpermil") && !startsWith(m, "vperm2f128");
+		}
+
+		// the x87 conditional moves and the compares that set eflags came with cmov (the cpuid
+		// bit covers both), so they need x87 and cmov.
+		constexpr bool isX87Cmov(const Op& op)
+		{
+			return op == ops::FCMOVB || op == ops::FCMOVE || op == ops::FCMOVBE || op == ops::FCMOVU
+				|| op == ops::FCMOVNB || op == ops::FCMOVNE || op == ops::FCMOVNBE || op == ops::FCMOVNU
+				|| op == ops::FCOMI || op == ops::FCOMIP || op == ops::FUCOMI || op == ops::FUCOMIP;
+		}
+	}
+
+	constexpr const char* extensionName(Ext ext)
+	{
+		return (size_t) ext < NUM_EXTENSIONS ? isa::NAMES[(size_t) ext] : "??";
+	}
+
+	// everything the cpu needs to support to run this instruction. this is the op's own extension,
+	// plus whatever the encoding adds on top:
+	// - the mmx ops with xmm operands are sse2 (and the string movsd/cmpsd share an op with the sse2 ones)
+	// - anything vex-encoded needs avx, except the bmi ops that only use gprs
+	// - 256-bit vex integer ops are avx2
+	// - fcmovcc and f(u)comi(p) are x87, but also need cmov
+	// and one goes the other way: tzcnt runs as bsf on cpus without bmi1, and compilers emit it (as
+	// `rep bsf`) for generic targets exactly because of that, so it doesn't count.
+	constexpr ExtSet requiredExtensions(const Instruction& instr)
+	{
+		auto& op = instr.op();
+		auto ext = op.extension();
+
+		if(op == ops::INVALID || op == ops::NONE)
+			return ExtSet();
+
+		if(op == ops::TZCNT && !instr.mods().vex.present())
+			return ExtSet(Ext::Base);
+
+		if((ext == Ext::MMX || op == ops::MOVSD || op == ops::CMPSD) && isa::hasVectorRegister(instr, 128))
+			return ExtSet(Ext::SSE2);
+
+		auto ret = ExtSet(ext);
+		if(isa::isX87Cmov(op))
+			ret |= Ext::CMOV;
+
+		if(instr.mods().vex.present() && ext != Ext::BMI1 && ext != Ext::BMI2)
+		{
+			ret |= Ext::AVX;
+			if(isa::isVexIntegerOp(op) && isa::hasVectorRegister(instr, 256))
+				ret |= Ext::AVX2;
+		}
+
+		return ret;
+	}
+
+	// parses a comma-separated list of extension names (as in isa::NAMES) and levels (x86-64,
+	// x86-64-v2, x86-64-v3). returns false (and the offending name in `error`) if one is unknown.
+	inline bool parseExtensions(const std::string& list, ExtSet& out, std::string& error)
+	{
+		size_t pos = 0;
+		while(pos <= list.size())
+		{
+			auto comma = list.find(',', pos);
+			if(comma == std::string::npos)
+				comma = list.size();
+
+			auto name = list.substr(pos, comma - pos);
+			pos = comma + 1;
+
+			if(name.empty())
+				continue;
+
+			if(name == "x86-64" || name == "x86-64-v1")   { out |= isa::X86_64_V1; continue; }
+			else if(name == "x86-64-v2")                    { out |= isa::X86_64_V2; continue; }
+			else if(name == "x86-64-v3")                    { out |= isa::X86_64_V3; continue; }
+
+			bool found = false;
+			for(size_t i = 0; i < NUM_EXTENSIONS && !found; i++)
+			{
+				if(strcasecmp(name.c_str(), isa::NAMES[i]) == 0)
+				{
+					out |= (Ext) i;
+					found = true;
+				}
+			}
+
+			if(!found)
+			{
+				error = name;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	struct ExtensionUsage
+	{
+		uint64_t counts[NUM_EXTENSIONS] = { };
+		uint64_t first[NUM_EXTENSIONS] = { };   // address of the first use; only meaningful if the count isn't 0
+		ExtSet used;
+
+		size_t instructions = 0;
+		size_t badBytes = 0;                    // skipped because they didn't decode
+
+		// returns the extensions that the instruction needed.
+		constexpr ExtSet add(const Instruction& instr, uint64_t ip)
+		{
+			auto exts = requiredExtensions(instr);
+			for(size_t i = 0; i < NUM_EXTENSIONS; i++)
+			{
+				if(!exts.has((Ext) i))
+					continue;
+
+				if(this->counts[i]++ == 0)
+					this->first[i] = ip;
+			}
+
+			this->used |= exts;
+			this->instructions++;
+
+			return exts;
+		}
+	};
+
+	// linear sweep over [lo, hi), adding every instruction to `usage` (undecodable ones only count towards
+	// `badBytes`, and never stop the scan). if an instruction needs any extension in `stopOn`, it is counted
+	// and the scan stops right there, returning false (with `stopAt` set to its address). so a "does this run
+	// on an x86-64-v2 machine" check is `stopOn = ~isa::X86_64_V2`, and costs nothing past the first
+	// offending instruction.
+	constexpr bool scanExtensions(const CodeRegion& region, uint64_t lo, uint64_t hi, ExtensionUsage& usage,
+		ExtSet stopOn, uint64_t* stopAt = nullptr)
+	{
+		lo = std::max(lo, region.base());
+		hi = std::min(hi, region.end());
+
+		for(auto ip = lo; ip < hi; )
+		{
+			auto instr = region.decode(ip);
+			if(instr.op() == ops::INVALID)
+			{
+				usage.badBytes++;
+			}
+			else if(usage.add(instr, ip).intersects(stopOn))
+			{
+				if(stopAt != nullptr)
+					*stopAt = ip;
+
+				return false;
+			}
+
+			ip = region.nextBoundary(ip, instr);
+		}
+
+		return true;
+	}
+}
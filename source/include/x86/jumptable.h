@@ -0,0 +1,244 @@
+// jumptable.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+#include "semantics.h"
+
+namespace instrad::x86
+{
+	// the addresses of the last few instructions on a straight-line path. when we hit an indirect
+	// jump, we re-decode these to look for the table setup; keeping the instructions themselves
+	// around would mean copying every single one we decode.
+	struct InstrHistory
+	{
+		static constexpr size_t SIZE = 12;
+
+		void clear() { this->count = 0; }
+		void push(uint64_t ip) { this->addrs[this->count++ % SIZE] = ip; }
+
+		size_t size() const { return std::min(this->count, SIZE); }
+
+		// 0 is the most recent instruction.
+		uint64_t get(size_t back) const { return this->addrs[(this->count - 1 - back) % SIZE]; }
+
+	private:
+		uint64_t addrs[SIZE] = { };
+		size_t count = 0;
+	};
+
+	struct JumpTable
+	{
+		uint64_t jump = 0;          // address of the indirect jmp
+		uint64_t table = 0;         // address of the first entry
+		size_t entrySize = 0;
+		bool relative = false;      // entries are offsets from the table, not absolute addresses
+		std::vector<uint64_t> targets;
+	};
+
+	// reads memory straight out of a code region; tables that live in some other section won't be found.
+	struct RegionReader
+	{
+		const CodeRegion& region;
+
+		bool operator() (uint64_t addr, void* out, size_t n) const
+		{
+			if(!this->region.contains(addr) || addr + n > this->region.end())
+				return false;
+
+			auto src = this->region.bytes() + this->region.offsetOf(addr);
+			for(size_t i = 0; i < n; i++)
+				((uint8_t*) out)[i] = src[i];
+
+			return true;
+		}
+	};
+
+	namespace jumptable
+	{
+		// don't believe bounds bigger than this; it's probably not a switch.
+		constexpr size_t MAX_ENTRIES = 4096;
+
+		constexpr bool isGPR(const Register& r) { return r.present() && r.index() < 16; }
+
+		// compare register numbers, ignoring the width (eax vs rax).
+		constexpr bool sameGPR(const Register& a, const Register& b) { return isGPR(a) && isGPR(b) && a.index() == b.index(); }
+
+		// finds `cmp idx, imm` followed (somewhere later) by ja/jae, and returns the number of table entries.
+		// the walk goes backwards from `from` (the instruction just before the use of the index).
+		inline size_t findBound(const CodeRegion& region, const InstrHistory& hist, size_t from, const Register& idx)
+		{
+			bool sawJump = false;
+			bool inclusive = true;
+			for(size_t k = from; k < hist.size(); k++)
+			{
+				auto instr = region.decode(hist.get(k));
+				auto& op = instr.op();
+
+				if(op == ops::JA || op == ops::JNB)
+				{
+					sawJump = true;
+					inclusive = (op == ops::JA);
+				}
+				else if(sawJump && op == ops::CMP && instr.dst().isRegister() && instr.src().isImmediate())
+				{
+					if(!sameGPR(instr.dst().reg(), idx))
+						return 0;
+
+					auto n = (size_t) instr.src().imm() + (inclusive ? 1 : 0);
+					return (n == 0 || n > MAX_ENTRIES) ? 0 : n;
+				}
+				else if(registerUse(instr).writes & regmask::of(idx))
+				{
+					// the index got clobbered between the check and the use, so the bound says nothing about
+					// it. moving the index onto itself (eg. `mov eax, eax` to zero-extend) is fine.
+					bool self = (op == ops::MOV || op == ops::MOVSXD || op == ops::MOVZX) && instr.src().isRegister()
+						&& sameGPR(instr.src().reg(), idx);
+
+					if(!self)
+						return 0;
+				}
+			}
+
+			return 0;
+		}
+
+		template <typename Reader>
+		void readEntries(JumpTable& jt, size_t count, const CodeRegion& code, const Reader& read)
+		{
+			for(size_t i = 0; i < count; i++)
+			{
+				uint64_t target = 0;
+				if(jt.relative)
+				{
+					int32_t ofs = 0;
+					if(!read(jt.table + i * 4, &ofs, 4))
+						break;
+
+					target = jt.table + (int64_t) ofs;
+				}
+				else
+				{
+					uint64_t abs = 0;
+					if(!read(jt.table + i * jt.entrySize, &abs, jt.entrySize))
+						break;
+
+					target = abs;
+				}
+
+				// the first entry that doesn't point into code is the end of the table, bound or not.
+				if(!code.contains(target))
+					break;
+
+				jt.targets.push_back(target);
+			}
+		}
+	}
+
+	// tries to recover the targets of the indirect jmp at hist.get(0), by matching the two common
+	// compiler idioms for switch tables:
+	//
+	//   cmp idx, N; ja default; ...; jmp [table + idx*8]
+	//   cmp idx, N; ja default; ...; lea rX, [rip + table]; movsxd rY, [rX + idx*4]; add rY, rX; jmp rY
+	//
+	// the bound comes from the cmp; we don't guess the size of tables without one.
+	template <typename Reader>
+	bool resolveJumpTable(const CodeRegion& region, const InstrHistory& hist, const Reader& read, JumpTable& out)
+	{
+		using namespace jumptable;
+
+		if(hist.size() == 0)
+			return false;
+
+		auto jmpAddr = hist.get(0);
+		auto jmp = region.decode(jmpAddr);
+		if(!isJump(jmp.op()) || jmp.operandCount() == 0)
+			return false;
+
+		auto& dst = jmp.dst();
+		auto ptrSize = (region.mode() == ExecMode::Long ? 8 : 4);
+
+		out = JumpTable();
+		out.jump = jmpAddr;
+
+		if(dst.isMemory())
+		{
+			auto& mem = dst.mem();
+			if(mem.base().present() || !isGPR(mem.index()) || mem.scale() != ptrSize)
+				return false;
+
+			out.table = effectiveAddress(jmp, jmpAddr, mem);
+			out.entrySize = ptrSize;
+			out.relative = false;
+
+			auto n = findBound(region, hist, 1, mem.index());
+			if(n == 0)
+				return false;
+
+			readEntries(out, n, region, read);
+		}
+		else if(dst.isRegister() && isGPR(dst.reg()))
+		{
+			// walk backwards: add, then the load, then the lea.
+			auto sum = dst.reg();
+			Register other = regs::NONE;
+			Register loaded = regs::NONE;
+			Register base = regs::NONE;
+			Register index = regs::NONE;
+			size_t loadPos = 0;
+
+			for(size_t k = 1; k < hist.size(); k++)
+			{
+				auto ip = hist.get(k);
+				auto instr = region.decode(ip);
+				auto& op = instr.op();
+
+				if(!other.present())
+				{
+					if(op == ops::ADD && instr.dst().isRegister() && instr.src().isRegister() && sameGPR(instr.dst().reg(), sum))
+						other = instr.src().reg();
+				}
+				else if(!loaded.present())
+				{
+					if(op == ops::MOVSXD && instr.dst().isRegister() && instr.src().isMemory()
+						&& (sameGPR(instr.dst().reg(), sum) || sameGPR(instr.dst().reg(), other)))
+					{
+						auto& mem = instr.src().mem();
+						if(mem.scale() != 4 || !isGPR(mem.index()) || !isGPR(mem.base()))
+							return false;
+
+						loaded = instr.dst().reg();
+						base = mem.base();
+						index = mem.index();
+						loadPos = k;
+
+						// the table base must be whichever register the add used that wasn't loaded.
+						if(!sameGPR(base, sameGPR(loaded, sum) ? other : sum))
+							return false;
+					}
+				}
+				else if(op == ops::LEA && instr.dst().isRegister() && sameGPR(instr.dst().reg(), base)
+					&& instr.src().isMemory() && instr.src().mem().base() == regs::RIP)
+				{
+					out.table = effectiveAddress(instr, ip, instr.src().mem());
+					out.entrySize = 4;
+					out.relative = true;
+
+					auto n = findBound(region, hist, loadPos + 1, index);
+					if(n == 0)
+						return false;
+
+					readEntries(out, n, region, read);
+					break;
+				}
+			}
+		}
+
+		return !out.targets.empty();
+	}
+}
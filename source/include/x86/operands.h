@@ -70,6 +70,7 @@ namespace instrad::x86
 			{
 				case 64:    return regs::getMMX(index);
 				case 128:   return regs::getXMM(index);
+				case 256:   return regs::getYMM(index);
 			}
 		}
 
@@ -397,8 +398,10 @@ namespace instrad::x86
 		else                            return 64;
 	}
 
-	template <typename Buffer>
-	constexpr Operand getOperand(Buffer& buf, OpKind kind, InstrModifiers& mods)
+	// decodes one operand of a known kind. the kind is a template argument so that every instantiation
+	// folds the switch down to the one case it needs; getOperand() picks the right one from a table.
+	template <OpKind kind, typename Buffer>
+	constexpr Operand decodeOperand(Buffer& buf, InstrModifiers& mods)
 	{
 		switch(kind)
 		{
@@ -517,9 +520,13 @@ namespace instrad::x86
 				}
 				else
 				{
+					// rex.w wins over 0x66.
 					if(mods.rex.W())
 						return (int64_t) readSignedImm32(buf);
 
+					else if(mods.operandSizeOverride)
+						return readSignedImm16(buf);
+
 					return readSignedImm32(buf);
 				}
 			}
@@ -613,8 +620,10 @@ namespace instrad::x86
 			case OpKind::MemoryOfs16:
 			case OpKind::MemoryOfs32:
 			case OpKind::MemoryOfs64: {
-				// kekw
-				int bits = 8 * (1 << ((int) kind - (int) OpKind::MemoryOfs8));
+				int bits = 64;
+				if(kind == OpKind::MemoryOfs8)          bits = 8;
+				else if(kind == OpKind::MemoryOfs16)    bits = 16;
+				else if(kind == OpKind::MemoryOfs32)    bits = 32;
 				if(bits == 32 && mods.rex.W())
 					bits = 64;
 
@@ -714,10 +723,10 @@ namespace instrad::x86
 			case OpKind::RegYmm_vvvv:   return getRegisterOperandFromVVVV(256, mods, RegKind::Vector);
 
 			case OpKind::RegXmm_TrailingImm8HighNib:
-				return decodeRegisterNumber(128, mods, (readSignedImm8(buf) & 0xF) >> 4, RegKind::Vector);
+				return decodeRegisterNumber(128, mods, (readSignedImm8(buf) >> 4) & 0xF, RegKind::Vector);
 
 			case OpKind::RegYmm_TrailingImm8HighNib:
-				return decodeRegisterNumber(256, mods, (readSignedImm8(buf) & 0xF) >> 4, RegKind::Vector);
+				return decodeRegisterNumber(256, mods, (readSignedImm8(buf) >> 4) & 0xF, RegKind::Vector);
 
 			case OpKind::VSIB_Xmm32:
 			case OpKind::VSIB_Xmm64:
@@ -769,4 +778,39 @@ namespace instrad::x86
 		// gcc is too stupid to realise that the switch covers all options
 		return { };
 	}
+
+	namespace operand_table
+	{
+		// None is the last kind.
+		constexpr size_t NUM_KINDS = (size_t) OpKind::None + 1;
+
+		// std::index_sequence, without needing <utility>.
+		template <size_t... Ks> struct Kinds { };
+		template <size_t N, size_t... Ks> struct MakeKinds : MakeKinds<N - 1, N - 1, Ks...> { };
+		template <size_t... Ks> struct MakeKinds<0, Ks...> { using type = Kinds<Ks...>; };
+
+		template <typename Buffer>
+		struct Table
+		{
+			using Decoder = Operand (*)(Buffer&, InstrModifiers&);
+			Decoder decoders[NUM_KINDS];
+		};
+
+		template <typename Buffer, size_t... Ks>
+		constexpr Table<Buffer> make(Kinds<Ks...>)
+		{
+			return Table<Buffer> { { &decodeOperand<(OpKind) Ks, Buffer>... } };
+		}
+
+		template <typename Buffer>
+		inline constexpr Table<Buffer> table = make<Buffer>(typename MakeKinds<NUM_KINDS>::type());
+	}
+
+	// one indirect call into a decoder that only knows how to do this kind, instead of going through
+	// the whole switch for every operand.
+	template <typename Buffer>
+	constexpr Operand getOperand(Buffer& buf, OpKind kind, InstrModifiers& mods)
+	{
+		return operand_table::table<Buffer>.decoders[(size_t) kind](buf, mods);
+	}
 }
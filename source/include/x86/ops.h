@@ -9,14 +9,59 @@
 
 namespace instrad::x86
 {
+	// the instruction set extension that introduced an op. for ops that exist in more than one
+	// encoding (mmx and sse2, legacy and vex), this is the oldest one; see isa.h for the rest.
+	enum class Ext : uint8_t
+	{
+		Base,
+		X87,
+		CMOV,
+		CX8,
+		CX16,
+		FXSR,
+		MMX,
+		AMD3DNOW,
+		SSE,
+		SSE2,
+		SSE3,
+		SSSE3,
+		SSE41,
+		SSE42,
+		SSE4A,
+		POPCNT,
+		LZCNT,
+		MOVBE,
+		AES,
+		CLMUL,
+		AVX,
+		AVX2,
+		FMA,
+		FMA4,
+		F16C,
+		BMI1,
+		BMI2,
+		RDRAND,
+		RDSEED,
+		RDTSCP,
+		FSGSBASE,
+		XSAVE,
+		MONITORX,
+		VMX,
+		SVM,
+
+		Count
+	};
+
 	struct Op
 	{
 		constexpr Op(int id, const char* m) : m_unique_id(id), m_mnemonic(m) { }
 		constexpr Op(int id, const char* m, bool suff) : m_unique_id(id), m_mnemonic(m), m_has_suffix(suff) { }
+		constexpr Op(int id, const char* m, Ext ext) : m_unique_id(id), m_mnemonic(m), m_ext(ext) { }
 
 		constexpr const char* mnemonic() const { return this->m_mnemonic; }
 		constexpr bool has_suffix() const { return this->m_has_suffix; }
 		constexpr uint64_t id() const { return this->m_unique_id; }
+		constexpr Ext extension() const { return this->m_ext; }
 
 		constexpr bool operator != (const Op& other) const { return !(*this == other); }
 		constexpr bool operator == (const Op& other) const { return this->m_unique_id == other.m_unique_id; }
@@ -25,6 +70,7 @@ namespace instrad::x86
 		uint64_t m_unique_id;
 		const char* m_mnemonic;
 		bool m_has_suffix = true;
+		Ext m_ext = Ext::Base;
 	};
 
 	namespace ops
@@ -95,7 +141,7 @@ namespace instrad::x86
 		constexpr auto CQO              = Op(58,   "cqo");
 		constexpr auto CALL             = Op(59,   "call");
 
-		constexpr auto FWAIT            = Op(60,   "fwait");
+		constexpr auto FWAIT            = Op(60,   "fwait",           Ext::X87);
 		constexpr auto PUSHF            = Op(61,   "pushf");
 		constexpr auto POPF             = Op(62,   "popf");
 		constexpr auto SAHF             = Op(63,   "sahf");
@@ -156,8 +202,8 @@ namespace instrad::x86
 		constexpr auto CLTS             = Op(111,  "clts");
 		constexpr auto XLAT             = Op(112,  "xlat");
 
-		constexpr auto RDRAND           = Op(113,  "rdrand");
-		constexpr auto RDSEED           = Op(114,  "rdseed");
+		constexpr auto RDRAND           = Op(113,  "rdrand",          Ext::RDRAND);
+		constexpr auto RDSEED           = Op(114,  "rdseed",          Ext::RDSEED);
 		constexpr auto RDMSR            = Op(115,  "rdmsr");
 		constexpr auto WRMSR            = Op(116,  "wrmsr");
 		constexpr auto RDTSC            = Op(117,  "rdtsc");
@@ -186,8 +232,8 @@ namespace instrad::x86
 
 		constexpr auto CPUID            = Op(139,  "cpuid");
 		constexpr auto CMPXCHG          = Op(140,  "cmpxchg");
-		constexpr auto CMPXCHG8B        = Op(141,  "cmpxchg8b");
-		constexpr auto CMPXCHG16B       = Op(142,  "cmpxchg16b");
+		constexpr auto CMPXCHG8B        = Op(141,  "cmpxchg8b",       Ext::CX8);
+		constexpr auto CMPXCHG16B       = Op(142,  "cmpxchg16b",      Ext::CX16);
 		constexpr auto XADD             = Op(143,  "xadd");
 		constexpr auto MOVZX            = Op(144,  "movzx");
 		constexpr auto MOVSXD           = Op(145,  "movsxd");
@@ -232,7 +278,7 @@ namespace instrad::x86
 		constexpr auto UD1              = Op(180,  "ud1");
 		constexpr auto UD2              = Op(181,  "ud2");
 		constexpr auto PREFETCH         = Op(182,  "prefetch");
-		constexpr auto FEMMS            = Op(183,  "femms");
+		constexpr auto FEMMS            = Op(183,  "femms",           Ext::AMD3DNOW);
 		constexpr auto NOP              = Op(184,  "nop");
 		constexpr auto SYSENTER         = Op(185,  "sysenter");
 		constexpr auto SYSEXIT          = Op(186,  "sysexit");
@@ -241,45 +287,45 @@ namespace instrad::x86
 		constexpr auto LMSW             = Op(189,  "lmsw");
 
 		constexpr auto SWAPGS           = Op(190,  "swapgs");
-		constexpr auto RDTSCP           = Op(191,  "rdtscp");
+		constexpr auto RDTSCP           = Op(191,  "rdtscp",          Ext::RDTSCP);
 
 		constexpr auto INVLPG           = Op(192,  "invlpg");
-		constexpr auto INVLPGA          = Op(193,  "invlpga");
-
-		constexpr auto MONITOR          = Op(194,  "monitor");
-		constexpr auto MONITORX         = Op(195,  "monitorx");
-		constexpr auto MWAIT            = Op(196,  "mwait");
-		constexpr auto MWAITX           = Op(197,  "mwaitx");
-
-		constexpr auto XGETBV           = Op(198,  "xgetbv");
-		constexpr auto XSETBV           = Op(199,  "xsetbv");
-
-		constexpr auto VMCALL           = Op(200,  "vmcall");
-		constexpr auto VMLOAD           = Op(201,  "vmload");
-		constexpr auto VMSAVE           = Op(202,  "vmsave");
-		constexpr auto VMRUN            = Op(203,  "vmrun");
-
-		constexpr auto STGI             = Op(204,  "stgi");
-		constexpr auto CLGI             = Op(205,  "clgi");
-		constexpr auto SKINIT           = Op(206,  "skinit");
-
-		constexpr auto FXSAVE           = Op(207,  "fxsave");
-		constexpr auto FXRSTOR          = Op(208,  "fxrstor");
-		constexpr auto LDMXCSR          = Op(209,  "ldmxcsr");
-		constexpr auto STMXCSR          = Op(210,  "stmxcsr");
-		constexpr auto XSAVE            = Op(211,  "xsave");
-		constexpr auto XRSTOR           = Op(212,  "xrstor");
-		constexpr auto XSAVEOPT         = Op(213,  "xsaveopt");
-
-		constexpr auto LFENCE           = Op(214,  "lfence");
-		constexpr auto SFENCE           = Op(215,  "sfence");
-		constexpr auto MFENCE           = Op(216,  "mfence");
-		constexpr auto CLFLUSH          = Op(217,  "clflush");
-
-		constexpr auto RDFSBASE         = Op(218,  "rdfsbase");
-		constexpr auto RDGSBASE         = Op(219,  "rdgsbase");
-		constexpr auto WRFSBASE         = Op(220,  "wrfsbase");
-		constexpr auto WRGSBASE         = Op(221,  "wrgsbase");
+		constexpr auto INVLPGA          = Op(193,  "invlpga",         Ext::SVM);
+
+		constexpr auto MONITOR          = Op(194,  "monitor",         Ext::SSE3);
+		constexpr auto MONITORX         = Op(195,  "monitorx",        Ext::MONITORX);
+		constexpr auto MWAIT            = Op(196,  "mwait",           Ext::SSE3);
+		constexpr auto MWAITX           = Op(197,  "mwaitx",          Ext::MONITORX);
+
+		constexpr auto XGETBV           = Op(198,  "xgetbv",          Ext::XSAVE);
+		constexpr auto XSETBV           = Op(199,  "xsetbv",          Ext::XSAVE);
+
+		constexpr auto VMCALL           = Op(200,  "vmcall",          Ext::VMX);
+		constexpr auto VMLOAD           = Op(201,  "vmload",          Ext::SVM);
+		constexpr auto VMSAVE           = Op(202,  "vmsave",          Ext::SVM);
+		constexpr auto VMRUN            = Op(203,  "vmrun",           Ext::SVM);
+
+		constexpr auto STGI             = Op(204,  "stgi",            Ext::SVM);
+		constexpr auto CLGI             = Op(205,  "clgi",            Ext::SVM);
+		constexpr auto SKINIT           = Op(206,  "skinit",          Ext::SVM);
+
+		constexpr auto FXSAVE           = Op(207,  "fxsave",          Ext::FXSR);
+		constexpr auto FXRSTOR          = Op(208,  "fxrstor",         Ext::FXSR);
+		constexpr auto LDMXCSR          = Op(209,  "ldmxcsr",         Ext::SSE);
+		constexpr auto STMXCSR          = Op(210,  "stmxcsr",         Ext::SSE);
+		constexpr auto XSAVE            = Op(211,  "xsave",           Ext::XSAVE);
+		constexpr auto XRSTOR           = Op(212,  "xrstor",          Ext::XSAVE);
+		constexpr auto XSAVEOPT         = Op(213,  "xsaveopt",        Ext::XSAVE);
+
+		constexpr auto LFENCE           = Op(214,  "lfence",          Ext::SSE2);
+		constexpr auto SFENCE           = Op(215,  "sfence",          Ext::SSE);
+		constexpr auto MFENCE           = Op(216,  "mfence",          Ext::SSE2);
+		constexpr auto CLFLUSH          = Op(217,  "clflush",         Ext::SSE2);
+
+		constexpr auto RDFSBASE         = Op(218,  "rdfsbase",        Ext::FSGSBASE);
+		constexpr auto RDGSBASE         = Op(219,  "rdgsbase",        Ext::FSGSBASE);
+		constexpr auto WRFSBASE         = Op(220,  "wrfsbase",        Ext::FSGSBASE);
+		constexpr auto WRGSBASE         = Op(221,  "wrgsbase",        Ext::FSGSBASE);
 
 		constexpr auto LDS              = Op(222,  "lds");
 		constexpr auto LES              = Op(223,  "les");
@@ -300,825 +346,830 @@ namespace instrad::x86
 		constexpr auto VERR             = Op(235,  "verr");
 		constexpr auto VERW             = Op(236,  "verw");
 
-		constexpr auto CMOVO            = Op(237,  "cmovo");
-		constexpr auto CMOVNO           = Op(238,  "cmovno");
-		constexpr auto CMOVB            = Op(239,  "cmovb");
-		constexpr auto CMOVNB           = Op(240,  "cmovnb");
-		constexpr auto CMOVZ            = Op(241,  "cmovz");
-		constexpr auto CMOVNZ           = Op(242,  "cmovnz");
-		constexpr auto CMOVBE           = Op(243,  "cmovbe");
-		constexpr auto CMOVNBE          = Op(244,  "cmovnbe");
-		constexpr auto CMOVS            = Op(245,  "cmovs");
-		constexpr auto CMOVNS           = Op(246,  "cmovns");
-		constexpr auto CMOVP            = Op(247,  "cmovp");
-		constexpr auto CMOVNP           = Op(248,  "cmovnp");
-		constexpr auto CMOVA            = Op(249,  "cmova");
-		constexpr auto CMOVNA           = Op(250,  "cmovna");
-		constexpr auto CMOVL            = Op(251,  "cmovl");
-		constexpr auto CMOVLE           = Op(252,  "cmovle");
-		constexpr auto CMOVG            = Op(253,  "cmovg");
-		constexpr auto CMOVGE           = Op(254,  "cmovge");
-
-		constexpr auto MOVUPS           = Op(255,  "movups");
-		constexpr auto MOVLPS           = Op(256,  "movlps");
-		constexpr auto MOVHLPS          = Op(257,  "movhlps");
-		constexpr auto UNPCKLPS         = Op(258,  "unpcklps");
-		constexpr auto UNPCKHPS         = Op(259,  "unpckhps");
-		constexpr auto MOVHPS           = Op(260,  "movhps");
-		constexpr auto MOVLHPS          = Op(261,  "movlhps");
-
-		constexpr auto MOVSS            = Op(262,  "movss");
-		constexpr auto MOVSLDUP         = Op(263,  "movsldup");
-		constexpr auto MOVSHDUP         = Op(264,  "movshdup");
-
-		constexpr auto MOVUPD           = Op(265,  "movupd");
-		constexpr auto MOVLPD           = Op(266,  "movlpd");
-		constexpr auto UNPCKLPD         = Op(267,  "unpcklpd");
-		constexpr auto UNPCKHPD         = Op(268,  "unpckhpd");
-		constexpr auto MOVHPD           = Op(269,  "movhpd");
-
-		constexpr auto MOVDDUP          = Op(270,  "movddup");
-
-		constexpr auto MOVMSKPS         = Op(271,  "movmskps");
-		constexpr auto SQRTPS           = Op(272,  "sqrtps");
-		constexpr auto RSQRTPS          = Op(273,  "rsqrtps");
-		constexpr auto RCPPS            = Op(274,  "rcpps");
-		constexpr auto ANDPS            = Op(275,  "andps");
-		constexpr auto ANDNPS           = Op(276,  "andnps");
-		constexpr auto ORPS             = Op(277,  "orps");
-		constexpr auto XORPS            = Op(278,  "xorps");
-
-		constexpr auto SQRTSS           = Op(279,  "sqrtss");
-		constexpr auto RSQRTSS          = Op(280,  "rsqrtss");
-		constexpr auto RCPSS            = Op(281,  "rcpss");
-
-		constexpr auto MOVMSKPD         = Op(282,  "movmskpd");
-		constexpr auto SQRTPD           = Op(283,  "sqrtpd");
-		constexpr auto ANDPD            = Op(284,  "andpd");
-		constexpr auto ANDNPD           = Op(285,  "andnpd");
-		constexpr auto ORPD             = Op(286,  "orpd");
-		constexpr auto XORPD            = Op(287,  "xorpd");
-		constexpr auto SQRTSD           = Op(288,  "sqrtsd");
-
-		constexpr auto PUNPCKLBW        = Op(289,  "punpcklbw");
-		constexpr auto PUNPCKLWD        = Op(290,  "punpcklwd");
-		constexpr auto PUNPCKLDQ        = Op(291,  "punpckldq");
-		constexpr auto PACKSSWB         = Op(292,  "packsswb");
-		constexpr auto PCMPGTB          = Op(293,  "pcmpgtb");
-		constexpr auto PCMPGTW          = Op(294,  "pcmpgtw");
-		constexpr auto PCMPGTD          = Op(295,  "pcmpgtd");
-		constexpr auto PACKUSWB         = Op(296,  "packuswb");
-
-		constexpr auto PSHUFW           = Op(297,  "pshufw");
-		constexpr auto PSHUFHW          = Op(298,  "pshufhw");
-		constexpr auto PSHUFD           = Op(299,  "pshufd");
-		constexpr auto PSHUFLW          = Op(300,  "pshuflw");
-		constexpr auto PCMPEQB          = Op(301,  "pcmpeqb");
-		constexpr auto PCMPEQW          = Op(302,  "pcmpeqw");
-		constexpr auto PCMPEQD          = Op(303,  "pcmpeqd");
-		constexpr auto EMMS             = Op(304,  "emms");
-
-		constexpr auto CMPPS            = Op(305,  "cmpps");
-		constexpr auto CMPSS            = Op(306,  "cmpss");
-		constexpr auto CMPPD            = Op(307,  "cmppd");
-		constexpr auto MOVNTI           = Op(308,  "movnti");
-		constexpr auto PINSRW           = Op(309,  "pinsrw");
-		constexpr auto PINSRQ           = Op(310,  "pinsrq");
-		constexpr auto PEXTRW           = Op(311,  "pextrw");
-		constexpr auto SHUFPS           = Op(312,  "pinsrw");
-		constexpr auto SHUFPD           = Op(313,  "pinsrw");
-		constexpr auto PSRLW            = Op(314,  "psrlw");
-		constexpr auto PSRLD            = Op(315,  "psrld");
-		constexpr auto PSRLQ            = Op(316,  "psrlq");
-		constexpr auto PSRLDQ           = Op(317,  "psrldq");
-		constexpr auto PADDQ            = Op(318,  "paddq");
-		constexpr auto PMULLW           = Op(319,  "pmullw");
-		constexpr auto PMOVMSKB         = Op(320,  "pmovmskb");
-		constexpr auto MOVQ2DQ          = Op(321,  "movq2dq");;
-		constexpr auto ADDSUBPD         = Op(322,  "addsubpd");
-		constexpr auto MOVQ             = Op(323,  "movq");
-		constexpr auto ADDSUBPS         = Op(324,  "addsubps");
-		constexpr auto MOVDQ2Q          = Op(325,  "movdq2q");
-		constexpr auto PAVGB            = Op(326,  "pavgb");
-		constexpr auto PSRAW            = Op(327,  "psraw");
-		constexpr auto PSRAD            = Op(328,  "psrad");
-		constexpr auto PAVGW            = Op(329,  "pavgw");
-		constexpr auto PMULHUW          = Op(330,  "pmulhuw");
-		constexpr auto PMULHW           = Op(331,  "pmulhw");
-		constexpr auto MOVNTQ           = Op(332,  "movntq");
-		constexpr auto CVTDQ2PS         = Op(333,  "cvtdq2ps");
-		constexpr auto CVTDQ2PD         = Op(334,  "cvtdq2pd");
-		constexpr auto CVTTPD2DQ        = Op(335,  "cvttpd2dq");
-		constexpr auto MOVNTDQ          = Op(336,  "movntdq");
-		constexpr auto CVTPD2DQ         = Op(337,  "cvtpd2dq");
-		constexpr auto PSLLW            = Op(338,  "psllw");
-		constexpr auto PSLLD            = Op(339,  "pslld");
-		constexpr auto PSLLQ            = Op(340,  "psllq");
-		constexpr auto PSLLDQ           = Op(341,  "pslldq");
-		constexpr auto PMULUDQ          = Op(342,  "pmuludq");
-		constexpr auto PMADDWD          = Op(343,  "pmaddwd");
-		constexpr auto PSADBW           = Op(344,  "psadbw");
-		constexpr auto MASKMOVQ         = Op(345,  "maskmovq");
-		constexpr auto MASKMOVDQU       = Op(346,  "maskmovdqu");
-		constexpr auto LDDQU            = Op(347,  "lddqu");
-		constexpr auto MOVAPS           = Op(348,  "movaps");
-		constexpr auto MOVAPD           = Op(349,  "movapd");
-		constexpr auto CVTPI2PS         = Op(350,  "cvtpi2ps");
-		constexpr auto MOVNTPS          = Op(351,  "movntps");
-		constexpr auto CVTTPS2PI        = Op(352,  "cvttps2pi");
-		constexpr auto CVTPS2PI         = Op(353,  "cvtps2pi");
-		constexpr auto UCOMISS          = Op(354,  "ucomiss");
-		constexpr auto COMISS           = Op(355,  "comiss");
-		constexpr auto CVTSI2SS         = Op(356,  "cvtsi2ss");
-		constexpr auto MOVNTSS          = Op(357,  "movntss");
-		constexpr auto CVTTSS2SI        = Op(358,  "cvttss2si");
-		constexpr auto CVTSS2SI         = Op(359,  "cvtss2si");
-		constexpr auto CVTPI2PD         = Op(360,  "cvtpi2pd");
-		constexpr auto MOVNTPD          = Op(361,  "movntpd");
-		constexpr auto CVTTPD2PI        = Op(362,  "cvttpd2pi");
-		constexpr auto CVTPD2PI         = Op(363,  "cvtpd2pi");
-		constexpr auto UCOMISD          = Op(364,  "ucomisd");
-		constexpr auto COMISD           = Op(365,  "comisd");
-		constexpr auto CVTSI2SD         = Op(366,  "cvtsi2sd");
-		constexpr auto MOVNTSD          = Op(367,  "movntsd");
-		constexpr auto CVTTSD2SI        = Op(368,  "cvttsd2si");
-		constexpr auto CVTSD2SI         = Op(369,  "cvtsd2si");
-		constexpr auto ADDPS            = Op(370,  "addps");
-		constexpr auto MULPS            = Op(371,  "mulps");
-		constexpr auto CVTPS2PD         = Op(372,  "cvtps2pd");
-		constexpr auto CVTPQ2PS         = Op(373,  "cvtpq2ps");
-		constexpr auto SUBPS            = Op(374,  "subps");
-		constexpr auto MINPS            = Op(375,  "minps");
-		constexpr auto DIVPS            = Op(376,  "divps");
-		constexpr auto MAXPS            = Op(377,  "maxps");
-		constexpr auto ADDSS            = Op(378,  "addss");
-		constexpr auto MULSS            = Op(379,  "mulss");
-		constexpr auto CVTSS2SD         = Op(380,  "cvtss2sd");
-		constexpr auto CVTTPS2DQ        = Op(381,  "cvttps2dq");
-		constexpr auto SUBSS            = Op(382,  "subss");
-		constexpr auto MINSS            = Op(383,  "minss");
-		constexpr auto DIVSS            = Op(384,  "divss");
-		constexpr auto MAXSS            = Op(385,  "maxss");
-		constexpr auto ADDPD            = Op(386,  "addpd");
-		constexpr auto MULPD            = Op(387,  "mulpd");
-		constexpr auto CVTPD2PS         = Op(388,  "cvtpd2ps");
-		constexpr auto CVTPS2DQ         = Op(389,  "cvtps2dq");
-		constexpr auto SUBPD            = Op(390,  "subpd");
-		constexpr auto MINPD            = Op(391,  "minpd");
-		constexpr auto DIVPD            = Op(392,  "divpd");
-		constexpr auto MAXPD            = Op(393,  "maxpd");
-		constexpr auto ADDSD            = Op(394,  "addsd");
-		constexpr auto MULSD            = Op(395,  "mulsd");
-		constexpr auto CVTSD2SS         = Op(396,  "cvtsd2ss");
-		constexpr auto SUBSD            = Op(397,  "subsd");
-		constexpr auto MINSD            = Op(398,  "minsd");
-		constexpr auto DIVSD            = Op(399,  "divsd");
-		constexpr auto MAXSD            = Op(400,  "maxsd");
-		constexpr auto PUNPCKHBW        = Op(401,  "punpckhbw");
-		constexpr auto PUNPCKHWD        = Op(402,  "punpckhwd");
-		constexpr auto PUNPCKHDQ        = Op(403,  "punpckhdq");
-		constexpr auto PACKSSDW         = Op(404,  "packssdw");
-		constexpr auto MOVD             = Op(405,  "movd");
-		constexpr auto MOVDQU           = Op(406,  "movdqu");
-		constexpr auto PUNPCKLQDQ       = Op(407,  "punpcklqdq");
-		constexpr auto PUNPCKHQDQ       = Op(408,  "punpckhqdq");
-		constexpr auto MOVDQA           = Op(409,  "movdqa");
-		constexpr auto EXTRQ            = Op(410,  "extrq");
-		constexpr auto HADDPD           = Op(411,  "haddpd");
-		constexpr auto HSUBPD           = Op(412,  "hsubpd");
-		constexpr auto INSERTQ          = Op(413,  "insertq");
-		constexpr auto HADDPS           = Op(414,  "haddps");
-		constexpr auto HSUBPS           = Op(415,  "hsubps");
-		constexpr auto TZCNT            = Op(416,  "tzcnt");
-		constexpr auto LZCNT            = Op(417,  "lzcnt");
-		constexpr auto POPCNT           = Op(418,  "popcnt");
-		constexpr auto PSUBUSB          = Op(419,  "psubusb");
-		constexpr auto PSUBUSW          = Op(420,  "psubusw");
-		constexpr auto PMINUB           = Op(421,  "pminub");
-		constexpr auto PAND             = Op(422,  "pand");
-		constexpr auto PADDUSB          = Op(423,  "paddusb");
-		constexpr auto PADDUSW          = Op(424,  "paddusw");
-		constexpr auto PMAXUB           = Op(425,  "pmaxub");
-		constexpr auto PANDN            = Op(426,  "pandn");
-		constexpr auto PSUBSB           = Op(427,  "psubsb");
-		constexpr auto PSUBSW           = Op(428,  "psubsw");
-		constexpr auto PMINSW           = Op(429,  "pminsw");
-		constexpr auto POR              = Op(430,  "por");
-		constexpr auto PADDSB           = Op(431,  "paddsb");
-		constexpr auto PADDSW           = Op(432,  "paddsw");
-		constexpr auto PMAXSW           = Op(433,  "pmaxsw");
-		constexpr auto PXOR             = Op(434,  "pxor");
-		constexpr auto PSUBB            = Op(435,  "psubb");
-		constexpr auto PSUBW            = Op(436,  "psubw");
-		constexpr auto PSUBD            = Op(437,  "psubd");
-		constexpr auto PSUBQ            = Op(438,  "psubq");
-		constexpr auto PADDB            = Op(439,  "paddb");
-		constexpr auto PADDW            = Op(440,  "paddw");
-		constexpr auto PADDD            = Op(441,  "paddd");
-
-		constexpr auto PSHUFB           = Op(442,  "pshufb");
-		constexpr auto PHADDW           = Op(443,  "phaddw");
-		constexpr auto PHADDD           = Op(444,  "phaddd");
-		constexpr auto PHADDSW          = Op(445,  "phaddsw");
-		constexpr auto PMADDUBSW        = Op(446,  "pmaddubsw");
-		constexpr auto PHSUBW           = Op(447,  "phsubw");
-		constexpr auto PHSUBD           = Op(448,  "phsubd");
-		constexpr auto PHSUBSW          = Op(449,  "phsubsw");
-
-		constexpr auto PSIGNB           = Op(450,  "psignb");
-		constexpr auto PSIGNW           = Op(451,  "psignw");
-		constexpr auto PSIGND           = Op(452,  "psignd");
-		constexpr auto PMULHRSW         = Op(453,  "pmulhrsw");
-
-		constexpr auto PBLENDVB         = Op(454,  "pblendvb");
-		constexpr auto BLENDVPS         = Op(455,  "blendvps");
-		constexpr auto BLENDVPD         = Op(456,  "blendvpd");
-		constexpr auto PTEST            = Op(457,  "ptest");
-		constexpr auto PMOVSXBW         = Op(458,  "pmovsxbw");
-		constexpr auto PMOVSXBD         = Op(459,  "pmovsxbd");
-		constexpr auto PMOVSXBQ         = Op(460,  "pmovsxbq");
-		constexpr auto PMOVSXWD         = Op(461,  "pmovsxwd");
-		constexpr auto PMOVSXWQ         = Op(462,  "pmovsxwq");
-		constexpr auto PMOVSXDQ         = Op(463,  "pmovsxdq");
-		constexpr auto PMOVZXBW         = Op(464,  "pmovzxbw");
-		constexpr auto PMOVZXBD         = Op(465,  "pmovzxbd");
-		constexpr auto PMOVZXBQ         = Op(466,  "pmovzxbq");
-		constexpr auto PMOVZXWD         = Op(467,  "pmovzxwd");
-		constexpr auto PMOVZXWQ         = Op(468,  "pmovzxwq");
-		constexpr auto PMOVZXDQ         = Op(469,  "pmovzxdq");
-		constexpr auto PCMPGTQ          = Op(470,  "pcmpgtq");
-		constexpr auto PMULLD           = Op(471,  "pmulld");
-		constexpr auto PHMINPOSUW       = Op(472,  "phminposuw");
-		constexpr auto MOVBE            = Op(473,  "movbe");
-		constexpr auto CRC32            = Op(474,  "crc32");
-		constexpr auto PABSB            = Op(475,  "pabsb");
-		constexpr auto PABSW            = Op(476,  "pabsw");
-		constexpr auto PABSD            = Op(477,  "pabsd");
-		constexpr auto PMULDQ           = Op(478,  "pmuldq");
-		constexpr auto PCMPEQQ          = Op(479,  "pcmpeqq");
-		constexpr auto MOVNTDQA         = Op(480,  "movntdqa");
-		constexpr auto PACKUSDW         = Op(481,  "packusdw");
-		constexpr auto PMINSB           = Op(482,  "pminsb");
-		constexpr auto PMINSD           = Op(483,  "pminsd");
-		constexpr auto PMINUW           = Op(484,  "pminuw");
-		constexpr auto PMINUD           = Op(485,  "pminud");
-		constexpr auto PMAXSB           = Op(486,  "pmaxsb");
-		constexpr auto PMAXSD           = Op(487,  "pmaxsd");
-		constexpr auto PMAXUW           = Op(488,  "pmaxuw");
-		constexpr auto PMAXUD           = Op(489,  "pmaxud");
-		constexpr auto AESIMC           = Op(490,  "aesimc");
-		constexpr auto AESENC           = Op(491,  "aesenc");
-		constexpr auto AESENCLAST       = Op(492,  "aesenclast");
-		constexpr auto AESDEC           = Op(493,  "aesdec");
-		constexpr auto AESDECLAST       = Op(494,  "aesdeclast");
-		constexpr auto PEXTRB           = Op(495,  "pextrb");
-		constexpr auto PEXTRD           = Op(496,  "pextrd");
-		constexpr auto EXTRACTPS        = Op(497,  "extractps");
-		constexpr auto PINSRB           = Op(498,  "pinsrb");
-		constexpr auto INSERTPS         = Op(499,  "insertps");
-		constexpr auto PINSRD           = Op(500,  "pinsrd");
-		constexpr auto DPPS             = Op(501,  "dpps");
-		constexpr auto DPPD             = Op(502,  "dppd");
-		constexpr auto MPSADBW          = Op(503,  "mpsadbw");
-		constexpr auto PCLMULQDQ        = Op(504,  "pclmulqdq");
-		constexpr auto PCMPESTRM        = Op(505,  "pcmpestrm");
-		constexpr auto PCMPESTRI        = Op(506,  "pcmpestri");
-		constexpr auto PCMPISTRM        = Op(507,  "pcmpistrm");
-		constexpr auto PCMPISTRI        = Op(508,  "pcmpistri");
-		constexpr auto PALIGNR          = Op(509,  "palignr");
-		constexpr auto ROUNDPS          = Op(510,  "roundps");
-		constexpr auto ROUNDPD          = Op(511,  "roundpd");
-		constexpr auto ROUNDSS          = Op(512,  "roundss");
-		constexpr auto ROUNDSD          = Op(513,  "roundsd");
-		constexpr auto BLENDPS          = Op(514,  "blendps");
-		constexpr auto BLENDPD          = Op(515,  "blendpd");
-		constexpr auto PBLENDW          = Op(516,  "pblendw");
+		constexpr auto CMOVO            = Op(237,  "cmovo",           Ext::CMOV);
+		constexpr auto CMOVNO           = Op(238,  "cmovno",          Ext::CMOV);
+		constexpr auto CMOVB            = Op(239,  "cmovb",           Ext::CMOV);
+		constexpr auto CMOVNB           = Op(240,  "cmovnb",          Ext::CMOV);
+		constexpr auto CMOVZ            = Op(241,  "cmovz",           Ext::CMOV);
+		constexpr auto CMOVNZ           = Op(242,  "cmovnz",          Ext::CMOV);
+		constexpr auto CMOVBE           = Op(243,  "cmovbe",          Ext::CMOV);
+		constexpr auto CMOVNBE          = Op(244,  "cmovnbe",         Ext::CMOV);
+		constexpr auto CMOVS            = Op(245,  "cmovs",           Ext::CMOV);
+		constexpr auto CMOVNS           = Op(246,  "cmovns",          Ext::CMOV);
+		constexpr auto CMOVP            = Op(247,  "cmovp",           Ext::CMOV);
+		constexpr auto CMOVNP           = Op(248,  "cmovnp",          Ext::CMOV);
+		constexpr auto CMOVA            = Op(249,  "cmova",           Ext::CMOV);
+		constexpr auto CMOVNA           = Op(250,  "cmovna",          Ext::CMOV);
+		constexpr auto CMOVL            = Op(251,  "cmovl",           Ext::CMOV);
+		constexpr auto CMOVLE           = Op(252,  "cmovle",          Ext::CMOV);
+		constexpr auto CMOVG            = Op(253,  "cmovg",           Ext::CMOV);
+		constexpr auto CMOVGE           = Op(254,  "cmovge",          Ext::CMOV);
+
+		constexpr auto MOVUPS           = Op(255,  "movups",          Ext::SSE);
+		constexpr auto MOVLPS           = Op(256,  "movlps",          Ext::SSE);
+		constexpr auto MOVHLPS          = Op(257,  "movhlps",         Ext::SSE);
+		constexpr auto UNPCKLPS         = Op(258,  "unpcklps",        Ext::SSE);
+		constexpr auto UNPCKHPS         = Op(259,  "unpckhps",        Ext::SSE);
+		constexpr auto MOVHPS           = Op(260,  "movhps",          Ext::SSE);
+		constexpr auto MOVLHPS          = Op(261,  "movlhps",         Ext::SSE);
+
+		constexpr auto MOVSS            = Op(262,  "movss",           Ext::SSE);
+		constexpr auto MOVSLDUP         = Op(263,  "movsldup",        Ext::SSE3);
+		constexpr auto MOVSHDUP         = Op(264,  "movshdup",        Ext::SSE3);
+
+		constexpr auto MOVUPD           = Op(265,  "movupd",          Ext::SSE2);
+		constexpr auto MOVLPD           = Op(266,  "movlpd",          Ext::SSE2);
+		constexpr auto UNPCKLPD         = Op(267,  "unpcklpd",        Ext::SSE2);
+		constexpr auto UNPCKHPD         = Op(268,  "unpckhpd",        Ext::SSE2);
+		constexpr auto MOVHPD           = Op(269,  "movhpd",          Ext::SSE2);
+
+		constexpr auto MOVDDUP          = Op(270,  "movddup",         Ext::SSE3);
+
+		constexpr auto MOVMSKPS         = Op(271,  "movmskps",        Ext::SSE);
+		constexpr auto SQRTPS           = Op(272,  "sqrtps",          Ext::SSE);
+		constexpr auto RSQRTPS          = Op(273,  "rsqrtps",         Ext::SSE);
+		constexpr auto RCPPS            = Op(274,  "rcpps",           Ext::SSE);
+		constexpr auto ANDPS            = Op(275,  "andps",           Ext::SSE);
+		constexpr auto ANDNPS           = Op(276,  "andnps",          Ext::SSE);
+		constexpr auto ORPS             = Op(277,  "orps",            Ext::SSE);
+		constexpr auto XORPS            = Op(278,  "xorps",           Ext::SSE);
+
+		constexpr auto SQRTSS           = Op(279,  "sqrtss",          Ext::SSE);
+		constexpr auto RSQRTSS          = Op(280,  "rsqrtss",         Ext::SSE);
+		constexpr auto RCPSS            = Op(281,  "rcpss",           Ext::SSE);
+
+		constexpr auto MOVMSKPD         = Op(282,  "movmskpd",        Ext::SSE2);
+		constexpr auto SQRTPD           = Op(283,  "sqrtpd",          Ext::SSE2);
+		constexpr auto ANDPD            = Op(284,  "andpd",           Ext::SSE2);
+		constexpr auto ANDNPD           = Op(285,  "andnpd",          Ext::SSE2);
+		constexpr auto ORPD             = Op(286,  "orpd",            Ext::SSE2);
+		constexpr auto XORPD            = Op(287,  "xorpd",           Ext::SSE2);
+		constexpr auto SQRTSD           = Op(288,  "sqrtsd",          Ext::SSE2);
+
+		constexpr auto PUNPCKLBW        = Op(289,  "punpcklbw",       Ext::MMX);
+		constexpr auto PUNPCKLWD        = Op(290,  "punpcklwd",       Ext::MMX);
+		constexpr auto PUNPCKLDQ        = Op(291,  "punpckldq",       Ext::MMX);
+		constexpr auto PACKSSWB         = Op(292,  "packsswb",        Ext::MMX);
+		constexpr auto PCMPGTB          = Op(293,  "pcmpgtb",         Ext::MMX);
+		constexpr auto PCMPGTW          = Op(294,  "pcmpgtw",         Ext::MMX);
+		constexpr auto PCMPGTD          = Op(295,  "pcmpgtd",         Ext::MMX);
+		constexpr auto PACKUSWB         = Op(296,  "packuswb",        Ext::MMX);
+
+		constexpr auto PSHUFW           = Op(297,  "pshufw",          Ext::SSE);
+		constexpr auto PSHUFHW          = Op(298,  "pshufhw",         Ext::SSE2);
+		constexpr auto PSHUFD           = Op(299,  "pshufd",          Ext::SSE2);
+		constexpr auto PSHUFLW          = Op(300,  "pshuflw",         Ext::SSE2);
+		constexpr auto PCMPEQB          = Op(301,  "pcmpeqb",         Ext::MMX);
+		constexpr auto PCMPEQW          = Op(302,  "pcmpeqw",         Ext::MMX);
+		constexpr auto PCMPEQD          = Op(303,  "pcmpeqd",         Ext::MMX);
+		constexpr auto EMMS             = Op(304,  "emms",            Ext::MMX);
+
+		constexpr auto CMPPS            = Op(305,  "cmpps",           Ext::SSE);
+		constexpr auto CMPSS            = Op(306,  "cmpss",           Ext::SSE);
+		constexpr auto CMPPD            = Op(307,  "cmppd",           Ext::SSE2);
+		constexpr auto MOVNTI           = Op(308,  "movnti",          Ext::SSE2);
+		constexpr auto PINSRW           = Op(309,  "pinsrw",          Ext::SSE);
+		constexpr auto PINSRQ           = Op(310,  "pinsrq",          Ext::SSE41);
+		constexpr auto PEXTRW           = Op(311,  "pextrw",          Ext::SSE);
+		constexpr auto SHUFPS           = Op(312,  "shufps",          Ext::SSE);
+		constexpr auto SHUFPD           = Op(313,  "shufpd",          Ext::SSE2);
+		constexpr auto PSRLW            = Op(314,  "psrlw",           Ext::MMX);
+		constexpr auto PSRLD            = Op(315,  "psrld",           Ext::MMX);
+		constexpr auto PSRLQ            = Op(316,  "psrlq",           Ext::MMX);
+		constexpr auto PSRLDQ           = Op(317,  "psrldq",          Ext::SSE2);
+		constexpr auto PADDQ            = Op(318,  "paddq",           Ext::SSE2);
+		constexpr auto PMULLW           = Op(319,  "pmullw",          Ext::MMX);
+		constexpr auto PMOVMSKB         = Op(320,  "pmovmskb",        Ext::SSE);
+		constexpr auto MOVQ2DQ          = Op(321,  "movq2dq",         Ext::SSE2);
+		constexpr auto ADDSUBPD         = Op(322,  "addsubpd",        Ext::SSE3);
+		constexpr auto MOVQ             = Op(323,  "movq",            Ext::MMX);
+		constexpr auto ADDSUBPS         = Op(324,  "addsubps",        Ext::SSE3);
+		constexpr auto MOVDQ2Q          = Op(325,  "movdq2q",         Ext::SSE2);
+		constexpr auto PAVGB            = Op(326,  "pavgb",           Ext::SSE);
+		constexpr auto PSRAW            = Op(327,  "psraw",           Ext::MMX);
+		constexpr auto PSRAD            = Op(328,  "psrad",           Ext::MMX);
+		constexpr auto PAVGW            = Op(329,  "pavgw",           Ext::SSE);
+		constexpr auto PMULHUW          = Op(330,  "pmulhuw",         Ext::SSE);
+		constexpr auto PMULHW           = Op(331,  "pmulhw",          Ext::MMX);
+		constexpr auto MOVNTQ           = Op(332,  "movntq",          Ext::SSE);
+		constexpr auto CVTDQ2PS         = Op(333,  "cvtdq2ps",        Ext::SSE2);
+		constexpr auto CVTDQ2PD         = Op(334,  "cvtdq2pd",        Ext::SSE2);
+		constexpr auto CVTTPD2DQ        = Op(335,  "cvttpd2dq",       Ext::SSE2);
+		constexpr auto MOVNTDQ          = Op(336,  "movntdq",         Ext::SSE2);
+		constexpr auto CVTPD2DQ         = Op(337,  "cvtpd2dq",        Ext::SSE2);
+		constexpr auto PSLLW            = Op(338,  "psllw",           Ext::MMX);
+		constexpr auto PSLLD            = Op(339,  "pslld",           Ext::MMX);
+		constexpr auto PSLLQ            = Op(340,  "psllq",           Ext::MMX);
+		constexpr auto PSLLDQ           = Op(341,  "pslldq",          Ext::SSE2);
+		constexpr auto PMULUDQ          = Op(342,  "pmuludq",         Ext::SSE2);
+		constexpr auto PMADDWD          = Op(343,  "pmaddwd",         Ext::MMX);
+		constexpr auto PSADBW           = Op(344,  "psadbw",          Ext::SSE);
+		constexpr auto MASKMOVQ         = Op(345,  "maskmovq",        Ext::SSE);
+		constexpr auto MASKMOVDQU       = Op(346,  "maskmovdqu",      Ext::SSE2);
+		constexpr auto LDDQU            = Op(347,  "lddqu",           Ext::SSE3);
+		constexpr auto MOVAPS           = Op(348,  "movaps",          Ext::SSE);
+		constexpr auto MOVAPD           = Op(349,  "movapd",          Ext::SSE2);
+		constexpr auto CVTPI2PS         = Op(350,  "cvtpi2ps",        Ext::SSE);
+		constexpr auto MOVNTPS          = Op(351,  "movntps",         Ext::SSE);
+		constexpr auto CVTTPS2PI        = Op(352,  "cvttps2pi",       Ext::SSE);
+		constexpr auto CVTPS2PI         = Op(353,  "cvtps2pi",        Ext::SSE);
+		constexpr auto UCOMISS          = Op(354,  "ucomiss",         Ext::SSE);
+		constexpr auto COMISS           = Op(355,  "comiss",          Ext::SSE);
+		constexpr auto CVTSI2SS         = Op(356,  "cvtsi2ss",        Ext::SSE);
+		constexpr auto MOVNTSS          = Op(357,  "movntss",         Ext::SSE4A);
+		constexpr auto CVTTSS2SI        = Op(358,  "cvttss2si",       Ext::SSE);
+		constexpr auto CVTSS2SI         = Op(359,  "cvtss2si",        Ext::SSE);
+		constexpr auto CVTPI2PD         = Op(360,  "cvtpi2pd",        Ext::SSE2);
+		constexpr auto MOVNTPD          = Op(361,  "movntpd",         Ext::SSE2);
+		constexpr auto CVTTPD2PI        = Op(362,  "cvttpd2pi",       Ext::SSE2);
+		constexpr auto CVTPD2PI         = Op(363,  "cvtpd2pi",        Ext::SSE2);
+		constexpr auto UCOMISD          = Op(364,  "ucomisd",         Ext::SSE2);
+		constexpr auto COMISD           = Op(365,  "comisd",          Ext::SSE2);
+		constexpr auto CVTSI2SD         = Op(366,  "cvtsi2sd",        Ext::SSE2);
+		constexpr auto MOVNTSD          = Op(367,  "movntsd",         Ext::SSE4A);
+		constexpr auto CVTTSD2SI        = Op(368,  "cvttsd2si",       Ext::SSE2);
+		constexpr auto CVTSD2SI         = Op(369,  "cvtsd2si",        Ext::SSE2);
+		constexpr auto ADDPS            = Op(370,  "addps",           Ext::SSE);
+		constexpr auto MULPS            = Op(371,  "mulps",           Ext::SSE);
+		constexpr auto CVTPS2PD         = Op(372,  "cvtps2pd",        Ext::SSE2);
+		constexpr auto CVTPQ2PS         = Op(373,  "cvtpq2ps",        Ext::SSE2);
+		constexpr auto SUBPS            = Op(374,  "subps",           Ext::SSE);
+		constexpr auto MINPS            = Op(375,  "minps",           Ext::SSE);
+		constexpr auto DIVPS            = Op(376,  "divps",           Ext::SSE);
+		constexpr auto MAXPS            = Op(377,  "maxps",           Ext::SSE);
+		constexpr auto ADDSS            = Op(378,  "addss",           Ext::SSE);
+		constexpr auto MULSS            = Op(379,  "mulss",           Ext::SSE);
+		constexpr auto CVTSS2SD         = Op(380,  "cvtss2sd",        Ext::SSE2);
+		constexpr auto CVTTPS2DQ        = Op(381,  "cvttps2dq",       Ext::SSE2);
+		constexpr auto SUBSS            = Op(382,  "subss",           Ext::SSE);
+		constexpr auto MINSS            = Op(383,  "minss",           Ext::SSE);
+		constexpr auto DIVSS            = Op(384,  "divss",           Ext::SSE);
+		constexpr auto MAXSS            = Op(385,  "maxss",           Ext::SSE);
+		constexpr auto ADDPD            = Op(386,  "addpd",           Ext::SSE2);
+		constexpr auto MULPD            = Op(387,  "mulpd",           Ext::SSE2);
+		constexpr auto CVTPD2PS         = Op(388,  "cvtpd2ps",        Ext::SSE2);
+		constexpr auto CVTPS2DQ         = Op(389,  "cvtps2dq",        Ext::SSE2);
+		constexpr auto SUBPD            = Op(390,  "subpd",           Ext::SSE2);
+		constexpr auto MINPD            = Op(391,  "minpd",           Ext::SSE2);
+		constexpr auto DIVPD            = Op(392,  "divpd",           Ext::SSE2);
+		constexpr auto MAXPD            = Op(393,  "maxpd",           Ext::SSE2);
+		constexpr auto ADDSD            = Op(394,  "addsd",           Ext::SSE2);
+		constexpr auto MULSD            = Op(395,  "mulsd",           Ext::SSE2);
+		constexpr auto CVTSD2SS         = Op(396,  "cvtsd2ss",        Ext::SSE2);
+		constexpr auto SUBSD            = Op(397,  "subsd",           Ext::SSE2);
+		constexpr auto MINSD            = Op(398,  "minsd",           Ext::SSE2);
+		constexpr auto DIVSD            = Op(399,  "divsd",           Ext::SSE2);
+		constexpr auto MAXSD            = Op(400,  "maxsd",           Ext::SSE2);
+		constexpr auto PUNPCKHBW        = Op(401,  "punpckhbw",       Ext::MMX);
+		constexpr auto PUNPCKHWD        = Op(402,  "punpckhwd",       Ext::MMX);
+		constexpr auto PUNPCKHDQ        = Op(403,  "punpckhdq",       Ext::MMX);
+		constexpr auto PACKSSDW         = Op(404,  "packssdw",        Ext::MMX);
+		constexpr auto MOVD             = Op(405,  "movd",            Ext::MMX);
+		constexpr auto MOVDQU           = Op(406,  "movdqu",          Ext::SSE2);
+		constexpr auto PUNPCKLQDQ       = Op(407,  "punpcklqdq",      Ext::SSE2);
+		constexpr auto PUNPCKHQDQ       = Op(408,  "punpckhqdq",      Ext::SSE2);
+		constexpr auto MOVDQA           = Op(409,  "movdqa",          Ext::SSE2);
+		constexpr auto EXTRQ            = Op(410,  "extrq",           Ext::SSE4A);
+		constexpr auto HADDPD           = Op(411,  "haddpd",          Ext::SSE3);
+		constexpr auto HSUBPD           = Op(412,  "hsubpd",          Ext::SSE3);
+		constexpr auto INSERTQ          = Op(413,  "insertq",         Ext::SSE4A);
+		constexpr auto HADDPS           = Op(414,  "haddps",          Ext::SSE3);
+		constexpr auto HSUBPS           = Op(415,  "hsubps",          Ext::SSE3);
+		constexpr auto TZCNT            = Op(416,  "tzcnt",           Ext::BMI1);
+		constexpr auto LZCNT            = Op(417,  "lzcnt",           Ext::LZCNT);
+		constexpr auto POPCNT           = Op(418,  "popcnt",          Ext::POPCNT);
+		constexpr auto PSUBUSB          = Op(419,  "psubusb",         Ext::MMX);
+		constexpr auto PSUBUSW          = Op(420,  "psubusw",         Ext::MMX);
+		constexpr auto PMINUB           = Op(421,  "pminub",          Ext::SSE);
+		constexpr auto PAND             = Op(422,  "pand",            Ext::MMX);
+		constexpr auto PADDUSB          = Op(423,  "paddusb",         Ext::MMX);
+		constexpr auto PADDUSW          = Op(424,  "paddusw",         Ext::MMX);
+		constexpr auto PMAXUB           = Op(425,  "pmaxub",          Ext::SSE);
+		constexpr auto PANDN            = Op(426,  "pandn",           Ext::MMX);
+		constexpr auto PSUBSB           = Op(427,  "psubsb",          Ext::MMX);
+		constexpr auto PSUBSW           = Op(428,  "psubsw",          Ext::MMX);
+		constexpr auto PMINSW           = Op(429,  "pminsw",          Ext::SSE);
+		constexpr auto POR              = Op(430,  "por",             Ext::MMX);
+		constexpr auto PADDSB           = Op(431,  "paddsb",          Ext::MMX);
+		constexpr auto PADDSW           = Op(432,  "paddsw",          Ext::MMX);
+		constexpr auto PMAXSW           = Op(433,  "pmaxsw",          Ext::SSE);
+		constexpr auto PXOR             = Op(434,  "pxor",            Ext::MMX);
+		constexpr auto PSUBB            = Op(435,  "psubb",           Ext::MMX);
+		constexpr auto PSUBW            = Op(436,  "psubw",           Ext::MMX);
+		constexpr auto PSUBD            = Op(437,  "psubd",           Ext::MMX);
+		constexpr auto PSUBQ            = Op(438,  "psubq",           Ext::SSE2);
+		constexpr auto PADDB            = Op(439,  "paddb",           Ext::MMX);
+		constexpr auto PADDW            = Op(440,  "paddw",           Ext::MMX);
+		constexpr auto PADDD            = Op(441,  "paddd",           Ext::MMX);
+
+		constexpr auto PSHUFB           = Op(442,  "pshufb",          Ext::SSSE3);
+		constexpr auto PHADDW           = Op(443,  "phaddw",          Ext::SSSE3);
+		constexpr auto PHADDD           = Op(444,  "phaddd",          Ext::SSSE3);
+		constexpr auto PHADDSW          = Op(445,  "phaddsw",         Ext::SSSE3);
+		constexpr auto PMADDUBSW        = Op(446,  "pmaddubsw",       Ext::SSSE3);
+		constexpr auto PHSUBW           = Op(447,  "phsubw",          Ext::SSSE3);
+		constexpr auto PHSUBD           = Op(448,  "phsubd",          Ext::SSSE3);
+		constexpr auto PHSUBSW          = Op(449,  "phsubsw",         Ext::SSSE3);
+
+		constexpr auto PSIGNB           = Op(450,  "psignb",          Ext::SSSE3);
+		constexpr auto PSIGNW           = Op(451,  "psignw",          Ext::SSSE3);
+		constexpr auto PSIGND           = Op(452,  "psignd",          Ext::SSSE3);
+		constexpr auto PMULHRSW         = Op(453,  "pmulhrsw",        Ext::SSSE3);
+
+		constexpr auto PBLENDVB         = Op(454,  "pblendvb",        Ext::SSE41);
+		constexpr auto BLENDVPS         = Op(455,  "blendvps",        Ext::SSE41);
+		constexpr auto BLENDVPD         = Op(456,  "blendvpd",        Ext::SSE41);
+		constexpr auto PTEST            = Op(457,  "ptest",           Ext::SSE41);
+		constexpr auto PMOVSXBW         = Op(458,  "pmovsxbw",        Ext::SSE41);
+		constexpr auto PMOVSXBD         = Op(459,  "pmovsxbd",        Ext::SSE41);
+		constexpr auto PMOVSXBQ         = Op(460,  "pmovsxbq",        Ext::SSE41);
+		constexpr auto PMOVSXWD         = Op(461,  "pmovsxwd",        Ext::SSE41);
+		constexpr auto PMOVSXWQ         = Op(462,  "pmovsxwq",        Ext::SSE41);
+		constexpr auto PMOVSXDQ         = Op(463,  "pmovsxdq",        Ext::SSE41);
+		constexpr auto PMOVZXBW         = Op(464,  "pmovzxbw",        Ext::SSE41);
+		constexpr auto PMOVZXBD         = Op(465,  "pmovzxbd",        Ext::SSE41);
+		constexpr auto PMOVZXBQ         = Op(466,  "pmovzxbq",        Ext::SSE41);
+		constexpr auto PMOVZXWD         = Op(467,  "pmovzxwd",        Ext::SSE41);
+		constexpr auto PMOVZXWQ         = Op(468,  "pmovzxwq",        Ext::SSE41);
+		constexpr auto PMOVZXDQ         = Op(469,  "pmovzxdq",        Ext::SSE41);
+		constexpr auto PCMPGTQ          = Op(470,  "pcmpgtq",         Ext::SSE42);
+		constexpr auto PMULLD           = Op(471,  "pmulld",          Ext::SSE41);
+		constexpr auto PHMINPOSUW       = Op(472,  "phminposuw",      Ext::SSE41);
+		constexpr auto MOVBE            = Op(473,  "movbe",           Ext::MOVBE);
+		constexpr auto CRC32            = Op(474,  "crc32",           Ext::SSE42);
+		constexpr auto PABSB            = Op(475,  "pabsb",           Ext::SSSE3);
+		constexpr auto PABSW            = Op(476,  "pabsw",           Ext::SSSE3);
+		constexpr auto PABSD            = Op(477,  "pabsd",           Ext::SSSE3);
+		constexpr auto PMULDQ           = Op(478,  "pmuldq",          Ext::SSE41);
+		constexpr auto PCMPEQQ          = Op(479,  "pcmpeqq",         Ext::SSE41);
+		constexpr auto MOVNTDQA         = Op(480,  "movntdqa",        Ext::SSE41);
+		constexpr auto PACKUSDW         = Op(481,  "packusdw",        Ext::SSE41);
+		constexpr auto PMINSB           = Op(482,  "pminsb",          Ext::SSE41);
+		constexpr auto PMINSD           = Op(483,  "pminsd",          Ext::SSE41);
+		constexpr auto PMINUW           = Op(484,  "pminuw",          Ext::SSE41);
+		constexpr auto PMINUD           = Op(485,  "pminud",          Ext::SSE41);
+		constexpr auto PMAXSB           = Op(486,  "pmaxsb",          Ext::SSE41);
+		constexpr auto PMAXSD           = Op(487,  "pmaxsd",          Ext::SSE41);
+		constexpr auto PMAXUW           = Op(488,  "pmaxuw",          Ext::SSE41);
+		constexpr auto PMAXUD           = Op(489,  "pmaxud",          Ext::SSE41);
+		constexpr auto AESIMC           = Op(490,  "aesimc",          Ext::AES);
+		constexpr auto AESENC           = Op(491,  "aesenc",          Ext::AES);
+		constexpr auto AESENCLAST       = Op(492,  "aesenclast",      Ext::AES);
+		constexpr auto AESDEC           = Op(493,  "aesdec",          Ext::AES);
+		constexpr auto AESDECLAST       = Op(494,  "aesdeclast",      Ext::AES);
+		constexpr auto PEXTRB           = Op(495,  "pextrb",          Ext::SSE41);
+		constexpr auto PEXTRD           = Op(496,  "pextrd",          Ext::SSE41);
+		constexpr auto EXTRACTPS        = Op(497,  "extractps",       Ext::SSE41);
+		constexpr auto PINSRB           = Op(498,  "pinsrb",          Ext::SSE41);
+		constexpr auto INSERTPS         = Op(499,  "insertps",        Ext::SSE41);
+		constexpr auto PINSRD           = Op(500,  "pinsrd",          Ext::SSE41);
+		constexpr auto DPPS             = Op(501,  "dpps",            Ext::SSE41);
+		constexpr auto DPPD             = Op(502,  "dppd",            Ext::SSE41);
+		constexpr auto MPSADBW          = Op(503,  "mpsadbw",         Ext::SSE41);
+		constexpr auto PCLMULQDQ        = Op(504,  "pclmulqdq",       Ext::CLMUL);
+		constexpr auto PCMPESTRM        = Op(505,  "pcmpestrm",       Ext::SSE42);
+		constexpr auto PCMPESTRI        = Op(506,  "pcmpestri",       Ext::SSE42);
+		constexpr auto PCMPISTRM        = Op(507,  "pcmpistrm",       Ext::SSE42);
+		constexpr auto PCMPISTRI        = Op(508,  "pcmpistri",       Ext::SSE42);
+		constexpr auto PALIGNR          = Op(509,  "palignr",         Ext::SSSE3);
+		constexpr auto ROUNDPS          = Op(510,  "roundps",         Ext::SSE41);
+		constexpr auto ROUNDPD          = Op(511,  "roundpd",         Ext::SSE41);
+		constexpr auto ROUNDSS          = Op(512,  "roundss",         Ext::SSE41);
+		constexpr auto ROUNDSD          = Op(513,  "roundsd",         Ext::SSE41);
+		constexpr auto BLENDPS          = Op(514,  "blendps",         Ext::SSE41);
+		constexpr auto BLENDPD          = Op(515,  "blendpd",         Ext::SSE41);
+		constexpr auto PBLENDW          = Op(516,  "pblendw",         Ext::SSE41);
 
 		// uwu
-		constexpr auto AESKEYGENASSIST  = Op(517,  "aeskeygenassist");
+		constexpr auto AESKEYGENASSIST  = Op(517,  "aeskeygenassist", Ext::AES);
 
 
 		// 3dnow
-		constexpr auto PFCMPGE          = Op(518,  "pfcmpge");
-		constexpr auto PFMIN            = Op(519,  "pfmin");
-		constexpr auto PFRCP            = Op(520,  "pfrcp");
-		constexpr auto PFRSQRT          = Op(521,  "pfrsqrt");
-		constexpr auto PFCMPGT          = Op(522,  "pfcmpgt");
-		constexpr auto PFMAX            = Op(523,  "pfmax");
-		constexpr auto PFRCPIT1         = Op(524,  "pfrcpit1");
-		constexpr auto PFRSQIT1         = Op(525,  "pfrsqit1");
-		constexpr auto PFCMPEQ          = Op(526,  "pfcmpeq");
-		constexpr auto PFMUL            = Op(527,  "pfmul");
-		constexpr auto PFRCPIT2         = Op(528,  "pfrcpit2");
-		constexpr auto PMULHRW          = Op(529,  "pmulhrw");
-		constexpr auto PI2FW            = Op(530,  "pi2fw");
-		constexpr auto PI2FD            = Op(531,  "pi2fd");
-		constexpr auto PF2IW            = Op(532,  "pf2iw");
-		constexpr auto PF2ID            = Op(533,  "pf2id");
-		constexpr auto PFNACC           = Op(534,  "pfnacc");
-		constexpr auto PFPNACC          = Op(535,  "pfpnacc");
-		constexpr auto PFSUB            = Op(536,  "pfsub");
-		constexpr auto PFADD            = Op(537,  "pfadd");
-		constexpr auto PFSUBR           = Op(538,  "pfsubr");
-		constexpr auto PFACC            = Op(539,  "pfacc");
-		constexpr auto PSWAPD           = Op(540,  "pswapd");
-		constexpr auto PAVGUSB          = Op(541,  "pavgusb");
+		constexpr auto PFCMPGE          = Op(518,  "pfcmpge",         Ext::AMD3DNOW);
+		constexpr auto PFMIN            = Op(519,  "pfmin",           Ext::AMD3DNOW);
+		constexpr auto PFRCP            = Op(520,  "pfrcp",           Ext::AMD3DNOW);
+		constexpr auto PFRSQRT          = Op(521,  "pfrsqrt",         Ext::AMD3DNOW);
+		constexpr auto PFCMPGT          = Op(522,  "pfcmpgt",         Ext::AMD3DNOW);
+		constexpr auto PFMAX            = Op(523,  "pfmax",           Ext::AMD3DNOW);
+		constexpr auto PFRCPIT1         = Op(524,  "pfrcpit1",        Ext::AMD3DNOW);
+		constexpr auto PFRSQIT1         = Op(525,  "pfrsqit1",        Ext::AMD3DNOW);
+		constexpr auto PFCMPEQ          = Op(526,  "pfcmpeq",         Ext::AMD3DNOW);
+		constexpr auto PFMUL            = Op(527,  "pfmul",           Ext::AMD3DNOW);
+		constexpr auto PFRCPIT2         = Op(528,  "pfrcpit2",        Ext::AMD3DNOW);
+		constexpr auto PMULHRW          = Op(529,  "pmulhrw",         Ext::AMD3DNOW);
+		constexpr auto PI2FW            = Op(530,  "pi2fw",           Ext::AMD3DNOW);
+		constexpr auto PI2FD            = Op(531,  "pi2fd",           Ext::AMD3DNOW);
+		constexpr auto PF2IW            = Op(532,  "pf2iw",           Ext::AMD3DNOW);
+		constexpr auto PF2ID            = Op(533,  "pf2id",           Ext::AMD3DNOW);
+		constexpr auto PFNACC           = Op(534,  "pfnacc",          Ext::AMD3DNOW);
+		constexpr auto PFPNACC          = Op(535,  "pfpnacc",         Ext::AMD3DNOW);
+		constexpr auto PFSUB            = Op(536,  "pfsub",           Ext::AMD3DNOW);
+		constexpr auto PFADD            = Op(537,  "pfadd",           Ext::AMD3DNOW);
+		constexpr auto PFSUBR           = Op(538,  "pfsubr",          Ext::AMD3DNOW);
+		constexpr auto PFACC            = Op(539,  "pfacc",           Ext::AMD3DNOW);
+		constexpr auto PSWAPD           = Op(540,  "pswapd",          Ext::AMD3DNOW);
+		constexpr auto PAVGUSB          = Op(541,  "pavgusb",         Ext::AMD3DNOW);
 
 
 		// x87
-		constexpr auto FLD              = Op(542,  "fld");
-		constexpr auto FST              = Op(543,  "fst");
-		constexpr auto FSTP             = Op(544,  "fstp");
-		constexpr auto FLDENV           = Op(545,  "fldenv");
-		constexpr auto FLDCW            = Op(546,  "fldcw");
-		constexpr auto FNSTENV          = Op(547,  "fnstenv");
-		constexpr auto FNSTCW           = Op(548,  "fnstcw");
-		constexpr auto FXCH             = Op(549,  "fxch");
-		constexpr auto FNOP             = Op(550,  "fnop");
-		constexpr auto FCHS             = Op(551,  "fchs");
-		constexpr auto FABS             = Op(552,  "fabs");
-		constexpr auto FTST             = Op(553,  "ftst");
-		constexpr auto FXAM             = Op(554,  "fxam");
-		constexpr auto FLD1             = Op(555,  "fld1");
-		constexpr auto FLDL2T           = Op(556,  "fldl2t");
-		constexpr auto FLDL2E           = Op(557,  "fldl2e");
-		constexpr auto FLDPI            = Op(558,  "fldpi");
-		constexpr auto FLDLG2           = Op(559,  "fldlg2");
-		constexpr auto FLDLN2           = Op(560,  "fldln2");
-		constexpr auto FLDZ             = Op(561,  "fldz");
-		constexpr auto F2XM1            = Op(562,  "f2xm1");
-		constexpr auto FYL2X            = Op(563,  "fyl2x");
-		constexpr auto FPTAN            = Op(564,  "fptan");
-		constexpr auto FPATAN           = Op(565,  "fpatan");
-		constexpr auto FXTRACT          = Op(566,  "fxtract");
-		constexpr auto FPREM1           = Op(567,  "fprem1");
-		constexpr auto FDECSTP          = Op(568,  "fdecstp");
-		constexpr auto FINCSTP          = Op(569,  "fincstp");
-		constexpr auto FPREM            = Op(570,  "fprem");
-		constexpr auto FYL2XP1          = Op(571,  "fyl2xp1");
-		constexpr auto FSQRT            = Op(572,  "fsqrt");
-		constexpr auto FSINCOS          = Op(573,  "fsincos");
-		constexpr auto FRNDINT          = Op(574,  "frndint");
-		constexpr auto FSCALE           = Op(575,  "fscale");
-		constexpr auto FSIN             = Op(576,  "fsin");
-		constexpr auto FCOS             = Op(577,  "fcos");
-		constexpr auto FIADD            = Op(578,  "fiadd");
-		constexpr auto FIMUL            = Op(579,  "fimul");
-		constexpr auto FICOM            = Op(580,  "ficom");
-		constexpr auto FICOMP           = Op(581,  "ficomp");
-		constexpr auto FISUB            = Op(582,  "fisub");
-		constexpr auto FISUBR           = Op(583,  "fisubr");
-		constexpr auto FIDIV            = Op(584,  "fidiv");
-		constexpr auto FIDIVR           = Op(585,  "fidivr");
-		constexpr auto FCMOVB           = Op(586,  "fcmovb");
-		constexpr auto FCMOVE           = Op(587,  "fcmove");
-		constexpr auto FCMOVBE          = Op(588,  "fcmovbe");
-		constexpr auto FCMOVU           = Op(589,  "fcmovu");
-		constexpr auto FUCOMPP          = Op(590,  "fucompp");
-		constexpr auto FILD             = Op(591,  "fild");
-		constexpr auto FISTTP           = Op(592,  "fisttp");
-		constexpr auto FIST             = Op(593,  "fist");
-		constexpr auto FISTP            = Op(594,  "fistp");
-		constexpr auto FCMOVNB          = Op(595,  "fcmovnb");
-		constexpr auto FCMOVNE          = Op(596,  "fcmovne");
-		constexpr auto FCMOVNBE         = Op(597,  "fcmovnbe");
-		constexpr auto FCMOVNU          = Op(598,  "fcmovnu");
-		constexpr auto FNCLEX           = Op(599,  "fnclex");
-		constexpr auto FNINIT           = Op(600,  "fninit");
-		constexpr auto FUCOMI           = Op(601,  "fucomi");
-		constexpr auto FCOMI            = Op(602,  "fcomi");
-		constexpr auto FADD             = Op(603,  "fadd");
-		constexpr auto FMUL             = Op(604,  "fmul");
-		constexpr auto FCOM             = Op(605,  "fcom");
-		constexpr auto FCOMP            = Op(606,  "fcomp");
-		constexpr auto FSUB             = Op(607,  "fsub");
-		constexpr auto FSUBR            = Op(608,  "fsubr");
-		constexpr auto FDIV             = Op(609,  "fdiv");
-		constexpr auto FDIVR            = Op(610,  "fdivr");
-		constexpr auto FRSTOR           = Op(611,  "frstor");
-		constexpr auto FFREE            = Op(612,  "ffree");
-		constexpr auto FUCOM            = Op(613,  "fucom");
-		constexpr auto FUCOMP           = Op(614,  "fucomp");
-		constexpr auto FNSAVE           = Op(615,  "fnsave");
-		constexpr auto FNSTSW           = Op(616,  "fnstsw");
-		constexpr auto FADDP            = Op(617,  "faddp");
-		constexpr auto FMULP            = Op(618,  "fmulp");
-		constexpr auto FCOMPP           = Op(619,  "fcompp");
-		constexpr auto FSUBRP           = Op(620,  "fsubrp");
-		constexpr auto FSUBP            = Op(621,  "fsubp");
-		constexpr auto FDIVRP           = Op(622,  "fdivrp");
-		constexpr auto FDIVP            = Op(623,  "fdivp");
-		constexpr auto FBLD             = Op(624,  "fbld");
-		constexpr auto FBSTP            = Op(625,  "fbstp");
-		constexpr auto FUCOMIP          = Op(626,  "fucomip");
-		constexpr auto FCOMIP           = Op(627,  "fcomip");
+		constexpr auto FLD              = Op(542,  "fld",             Ext::X87);
+		constexpr auto FST              = Op(543,  "fst",             Ext::X87);
+		constexpr auto FSTP             = Op(544,  "fstp",            Ext::X87);
+		constexpr auto FLDENV           = Op(545,  "fldenv",          Ext::X87);
+		constexpr auto FLDCW            = Op(546,  "fldcw",           Ext::X87);
+		constexpr auto FNSTENV          = Op(547,  "fnstenv",         Ext::X87);
+		constexpr auto FNSTCW           = Op(548,  "fnstcw",          Ext::X87);
+		constexpr auto FXCH             = Op(549,  "fxch",            Ext::X87);
+		constexpr auto FNOP             = Op(550,  "fnop",            Ext::X87);
+		constexpr auto FCHS             = Op(551,  "fchs",            Ext::X87);
+		constexpr auto FABS             = Op(552,  "fabs",            Ext::X87);
+		constexpr auto FTST             = Op(553,  "ftst",            Ext::X87);
+		constexpr auto FXAM             = Op(554,  "fxam",            Ext::X87);
+		constexpr auto FLD1             = Op(555,  "fld1",            Ext::X87);
+		constexpr auto FLDL2T           = Op(556,  "fldl2t",          Ext::X87);
+		constexpr auto FLDL2E           = Op(557,  "fldl2e",          Ext::X87);
+		constexpr auto FLDPI            = Op(558,  "fldpi",           Ext::X87);
+		constexpr auto FLDLG2           = Op(559,  "fldlg2",          Ext::X87);
+		constexpr auto FLDLN2           = Op(560,  "fldln2",          Ext::X87);
+		constexpr auto FLDZ             = Op(561,  "fldz",            Ext::X87);
+		constexpr auto F2XM1            = Op(562,  "f2xm1",           Ext::X87);
+		constexpr auto FYL2X            = Op(563,  "fyl2x",           Ext::X87);
+		constexpr auto FPTAN            = Op(564,  "fptan",           Ext::X87);
+		constexpr auto FPATAN           = Op(565,  "fpatan",          Ext::X87);
+		constexpr auto FXTRACT          = Op(566,  "fxtract",         Ext::X87);
+		constexpr auto FPREM1           = Op(567,  "fprem1",          Ext::X87);
+		constexpr auto FDECSTP          = Op(568,  "fdecstp",         Ext::X87);
+		constexpr auto FINCSTP          = Op(569,  "fincstp",         Ext::X87);
+		constexpr auto FPREM            = Op(570,  "fprem",           Ext::X87);
+		constexpr auto FYL2XP1          = Op(571,  "fyl2xp1",         Ext::X87);
+		constexpr auto FSQRT            = Op(572,  "fsqrt",           Ext::X87);
+		constexpr auto FSINCOS          = Op(573,  "fsincos",         Ext::X87);
+		constexpr auto FRNDINT          = Op(574,  "frndint",         Ext::X87);
+		constexpr auto FSCALE           = Op(575,  "fscale",          Ext::X87);
+		constexpr auto FSIN             = Op(576,  "fsin",            Ext::X87);
+		constexpr auto FCOS             = Op(577,  "fcos",            Ext::X87);
+		constexpr auto FIADD            = Op(578,  "fiadd",           Ext::X87);
+		constexpr auto FIMUL            = Op(579,  "fimul",           Ext::X87);
+		constexpr auto FICOM            = Op(580,  "ficom",           Ext::X87);
+		constexpr auto FICOMP           = Op(581,  "ficomp",          Ext::X87);
+		constexpr auto FISUB            = Op(582,  "fisub",           Ext::X87);
+		constexpr auto FISUBR           = Op(583,  "fisubr",          Ext::X87);
+		constexpr auto FIDIV            = Op(584,  "fidiv",           Ext::X87);
+		constexpr auto FIDIVR           = Op(585,  "fidivr",          Ext::X87);
+		constexpr auto FCMOVB           = Op(586,  "fcmovb",          Ext::X87);
+		constexpr auto FCMOVE           = Op(587,  "fcmove",          Ext::X87);
+		constexpr auto FCMOVBE          = Op(588,  "fcmovbe",         Ext::X87);
+		constexpr auto FCMOVU           = Op(589,  "fcmovu",          Ext::X87);
+		constexpr auto FUCOMPP          = Op(590,  "fucompp",         Ext::X87);
+		constexpr auto FILD             = Op(591,  "fild",            Ext::X87);
+		constexpr auto FISTTP           = Op(592,  "fisttp",          Ext::X87);
+		constexpr auto FIST             = Op(593,  "fist",            Ext::X87);
+		constexpr auto FISTP            = Op(594,  "fistp",           Ext::X87);
+		constexpr auto FCMOVNB          = Op(595,  "fcmovnb",         Ext::X87);
+		constexpr auto FCMOVNE          = Op(596,  "fcmovne",         Ext::X87);
+		constexpr auto FCMOVNBE         = Op(597,  "fcmovnbe",        Ext::X87);
+		constexpr auto FCMOVNU          = Op(598,  "fcmovnu",         Ext::X87);
+		constexpr auto FNCLEX           = Op(599,  "fnclex",          Ext::X87);
+		constexpr auto FNINIT           = Op(600,  "fninit",          Ext::X87);
+		constexpr auto FUCOMI           = Op(601,  "fucomi",          Ext::X87);
+		constexpr auto FCOMI            = Op(602,  "fcomi",           Ext::X87);
+		constexpr auto FADD             = Op(603,  "fadd",            Ext::X87);
+		constexpr auto FMUL             = Op(604,  "fmul",            Ext::X87);
+		constexpr auto FCOM             = Op(605,  "fcom",            Ext::X87);
+		constexpr auto FCOMP            = Op(606,  "fcomp",           Ext::X87);
+		constexpr auto FSUB             = Op(607,  "fsub",            Ext::X87);
+		constexpr auto FSUBR            = Op(608,  "fsubr",           Ext::X87);
+		constexpr auto FDIV             = Op(609,  "fdiv",            Ext::X87);
+		constexpr auto FDIVR            = Op(610,  "fdivr",           Ext::X87);
+		constexpr auto FRSTOR           = Op(611,  "frstor",          Ext::X87);
+		constexpr auto FFREE            = Op(612,  "ffree",           Ext::X87);
+		constexpr auto FUCOM            = Op(613,  "fucom",           Ext::X87);
+		constexpr auto FUCOMP           = Op(614,  "fucomp",          Ext::X87);
+		constexpr auto FNSAVE           = Op(615,  "fnsave",          Ext::X87);
+		constexpr auto FNSTSW           = Op(616,  "fnstsw",          Ext::X87);
+		constexpr auto FADDP            = Op(617,  "faddp",           Ext::X87);
+		constexpr auto FMULP            = Op(618,  "fmulp",           Ext::X87);
+		constexpr auto FCOMPP           = Op(619,  "fcompp",          Ext::X87);
+		constexpr auto FSUBRP           = Op(620,  "fsubrp",          Ext::X87);
+		constexpr auto FSUBP            = Op(621,  "fsubp",           Ext::X87);
+		constexpr auto FDIVRP           = Op(622,  "fdivrp",          Ext::X87);
+		constexpr auto FDIVP            = Op(623,  "fdivp",           Ext::X87);
+		constexpr auto FBLD             = Op(624,  "fbld",            Ext::X87);
+		constexpr auto FBSTP            = Op(625,  "fbstp",           Ext::X87);
+		constexpr auto FUCOMIP          = Op(626,  "fucomip",         Ext::X87);
+		constexpr auto FCOMIP           = Op(627,  "fcomip",          Ext::X87);
 
 
 		// avx
-		constexpr auto VMOVUPS          = Op(628,  "vmovups");
-		constexpr auto VMOVLPS          = Op(629,  "vmovlps");
-		constexpr auto VMOVHLPS         = Op(630,  "vmovhlps");
-		constexpr auto VUNPCKLPS        = Op(631,  "vunpcklps");
-		constexpr auto VUNPCKHPS        = Op(632,  "vunpckhps");
-		constexpr auto VMOVHPS          = Op(633,  "vmovhps");
-		constexpr auto VMOVLHPS         = Op(634,  "vmovlhps");
-		constexpr auto VMOVSS           = Op(635,  "vmovss");
-		constexpr auto VMOVSD           = Op(636,  "vmovsd");
-		constexpr auto VMOVSLDUP        = Op(637,  "vmovsldup");
-		constexpr auto VMOVSHDUP        = Op(638,  "vmovshdup");
-		constexpr auto VMOVUPD          = Op(639,  "vmovupd");
-		constexpr auto VMOVLPD          = Op(640,  "vmovlpd");
-		constexpr auto VUNPCKLPD        = Op(641,  "vunpcklpd");
-		constexpr auto VUNPCKHPD        = Op(642,  "vunpckhpd");
-		constexpr auto VMOVHPD          = Op(643,  "vmovhpd");
-		constexpr auto VMOVDDUP         = Op(644,  "vmovddup");
-		constexpr auto VMOVMSKPS        = Op(645,  "vmovmskps");
-		constexpr auto VSQRTPS          = Op(646,  "vsqrtps");
-		constexpr auto VRSQRTPS         = Op(647,  "vrsqrtps");
-		constexpr auto VRCPPS           = Op(648,  "vrcpps");
-		constexpr auto VANDPS           = Op(649,  "vandps");
-		constexpr auto VANDNPS          = Op(650,  "vandnps");
-		constexpr auto VORPS            = Op(651,  "vorps");
-		constexpr auto VXORPS           = Op(652,  "vxorps");
-		constexpr auto VSQRTSS          = Op(653,  "vsqrtss");
-		constexpr auto VRSQRTSS         = Op(654,  "vrsqrtss");
-		constexpr auto VRCPSS           = Op(655,  "vrcpss");
-		constexpr auto VMOVMSKPD        = Op(656,  "vmovmskpd");
-		constexpr auto VSQRTPD          = Op(657,  "vsqrtpd");
-		constexpr auto VANDPD           = Op(658,  "vandpd");
-		constexpr auto VANDNPD          = Op(659,  "vandnpd");
-		constexpr auto VORPD            = Op(660,  "vorpd");
-		constexpr auto VXORPD           = Op(661,  "vxorpd");
-		constexpr auto VSQRTSD          = Op(662,  "vsqrtsd");
-		constexpr auto VPUNPCKLBW       = Op(663,  "vpunpcklbw");
-		constexpr auto VPUNPCKLWD       = Op(664,  "vpunpcklwd");
-		constexpr auto VPUNPCKLDQ       = Op(665,  "vpunpckldq");
-		constexpr auto VPACKSSWB        = Op(666,  "vpacksswb");
-		constexpr auto VPCMPGTB         = Op(667,  "vpcmpgtb");
-		constexpr auto VPCMPGTW         = Op(668,  "vpcmpgtw");
-		constexpr auto VPCMPGTD         = Op(669,  "vpcmpgtd");
-		constexpr auto VPACKUSWB        = Op(670,  "vpackuswb");
-		constexpr auto VPSHUFW          = Op(671,  "vpshufw");
-		constexpr auto VPSHUFHW         = Op(672,  "vpshufhw");
-		constexpr auto VPSHUFD          = Op(673,  "vpshufd");
-		constexpr auto VPSHUFLW         = Op(674,  "vpshuflw");
-		constexpr auto VPCMPEQB         = Op(675,  "vpcmpeqb");
-		constexpr auto VPCMPEQW         = Op(676,  "vpcmpeqw");
-		constexpr auto VPCMPEQD         = Op(677,  "vpcmpeqd");
-		constexpr auto VCMPPS           = Op(678,  "vcmpps");
-		constexpr auto VCMPSS           = Op(679,  "vcmpss");
-		constexpr auto VCMPPD           = Op(680,  "vcmppd");
-		constexpr auto VMOVNTI          = Op(681,  "vmovnti");
-		constexpr auto VPINSRW          = Op(682,  "vpinsrw");
-		constexpr auto VPINSRQ          = Op(683,  "vpinsrq");
-		constexpr auto VPEXTRW          = Op(684,  "vpextrw");
-		constexpr auto VSHUFPS          = Op(685,  "vpinsrw");
-		constexpr auto VSHUFPD          = Op(686,  "vpinsrw");
-		constexpr auto VPSRLW           = Op(687,  "vpsrlw");
-		constexpr auto VPSRLD           = Op(688,  "vpsrld");
-		constexpr auto VPSRLQ           = Op(689,  "vpsrlq");
-		constexpr auto VPSRLDQ          = Op(690,  "vpsrldq");
-		constexpr auto VPADDQ           = Op(691,  "vpaddq");
-		constexpr auto VPMULLW          = Op(692,  "vpmullw");
-		constexpr auto VPMOVMSKB        = Op(693,  "vpmovmskb");
-		constexpr auto VMOVQ2DQ         = Op(694,  "vmovq2dq");;
-		constexpr auto VADDSUBPD        = Op(695,  "vaddsubpd");
-		constexpr auto VMOVQ            = Op(696,  "vmovq");
-		constexpr auto VADDSUBPS        = Op(697,  "vaddsubps");
-		constexpr auto VMOVDQ2Q         = Op(698,  "vmovdq2q");
-		constexpr auto VPAVGB           = Op(699,  "vpavgb");
-		constexpr auto VPSRAW           = Op(700,  "vpsraw");
-		constexpr auto VPSRAD           = Op(701,  "vpsrad");
-		constexpr auto VPAVGW           = Op(702,  "vpavgw");
-		constexpr auto VPMULHUW         = Op(703,  "vpmulhuw");
-		constexpr auto VPMULHW          = Op(704,  "vpmulhw");
-		constexpr auto VMOVNTQ          = Op(705,  "vmovntq");
-		constexpr auto VCVTDQ2PS        = Op(706,  "vcvtdq2ps");
-		constexpr auto VCVTDQ2PD        = Op(707,  "vcvtdq2pd");
-		constexpr auto VCVTTPD2DQ       = Op(708,  "vcvttpd2dq");
-		constexpr auto VMOVNTDQ         = Op(709,  "vmovntdq");
-		constexpr auto VCVTPD2DQ        = Op(710,  "vcvtpd2dq");
-		constexpr auto VPSLLW           = Op(711,  "vpsllw");
-		constexpr auto VPSLLD           = Op(712,  "vpslld");
-		constexpr auto VPSLLQ           = Op(713,  "vpsllq");
-		constexpr auto VPSLLDQ          = Op(714,  "vpslldq");
-		constexpr auto VPMULUDQ         = Op(715,  "vpmuludq");
-		constexpr auto VPMADDWD         = Op(716,  "vpmaddwd");
-		constexpr auto VPSADBW          = Op(717,  "vpsadbw");
-		constexpr auto VMASKMOVQ        = Op(718,  "vmaskmovq");
-		constexpr auto VMASKMOVDQU      = Op(719,  "vmaskmovdqu");
-		constexpr auto VLDDQU           = Op(720,  "vlddqu");
-		constexpr auto VMOVAPS          = Op(721,  "vmovaps");
-		constexpr auto VMOVAPD          = Op(722,  "vmovapd");
-		constexpr auto VCVTPI2PS        = Op(723,  "vcvtpi2ps");
-		constexpr auto VMOVNTPS         = Op(724,  "vmovntps");
-		constexpr auto VCVTTPS2PI       = Op(725,  "vcvttps2pi");
-		constexpr auto VCVTPS2PI        = Op(726,  "vcvtps2pi");
-		constexpr auto VUCOMISS         = Op(727,  "vucomiss");
-		constexpr auto VCOMISS          = Op(728,  "vcomiss");
-		constexpr auto VCVTSI2SS        = Op(729,  "vcvtsi2ss");
-		constexpr auto VMOVNTSS         = Op(730,  "vmovntss");
-		constexpr auto VCVTTSS2SI       = Op(731,  "vcvttss2si");
-		constexpr auto VCVTSS2SI        = Op(732,  "vcvtss2si");
-		constexpr auto VCVTPI2PD        = Op(733,  "vcvtpi2pd");
-		constexpr auto VMOVNTPD         = Op(734,  "vmovntpd");
-		constexpr auto VCVTTPD2PI       = Op(735,  "vcvttpd2pi");
-		constexpr auto VCVTPD2PI        = Op(736,  "vcvtpd2pi");
-		constexpr auto VUCOMISD         = Op(737,  "vucomisd");
-		constexpr auto VCOMISD          = Op(738,  "vcomisd");
-		constexpr auto VCVTSI2SD        = Op(739,  "vcvtsi2sd");
-		constexpr auto VMOVNTSD         = Op(740,  "vmovntsd");
-		constexpr auto VCVTTSD2SI       = Op(741,  "vcvttsd2si");
-		constexpr auto VCVTSD2SI        = Op(742,  "vcvtsd2si");
-		constexpr auto VADDPS           = Op(743,  "vaddps");
-		constexpr auto VMULPS           = Op(744,  "vmulps");
-		constexpr auto VCVTPS2PD        = Op(745,  "vcvtps2pd");
-		constexpr auto VCVTPQ2PS        = Op(746,  "vcvtpq2ps");
-		constexpr auto VSUBPS           = Op(747,  "vsubps");
-		constexpr auto VMINPS           = Op(748,  "vminps");
-		constexpr auto VDIVPS           = Op(749,  "vdivps");
-		constexpr auto VMAXPS           = Op(750,  "vmaxps");
-		constexpr auto VADDSS           = Op(751,  "vaddss");
-		constexpr auto VMULSS           = Op(752,  "vmulss");
-		constexpr auto VCVTSS2SD        = Op(753,  "vcvtss2sd");
-		constexpr auto VCVTTPS2DQ       = Op(754,  "vcvttps2dq");
-		constexpr auto VSUBSS           = Op(755,  "vsubss");
-		constexpr auto VMINSS           = Op(756,  "vminss");
-		constexpr auto VDIVSS           = Op(757,  "vdivss");
-		constexpr auto VMAXSS           = Op(758,  "vmaxss");
-		constexpr auto VADDPD           = Op(759,  "vaddpd");
-		constexpr auto VMULPD           = Op(760,  "vmulpd");
-		constexpr auto VCVTPD2PS        = Op(761,  "vcvtpd2ps");
-		constexpr auto VCVTPS2DQ        = Op(762,  "vcvtps2dq");
-		constexpr auto VSUBPD           = Op(763,  "vsubpd");
-		constexpr auto VMINPD           = Op(764,  "vminpd");
-		constexpr auto VDIVPD           = Op(765,  "vdivpd");
-		constexpr auto VMAXPD           = Op(766,  "vmaxpd");
-		constexpr auto VADDSD           = Op(767,  "vaddsd");
-		constexpr auto VMULSD           = Op(768,  "vmulsd");
-		constexpr auto VCVTSD2SS        = Op(769,  "vcvtsd2ss");
-		constexpr auto VSUBSD           = Op(770,  "vsubsd");
-		constexpr auto VMINSD           = Op(771,  "vminsd");
-		constexpr auto VDIVSD           = Op(772,  "vdivsd");
-		constexpr auto VMAXSD           = Op(773,  "vmaxsd");
-		constexpr auto VPUNPCKHBW       = Op(774,  "vpunpckhbw");
-		constexpr auto VPUNPCKHWD       = Op(775,  "vpunpckhwd");
-		constexpr auto VPUNPCKHDQ       = Op(776,  "vpunpckhdq");
-		constexpr auto VPACKSSDW        = Op(777,  "vpackssdw");
-		constexpr auto VMOVD            = Op(778,  "vmovd");
-		constexpr auto VMOVDQU          = Op(779,  "vmovdqu");
-		constexpr auto VPUNPCKLQDQ      = Op(780,  "vpunpcklqdq");
-		constexpr auto VPUNPCKHQDQ      = Op(781,  "vpunpckhqdq");
-		constexpr auto VMOVDQA          = Op(782,  "vmovdqa");
-		constexpr auto VEXTRQ           = Op(783,  "vextrq");
-		constexpr auto VHADDPD          = Op(784,  "vhaddpd");
-		constexpr auto VHSUBPD          = Op(785,  "vhsubpd");
-		constexpr auto VINSERTQ         = Op(786,  "vinsertq");
-		constexpr auto VHADDPS          = Op(787,  "vhaddps");
-		constexpr auto VHSUBPS          = Op(788,  "vhsubps");
-		constexpr auto VTZCNT           = Op(789,  "vtzcnt");
-		constexpr auto VLZCNT           = Op(790,  "vlzcnt");
-		constexpr auto VPOPCNT          = Op(791,  "vpopcnt");
-		constexpr auto VPSUBUSB         = Op(792,  "vpsubusb");
-		constexpr auto VPSUBUSW         = Op(793,  "vpsubusw");
-		constexpr auto VPMINUB          = Op(794,  "vpminub");
-		constexpr auto VPAND            = Op(795,  "vpand");
-		constexpr auto VPADDUSB         = Op(796,  "vpaddusb");
-		constexpr auto VPADDUSW         = Op(797,  "vpaddusw");
-		constexpr auto VPMAXUB          = Op(798,  "vpmaxub");
-		constexpr auto VPANDN           = Op(799,  "vpandn");
-		constexpr auto VPSUBSB          = Op(800,  "vpsubsb");
-		constexpr auto VPSUBSW          = Op(801,  "vpsubsw");
-		constexpr auto VPMINSW          = Op(802,  "vpminsw");
-		constexpr auto VPOR             = Op(803,  "vpor");
-		constexpr auto VPADDSB          = Op(804,  "vpaddsb");
-		constexpr auto VPADDSW          = Op(805,  "vpaddsw");
-		constexpr auto VPMAXSW          = Op(806,  "vpmaxsw");
-		constexpr auto VPXOR            = Op(807,  "vpxor");
-		constexpr auto VPSUBB           = Op(808,  "vpsubb");
-		constexpr auto VPSUBW           = Op(809,  "vpsubw");
-		constexpr auto VPSUBD           = Op(810,  "vpsubd");
-		constexpr auto VPSUBQ           = Op(811,  "vpsubq");
-		constexpr auto VPADDB           = Op(812,  "vpaddb");
-		constexpr auto VPADDW           = Op(813,  "vpaddw");
-		constexpr auto VPADDD           = Op(814,  "vpaddd");
-		constexpr auto VPSHUFB          = Op(815,  "vpshufb");
-		constexpr auto VPHADDW          = Op(816,  "vphaddw");
-		constexpr auto VPHADDD          = Op(817,  "vphaddd");
-		constexpr auto VPHADDSW         = Op(818,  "vphaddsw");
-		constexpr auto VPMADDUBSW       = Op(819,  "vpmaddubsw");
-		constexpr auto VPHSUBW          = Op(820,  "vphsubw");
-		constexpr auto VPHSUBD          = Op(821,  "vphsubd");
-		constexpr auto VPHSUBSW         = Op(822,  "vphsubsw");
-		constexpr auto VPSIGNB          = Op(823,  "vpsignb");
-		constexpr auto VPSIGNW          = Op(824,  "vpsignw");
-		constexpr auto VPSIGND          = Op(825,  "vpsignd");
-		constexpr auto VPMULHRSW        = Op(826,  "vpmulhrsw");
-		constexpr auto VPBLENDVB        = Op(827,  "vpblendvb");
-		constexpr auto VBLENDVPS        = Op(828,  "vblendvps");
-		constexpr auto VBLENDVPD        = Op(829,  "vblendvpd");
-		constexpr auto VPTEST           = Op(830,  "vptest");
-		constexpr auto VPMOVSXBW        = Op(831,  "vpmovsxbw");
-		constexpr auto VPMOVSXBD        = Op(832,  "vpmovsxbd");
-		constexpr auto VPMOVSXBQ        = Op(833,  "vpmovsxbq");
-		constexpr auto VPMOVSXWD        = Op(834,  "vpmovsxwd");
-		constexpr auto VPMOVSXWQ        = Op(835,  "vpmovsxwq");
-		constexpr auto VPMOVSXDQ        = Op(836,  "vpmovsxdq");
-		constexpr auto VPMOVZXBW        = Op(837,  "vpmovzxbw");
-		constexpr auto VPMOVZXBD        = Op(838,  "vpmovzxbd");
-		constexpr auto VPMOVZXBQ        = Op(839,  "vpmovzxbq");
-		constexpr auto VPMOVZXWD        = Op(840,  "vpmovzxwd");
-		constexpr auto VPMOVZXWQ        = Op(841,  "vpmovzxwq");
-		constexpr auto VPMOVZXDQ        = Op(842,  "vpmovzxdq");
-		constexpr auto VPCMPGTQ         = Op(843,  "vpcmpgtq");
-		constexpr auto VPMULLD          = Op(844,  "vpmulld");
-		constexpr auto VPHMINPOSUW      = Op(845,  "vphminposuw");
-		constexpr auto VMOVBE           = Op(846,  "vmovbe");
-		constexpr auto VCRC32           = Op(847,  "vcrc32");
-		constexpr auto VPABSB           = Op(848,  "vpabsb");
-		constexpr auto VPABSW           = Op(849,  "vpabsw");
-		constexpr auto VPABSD           = Op(850,  "vpabsd");
-		constexpr auto VPMULDQ          = Op(851,  "vpmuldq");
-		constexpr auto VPCMPEQQ         = Op(852,  "vpcmpeqq");
-		constexpr auto VMOVNTDQA        = Op(853,  "vmovntdqa");
-		constexpr auto VPACKUSDW        = Op(854,  "vpackusdw");
-		constexpr auto VPMINSB          = Op(855,  "vpminsb");
-		constexpr auto VPMINSD          = Op(856,  "vpminsd");
-		constexpr auto VPMINUW          = Op(857,  "vpminuw");
-		constexpr auto VPMINUD          = Op(858,  "vpminud");
-		constexpr auto VPMAXSB          = Op(859,  "vpmaxsb");
-		constexpr auto VPMAXSD          = Op(860,  "vpmaxsd");
-		constexpr auto VPMAXUW          = Op(861,  "vpmaxuw");
-		constexpr auto VPMAXUD          = Op(862,  "vpmaxud");
-		constexpr auto VAESIMC          = Op(863,  "vaesimc");
-		constexpr auto VAESENC          = Op(864,  "vaesenc");
-		constexpr auto VAESENCLAST      = Op(865,  "vaesenclast");
-		constexpr auto VAESDEC          = Op(866,  "vaesdec");
-		constexpr auto VAESDECLAST      = Op(867,  "vaesdeclast");
-		constexpr auto VPEXTRB          = Op(868,  "vpextrb");
-		constexpr auto VPEXTRD          = Op(869,  "vpextrd");
-		constexpr auto VEXTRACTPS       = Op(870,  "vextractps");
-		constexpr auto VPINSRB          = Op(871,  "vpinsrb");
-		constexpr auto VINSERTPS        = Op(872,  "vinsertps");
-		constexpr auto VPINSRD          = Op(873,  "vpinsrd");
-		constexpr auto VDPPS            = Op(874,  "vdpps");
-		constexpr auto VDPPD            = Op(875,  "vdppd");
-		constexpr auto VMPSADBW         = Op(876,  "vmpsadbw");
-		constexpr auto VPCLMULQDQ       = Op(877,  "vpclmulqdq");
-		constexpr auto VPCMPESTRM       = Op(878,  "vpcmpestrm");
-		constexpr auto VPCMPESTRI       = Op(879,  "vpcmpestri");
-		constexpr auto VPCMPISTRM       = Op(880,  "vpcmpistrm");
-		constexpr auto VPCMPISTRI       = Op(881,  "vpcmpistri");
-		constexpr auto VPALIGNR         = Op(882,  "vpalignr");
-		constexpr auto VROUNDPS         = Op(883,  "vroundps");
-		constexpr auto VROUNDPD         = Op(884,  "vroundpd");
-		constexpr auto VROUNDSS         = Op(885,  "vroundss");
-		constexpr auto VROUNDSD         = Op(886,  "vroundsd");
-		constexpr auto VBLENDPS         = Op(887,  "vblendps");
-		constexpr auto VBLENDPD         = Op(888,  "vblendpd");
-		constexpr auto VPBLENDW         = Op(889,  "vpblendw");
-		constexpr auto VZEROALL         = Op(890,  "vzeroall");
-		constexpr auto VZEROUPPER       = Op(891,  "vzeroupper");
-		constexpr auto VLDMXCSR         = Op(892,  "vldmxcsr");
-		constexpr auto VSTMXCSR         = Op(893,  "vstmxcsr");
-
-
-		constexpr auto BLSR             = Op(894,  "blsr");
-		constexpr auto BLSMSK           = Op(895,  "blsmsk");
-		constexpr auto BLSI             = Op(896,  "blsi");
-		constexpr auto VPERMILPS        = Op(897,  "vpermilps");
-		constexpr auto VPERMILPD        = Op(898,  "vpermilpd");
-		constexpr auto VTESTPS          = Op(899,  "vtestps");
-		constexpr auto VTESTPD          = Op(900,  "vtestpd");
-		constexpr auto VCVTPH2PS        = Op(901,  "vcvtph2ps");
-		constexpr auto VPERMPS          = Op(902,  "vpermps");
-
-
-		constexpr auto VBROADCASTSS     = Op(903,  "vbroadcastss");
-		constexpr auto VBROADCASTSD     = Op(904,  "vbroadcastsd");
-		constexpr auto VBROADCASTF128   = Op(905,  "vbroadcastf128");
-		constexpr auto VMASKMOVPS       = Op(906,  "vmaskmovps");
-		constexpr auto VMASKMOVPD       = Op(907,  "vmaskmovpd");
-		constexpr auto VPERMD           = Op(908,  "vpermd");
-		constexpr auto VPSRLVD          = Op(909,  "vpsrlvd");
-		constexpr auto VPSRLVQ          = Op(910,  "vpsrlvq");
-
-		constexpr auto VPRAVD           = Op(911,  "vpravd");
-		constexpr auto VPSLLVD          = Op(912,  "vpsllvd");
-		constexpr auto VPSLLVQ          = Op(913,  "vpsllvq");
-		constexpr auto VPBROADCASTD     = Op(914,  "vpbroadcastd");
-		constexpr auto VPBROADCASTI128  = Op(915,  "vpbroadcasti128");
-		constexpr auto VPBROADCASTB     = Op(916,  "vpbroadcastb");
-		constexpr auto VPBROADCASTW     = Op(917,  "vpbroadcastw");
-		constexpr auto VPMASKMOVD       = Op(918,  "vpmaskmovd");
-		constexpr auto VPMASKMOVQ       = Op(919,  "vpmaskmovq");
-		constexpr auto VFMADDSUB132PS   = Op(920,  "vfmaddsub132ps");
-		constexpr auto VFMADDSUB132PD   = Op(921,  "vfmaddsub132pd");
-		constexpr auto VFMSUBADD132PS   = Op(922,  "vfmsubadd132ps");
-		constexpr auto VFMSUBADD132PD   = Op(923,  "vfmsubadd132pd");
-		constexpr auto VFMADD132PS      = Op(924,  "vfmadd132ps");
-		constexpr auto VFMADD132PD      = Op(925,  "vfmadd132pd");
-		constexpr auto VFMADD132SS      = Op(926,  "vfmadd132ss");
-		constexpr auto VFMADD132SD      = Op(927,  "vfmadd132sd");
-		constexpr auto VFMSUB132PS      = Op(928,  "vfmsub132ps");
-		constexpr auto VFMSUB132PD      = Op(929,  "vfmsub132pd");
-		constexpr auto VFMSUB132SS      = Op(930,  "vfmsub132ss");
-		constexpr auto VFMSUB132SD      = Op(931,  "vfmsub132sd");
-		constexpr auto VFNMADD132PS     = Op(932,  "vfnmadd132ps");
-		constexpr auto VFNMADD132PD     = Op(933,  "vfnmadd132pd");
-		constexpr auto VFNMADD132SS     = Op(934,  "vfnmadd132ss");
-		constexpr auto VFNMADD132SD     = Op(935,  "vfnmadd132sd");
-		constexpr auto VFNMSUB132PS     = Op(936,  "vfnmsub132ps");
-		constexpr auto VFNMSUB132PD     = Op(937,  "vfnmsub132pd");
-		constexpr auto VFNMSUB132SS     = Op(938,  "vfnmsub132ss");
-		constexpr auto VFNMSUB132SD     = Op(939,  "vfnmsub132sd");
-		constexpr auto VFMADDSUB213PS   = Op(940,  "vfmaddsub213ps");
-		constexpr auto VFMADDSUB213PD   = Op(941,  "vfmaddsub213pd");
-		constexpr auto VFMSUBADD213PS   = Op(942,  "vfmsubadd213ps");
-		constexpr auto VFMSUBADD213PD   = Op(943,  "vfmsubadd213pd");
-		constexpr auto VFMADD213PS      = Op(944,  "vfmadd213ps");
-		constexpr auto VFMADD213PD      = Op(945,  "vfmadd213pd");
-		constexpr auto VFMADD213SS      = Op(946,  "vfmadd213ss");
-		constexpr auto VFMADD213SD      = Op(947,  "vfmadd213sd");
-		constexpr auto VFMSUB213PS      = Op(948,  "vfmsub213ps");
-		constexpr auto VFMSUB213PD      = Op(949,  "vfmsub213pd");
-		constexpr auto VFMSUB213SS      = Op(950,  "vfmsub213ss");
-		constexpr auto VFMSUB213SD      = Op(951,  "vfmsub213sd");
-		constexpr auto VFNMADD213PS     = Op(952,  "vfnmadd213ps");
-		constexpr auto VFNMADD213PD     = Op(953,  "vfnmadd213pd");
-		constexpr auto VFNMADD213SS     = Op(954,  "vfnmadd213ss");
-		constexpr auto VFNMADD213SD     = Op(955,  "vfnmadd213sd");
-		constexpr auto VFNMSUB213PS     = Op(956,  "vfnmsub213ps");
-		constexpr auto VFNMSUB213PD     = Op(957,  "vfnmsub213pd");
-		constexpr auto VFNMSUB213SS     = Op(958,  "vfnmsub213ss");
-		constexpr auto VFNMSUB213SD     = Op(959,  "vfnmsub213sd");
-		constexpr auto VFMADDSUB231PS   = Op(960,  "vfmaddsub231ps");
-		constexpr auto VFMADDSUB231PD   = Op(961,  "vfmaddsub231pd");
-		constexpr auto VFMSUBADD231PS   = Op(962,  "vfmsubadd231ps");
-		constexpr auto VFMSUBADD231PD   = Op(963,  "vfmsubadd231pd");
-		constexpr auto VFMADD231PS      = Op(964,  "vfmadd231ps");
-		constexpr auto VFMADD231PD      = Op(965,  "vfmadd231pd");
-		constexpr auto VFMADD231SS      = Op(966,  "vfmadd231ss");
-		constexpr auto VFMADD231SD      = Op(967,  "vfmadd231sd");
-		constexpr auto VFMSUB231PS      = Op(968,  "vfmsub231ps");
-		constexpr auto VFMSUB231PD      = Op(969,  "vfmsub231pd");
-		constexpr auto VFMSUB231SS      = Op(970,  "vfmsub231ss");
-		constexpr auto VFMSUB231SD      = Op(971,  "vfmsub231sd");
-		constexpr auto VFNMADD231PS     = Op(972,  "vfnmadd231ps");
-		constexpr auto VFNMADD231PD     = Op(973,  "vfnmadd231pd");
-		constexpr auto VFNMADD231SS     = Op(974,  "vfnmadd231ss");
-		constexpr auto VFNMADD231SD     = Op(975,  "vfnmadd231sd");
-		constexpr auto VFNMSUB231PS     = Op(976,  "vfnmsub231ps");
-		constexpr auto VFNMSUB231PD     = Op(977,  "vfnmsub231pd");
-		constexpr auto VFNMSUB231SS     = Op(978,  "vfnmsub231ss");
-		constexpr auto VFNMSUB231SD     = Op(979,  "vfnmsub231sd");
-		constexpr auto ANDN             = Op(980,  "andn");
-		constexpr auto BZHI             = Op(981,  "bzhi");
-		constexpr auto PDEP             = Op(982,  "pdep");
-		constexpr auto PEXT             = Op(983,  "pext");
-		constexpr auto BEXTR            = Op(984,  "bextr");
-		constexpr auto RORX             = Op(985,  "rorx");
-		constexpr auto SHLX             = Op(986,  "shlx");
-		constexpr auto SHRX             = Op(987,  "shrx");
-		constexpr auto SARX             = Op(988,  "sarx");
-		constexpr auto VPERMQ           = Op(989,  "vpermq");
-		constexpr auto VPERMPD          = Op(990,  "vpermpd");
-		constexpr auto VPBLENDD         = Op(991,  "vpblendd");
-		constexpr auto VPERM2F128       = Op(992,  "vperm2f128");
-		constexpr auto VBLENDW          = Op(993,  "vblendw");
-		constexpr auto VPEXTRQ          = Op(994,  "vpextrq");
-		constexpr auto VINSERTF128      = Op(995,  "vinsertf128");
-		constexpr auto VCVTPS2PH        = Op(996,  "vcvtps2ph");
-		constexpr auto VINSERTI128      = Op(997,  "vinserti128");
-		constexpr auto VEXTRACTI128     = Op(998,  "vextracti128");
-		constexpr auto VPERM2I128       = Op(999, "vperm2i128");
-		constexpr auto VFMADDSUBPS      = Op(1000, "vfmaddsubps");
-		constexpr auto VFMADDSUBPD      = Op(1001, "vfmaddsubpd");
-		constexpr auto VFMADDSUBSS      = Op(1002, "vfmaddsubss");
-		constexpr auto VFMADDSUBSD      = Op(1003, "vfmaddsubsd");
-		constexpr auto VFMSUBADDPS      = Op(1004, "vfmsubaddps");
-		constexpr auto VFMSUBADDPD      = Op(1005, "vfmsubaddpd");
-		constexpr auto VFMSUBADDSS      = Op(1006, "vfmsubaddss");
-		constexpr auto VFMSUBADDSD      = Op(1007, "vfmsubaddsd");
-		constexpr auto VFMADDPS         = Op(1008, "vfmaddps");
-		constexpr auto VFMADDPD         = Op(1009, "vfmaddpd");
-		constexpr auto VFMADDSS         = Op(1010, "vfmaddss");
-		constexpr auto VFMADDSD         = Op(1011, "vfmaddsd");
-		constexpr auto VFMSUBPS         = Op(1012, "vfmsubps");
-		constexpr auto VFMSUBPD         = Op(1013, "vfmsubpd");
-		constexpr auto VFMSUBSS         = Op(1014, "vfmsubss");
-		constexpr auto VFMSUBSD         = Op(1015, "vfmsubsd");
-		constexpr auto VFNMADDPS        = Op(1016, "vfnmaddps");
-		constexpr auto VFNMADDPD        = Op(1017, "vfnmaddpd");
-		constexpr auto VFNMADDSS        = Op(1018, "vfnmaddss");
-		constexpr auto VFNMADDSD        = Op(1019, "vfnmaddsd");
-		constexpr auto VFNMSUBPS        = Op(1020, "vfnmsubps");
-		constexpr auto VFNMSUBPD        = Op(1021, "vfnmsubpd");
-		constexpr auto VFNMSUBSS        = Op(1022, "vfnmsubss");
-		constexpr auto VFNMSUBSD        = Op(1023, "vfnmsubsd");
-		constexpr auto VPGATHERDD       = Op(1024, "vpgatherdd");
-		constexpr auto VPGATHERQD       = Op(1025, "vpgatherdq");
-		constexpr auto VGATHERDPS       = Op(1026, "vgatherdps");
-		constexpr auto VGATHERQPS       = Op(1027, "vgatherqps");
+		constexpr auto VMOVUPS          = Op(628,  "vmovups",         Ext::AVX);
+		constexpr auto VMOVLPS          = Op(629,  "vmovlps",         Ext::AVX);
+		constexpr auto VMOVHLPS         = Op(630,  "vmovhlps",        Ext::AVX);
+		constexpr auto VUNPCKLPS        = Op(631,  "vunpcklps",       Ext::AVX);
+		constexpr auto VUNPCKHPS        = Op(632,  "vunpckhps",       Ext::AVX);
+		constexpr auto VMOVHPS          = Op(633,  "vmovhps",         Ext::AVX);
+		constexpr auto VMOVLHPS         = Op(634,  "vmovlhps",        Ext::AVX);
+		constexpr auto VMOVSS           = Op(635,  "vmovss",          Ext::AVX);
+		constexpr auto VMOVSD           = Op(636,  "vmovsd",          Ext::AVX);
+		constexpr auto VMOVSLDUP        = Op(637,  "vmovsldup",       Ext::AVX);
+		constexpr auto VMOVSHDUP        = Op(638,  "vmovshdup",       Ext::AVX);
+		constexpr auto VMOVUPD          = Op(639,  "vmovupd",         Ext::AVX);
+		constexpr auto VMOVLPD          = Op(640,  "vmovlpd",         Ext::AVX);
+		constexpr auto VUNPCKLPD        = Op(641,  "vunpcklpd",       Ext::AVX);
+		constexpr auto VUNPCKHPD        = Op(642,  "vunpckhpd",       Ext::AVX);
+		constexpr auto VMOVHPD          = Op(643,  "vmovhpd",         Ext::AVX);
+		constexpr auto VMOVDDUP         = Op(644,  "vmovddup",        Ext::AVX);
+		constexpr auto VMOVMSKPS        = Op(645,  "vmovmskps",       Ext::AVX);
+		constexpr auto VSQRTPS          = Op(646,  "vsqrtps",         Ext::AVX);
+		constexpr auto VRSQRTPS         = Op(647,  "vrsqrtps",        Ext::AVX);
+		constexpr auto VRCPPS           = Op(648,  "vrcpps",          Ext::AVX);
+		constexpr auto VANDPS           = Op(649,  "vandps",          Ext::AVX);
+		constexpr auto VANDNPS          = Op(650,  "vandnps",         Ext::AVX);
+		constexpr auto VORPS            = Op(651,  "vorps",           Ext::AVX);
+		constexpr auto VXORPS           = Op(652,  "vxorps",          Ext::AVX);
+		constexpr auto VSQRTSS          = Op(653,  "vsqrtss",         Ext::AVX);
+		constexpr auto VRSQRTSS         = Op(654,  "vrsqrtss",        Ext::AVX);
+		constexpr auto VRCPSS           = Op(655,  "vrcpss",          Ext::AVX);
+		constexpr auto VMOVMSKPD        = Op(656,  "vmovmskpd",       Ext::AVX);
+		constexpr auto VSQRTPD          = Op(657,  "vsqrtpd",         Ext::AVX);
+		constexpr auto VANDPD           = Op(658,  "vandpd",          Ext::AVX);
+		constexpr auto VANDNPD          = Op(659,  "vandnpd",         Ext::AVX);
+		constexpr auto VORPD            = Op(660,  "vorpd",           Ext::AVX);
+		constexpr auto VXORPD           = Op(661,  "vxorpd",          Ext::AVX);
+		constexpr auto VSQRTSD          = Op(662,  "vsqrtsd",         Ext::AVX);
+		constexpr auto VPUNPCKLBW       = Op(663,  "vpunpcklbw",      Ext::AVX);
+		constexpr auto VPUNPCKLWD       = Op(664,  "vpunpcklwd",      Ext::AVX);
+		constexpr auto VPUNPCKLDQ       = Op(665,  "vpunpckldq",      Ext::AVX);
+		constexpr auto VPACKSSWB        = Op(666,  "vpacksswb",       Ext::AVX);
+		constexpr auto VPCMPGTB         = Op(667,  "vpcmpgtb",        Ext::AVX);
+		constexpr auto VPCMPGTW         = Op(668,  "vpcmpgtw",        Ext::AVX);
+		constexpr auto VPCMPGTD         = Op(669,  "vpcmpgtd",        Ext::AVX);
+		constexpr auto VPACKUSWB        = Op(670,  "vpackuswb",       Ext::AVX);
+		constexpr auto VPSHUFW          = Op(671,  "vpshufw",         Ext::AVX);
+		constexpr auto VPSHUFHW         = Op(672,  "vpshufhw",        Ext::AVX);
+		constexpr auto VPSHUFD          = Op(673,  "vpshufd",         Ext::AVX);
+		constexpr auto VPSHUFLW         = Op(674,  "vpshuflw",        Ext::AVX);
+		constexpr auto VPCMPEQB         = Op(675,  "vpcmpeqb",        Ext::AVX);
+		constexpr auto VPCMPEQW         = Op(676,  "vpcmpeqw",        Ext::AVX);
+		constexpr auto VPCMPEQD         = Op(677,  "vpcmpeqd",        Ext::AVX);
+		constexpr auto VCMPPS           = Op(678,  "vcmpps",          Ext::AVX);
+		constexpr auto VCMPSS           = Op(679,  "vcmpss",          Ext::AVX);
+		constexpr auto VCMPPD           = Op(680,  "vcmppd",          Ext::AVX);
+		constexpr auto VMOVNTI          = Op(681,  "vmovnti",         Ext::AVX);
+		constexpr auto VPINSRW          = Op(682,  "vpinsrw",         Ext::AVX);
+		constexpr auto VPINSRQ          = Op(683,  "vpinsrq",         Ext::AVX);
+		constexpr auto VPEXTRW          = Op(684,  "vpextrw",         Ext::AVX);
+		constexpr auto VSHUFPS          = Op(685,  "vshufps",         Ext::AVX);
+		constexpr auto VSHUFPD          = Op(686,  "vshufpd",         Ext::AVX);
+		constexpr auto VPSRLW           = Op(687,  "vpsrlw",          Ext::AVX);
+		constexpr auto VPSRLD           = Op(688,  "vpsrld",          Ext::AVX);
+		constexpr auto VPSRLQ           = Op(689,  "vpsrlq",          Ext::AVX);
+		constexpr auto VPSRLDQ          = Op(690,  "vpsrldq",         Ext::AVX);
+		constexpr auto VPADDQ           = Op(691,  "vpaddq",          Ext::AVX);
+		constexpr auto VPMULLW          = Op(692,  "vpmullw",         Ext::AVX);
+		constexpr auto VPMOVMSKB        = Op(693,  "vpmovmskb",       Ext::AVX);
+		constexpr auto VMOVQ2DQ         = Op(694,  "vmovq2dq",        Ext::AVX);
+		constexpr auto VADDSUBPD        = Op(695,  "vaddsubpd",       Ext::AVX);
+		constexpr auto VMOVQ            = Op(696,  "vmovq",           Ext::AVX);
+		constexpr auto VADDSUBPS        = Op(697,  "vaddsubps",       Ext::AVX);
+		constexpr auto VMOVDQ2Q         = Op(698,  "vmovdq2q",        Ext::AVX);
+		constexpr auto VPAVGB           = Op(699,  "vpavgb",          Ext::AVX);
+		constexpr auto VPSRAW           = Op(700,  "vpsraw",          Ext::AVX);
+		constexpr auto VPSRAD           = Op(701,  "vpsrad",          Ext::AVX);
+		constexpr auto VPAVGW           = Op(702,  "vpavgw",          Ext::AVX);
+		constexpr auto VPMULHUW         = Op(703,  "vpmulhuw",        Ext::AVX);
+		constexpr auto VPMULHW          = Op(704,  "vpmulhw",         Ext::AVX);
+		constexpr auto VMOVNTQ          = Op(705,  "vmovntq",         Ext::AVX);
+		constexpr auto VCVTDQ2PS        = Op(706,  "vcvtdq2ps",       Ext::AVX);
+		constexpr auto VCVTDQ2PD        = Op(707,  "vcvtdq2pd",       Ext::AVX);
+		constexpr auto VCVTTPD2DQ       = Op(708,  "vcvttpd2dq",      Ext::AVX);
+		constexpr auto VMOVNTDQ         = Op(709,  "vmovntdq",        Ext::AVX);
+		constexpr auto VCVTPD2DQ        = Op(710,  "vcvtpd2dq",       Ext::AVX);
+		constexpr auto VPSLLW           = Op(711,  "vpsllw",          Ext::AVX);
+		constexpr auto VPSLLD           = Op(712,  "vpslld",          Ext::AVX);
+		constexpr auto VPSLLQ           = Op(713,  "vpsllq",          Ext::AVX);
+		constexpr auto VPSLLDQ          = Op(714,  "vpslldq",         Ext::AVX);
+		constexpr auto VPMULUDQ         = Op(715,  "vpmuludq",        Ext::AVX);
+		constexpr auto VPMADDWD         = Op(716,  "vpmaddwd",        Ext::AVX);
+		constexpr auto VPSADBW          = Op(717,  "vpsadbw",         Ext::AVX);
+		constexpr auto VMASKMOVQ        = Op(718,  "vmaskmovq",       Ext::AVX);
+		constexpr auto VMASKMOVDQU      = Op(719,  "vmaskmovdqu",     Ext::AVX);
+		constexpr auto VLDDQU           = Op(720,  "vlddqu",          Ext::AVX);
+		constexpr auto VMOVAPS          = Op(721,  "vmovaps",         Ext::AVX);
+		constexpr auto VMOVAPD          = Op(722,  "vmovapd",         Ext::AVX);
+		constexpr auto VCVTPI2PS        = Op(723,  "vcvtpi2ps",       Ext::AVX);
+		constexpr auto VMOVNTPS         = Op(724,  "vmovntps",        Ext::AVX);
+		constexpr auto VCVTTPS2PI       = Op(725,  "vcvttps2pi",      Ext::AVX);
+		constexpr auto VCVTPS2PI        = Op(726,  "vcvtps2pi",       Ext::AVX);
+		constexpr auto VUCOMISS         = Op(727,  "vucomiss",        Ext::AVX);
+		constexpr auto VCOMISS          = Op(728,  "vcomiss",         Ext::AVX);
+		constexpr auto VCVTSI2SS        = Op(729,  "vcvtsi2ss",       Ext::AVX);
+		constexpr auto VMOVNTSS         = Op(730,  "vmovntss",        Ext::AVX);
+		constexpr auto VCVTTSS2SI       = Op(731,  "vcvttss2si",      Ext::AVX);
+		constexpr auto VCVTSS2SI        = Op(732,  "vcvtss2si",       Ext::AVX);
+		constexpr auto VCVTPI2PD        = Op(733,  "vcvtpi2pd",       Ext::AVX);
+		constexpr auto VMOVNTPD         = Op(734,  "vmovntpd",        Ext::AVX);
+		constexpr auto VCVTTPD2PI       = Op(735,  "vcvttpd2pi",      Ext::AVX);
+		constexpr auto VCVTPD2PI        = Op(736,  "vcvtpd2pi",       Ext::AVX);
+		constexpr auto VUCOMISD         = Op(737,  "vucomisd",        Ext::AVX);
+		constexpr auto VCOMISD          = Op(738,  "vcomisd",         Ext::AVX);
+		constexpr auto VCVTSI2SD        = Op(739,  "vcvtsi2sd",       Ext::AVX);
+		constexpr auto VMOVNTSD         = Op(740,  "vmovntsd",        Ext::AVX);
+		constexpr auto VCVTTSD2SI       = Op(741,  "vcvttsd2si",      Ext::AVX);
+		constexpr auto VCVTSD2SI        = Op(742,  "vcvtsd2si",       Ext::AVX);
+		constexpr auto VADDPS           = Op(743,  "vaddps",          Ext::AVX);
+		constexpr auto VMULPS           = Op(744,  "vmulps",          Ext::AVX);
+		constexpr auto VCVTPS2PD        = Op(745,  "vcvtps2pd",       Ext::AVX);
+		constexpr auto VCVTPQ2PS        = Op(746,  "vcvtpq2ps",       Ext::AVX);
+		constexpr auto VSUBPS           = Op(747,  "vsubps",          Ext::AVX);
+		constexpr auto VMINPS           = Op(748,  "vminps",          Ext::AVX);
+		constexpr auto VDIVPS           = Op(749,  "vdivps",          Ext::AVX);
+		constexpr auto VMAXPS           = Op(750,  "vmaxps",          Ext::AVX);
+		constexpr auto VADDSS           = Op(751,  "vaddss",          Ext::AVX);
+		constexpr auto VMULSS           = Op(752,  "vmulss",          Ext::AVX);
+		constexpr auto VCVTSS2SD        = Op(753,  "vcvtss2sd",       Ext::AVX);
+		constexpr auto VCVTTPS2DQ       = Op(754,  "vcvttps2dq",      Ext::AVX);
+		constexpr auto VSUBSS           = Op(755,  "vsubss",          Ext::AVX);
+		constexpr auto VMINSS           = Op(756,  "vminss",          Ext::AVX);
+		constexpr auto VDIVSS           = Op(757,  "vdivss",          Ext::AVX);
+		constexpr auto VMAXSS           = Op(758,  "vmaxss",          Ext::AVX);
+		constexpr auto VADDPD           = Op(759,  "vaddpd",          Ext::AVX);
+		constexpr auto VMULPD           = Op(760,  "vmulpd",          Ext::AVX);
+		constexpr auto VCVTPD2PS        = Op(761,  "vcvtpd2ps",       Ext::AVX);
+		constexpr auto VCVTPS2DQ        = Op(762,  "vcvtps2dq",       Ext::AVX);
+		constexpr auto VSUBPD           = Op(763,  "vsubpd",          Ext::AVX);
+		constexpr auto VMINPD           = Op(764,  "vminpd",          Ext::AVX);
+		constexpr auto VDIVPD           = Op(765,  "vdivpd",          Ext::AVX);
+		constexpr auto VMAXPD           = Op(766,  "vmaxpd",          Ext::AVX);
+		constexpr auto VADDSD           = Op(767,  "vaddsd",          Ext::AVX);
+		constexpr auto VMULSD           = Op(768,  "vmulsd",          Ext::AVX);
+		constexpr auto VCVTSD2SS        = Op(769,  "vcvtsd2ss",       Ext::AVX);
+		constexpr auto VSUBSD           = Op(770,  "vsubsd",          Ext::AVX);
+		constexpr auto VMINSD           = Op(771,  "vminsd",          Ext::AVX);
+		constexpr auto VDIVSD           = Op(772,  "vdivsd",          Ext::AVX);
+		constexpr auto VMAXSD           = Op(773,  "vmaxsd",          Ext::AVX);
+		constexpr auto VPUNPCKHBW       = Op(774,  "vpunpckhbw",      Ext::AVX);
+		constexpr auto VPUNPCKHWD       = Op(775,  "vpunpckhwd",      Ext::AVX);
+		constexpr auto VPUNPCKHDQ       = Op(776,  "vpunpckhdq",      Ext::AVX);
+		constexpr auto VPACKSSDW        = Op(777,  "vpackssdw",       Ext::AVX);
+		constexpr auto VMOVD            = Op(778,  "vmovd",           Ext::AVX);
+		constexpr auto VMOVDQU          = Op(779,  "vmovdqu",         Ext::AVX);
+		constexpr auto VPUNPCKLQDQ      = Op(780,  "vpunpcklqdq",     Ext::AVX);
+		constexpr auto VPUNPCKHQDQ      = Op(781,  "vpunpckhqdq",     Ext::AVX);
+		constexpr auto VMOVDQA          = Op(782,  "vmovdqa",         Ext::AVX);
+		constexpr auto VEXTRQ           = Op(783,  "vextrq",          Ext::AVX);
+		constexpr auto VHADDPD          = Op(784,  "vhaddpd",         Ext::AVX);
+		constexpr auto VHSUBPD          = Op(785,  "vhsubpd",         Ext::AVX);
+		constexpr auto VINSERTQ         = Op(786,  "vinsertq",        Ext::AVX);
+		constexpr auto VHADDPS          = Op(787,  "vhaddps",         Ext::AVX);
+		constexpr auto VHSUBPS          = Op(788,  "vhsubps",         Ext::AVX);
+		constexpr auto VTZCNT           = Op(789,  "vtzcnt",          Ext::AVX);
+		constexpr auto VLZCNT           = Op(790,  "vlzcnt",          Ext::AVX);
+		constexpr auto VPOPCNT          = Op(791,  "vpopcnt",         Ext::AVX);
+		constexpr auto VPSUBUSB         = Op(792,  "vpsubusb",        Ext::AVX);
+		constexpr auto VPSUBUSW         = Op(793,  "vpsubusw",        Ext::AVX);
+		constexpr auto VPMINUB          = Op(794,  "vpminub",         Ext::AVX);
+		constexpr auto VPAND            = Op(795,  "vpand",           Ext::AVX);
+		constexpr auto VPADDUSB         = Op(796,  "vpaddusb",        Ext::AVX);
+		constexpr auto VPADDUSW         = Op(797,  "vpaddusw",        Ext::AVX);
+		constexpr auto VPMAXUB          = Op(798,  "vpmaxub",         Ext::AVX);
+		constexpr auto VPANDN           = Op(799,  "vpandn",          Ext::AVX);
+		constexpr auto VPSUBSB          = Op(800,  "vpsubsb",         Ext::AVX);
+		constexpr auto VPSUBSW          = Op(801,  "vpsubsw",         Ext::AVX);
+		constexpr auto VPMINSW          = Op(802,  "vpminsw",         Ext::AVX);
+		constexpr auto VPOR             = Op(803,  "vpor",            Ext::AVX);
+		constexpr auto VPADDSB          = Op(804,  "vpaddsb",         Ext::AVX);
+		constexpr auto VPADDSW          = Op(805,  "vpaddsw",         Ext::AVX);
+		constexpr auto VPMAXSW          = Op(806,  "vpmaxsw",         Ext::AVX);
+		constexpr auto VPXOR            = Op(807,  "vpxor",           Ext::AVX);
+		constexpr auto VPSUBB           = Op(808,  "vpsubb",          Ext::AVX);
+		constexpr auto VPSUBW           = Op(809,  "vpsubw",          Ext::AVX);
+		constexpr auto VPSUBD           = Op(810,  "vpsubd",          Ext::AVX);
+		constexpr auto VPSUBQ           = Op(811,  "vpsubq",          Ext::AVX);
+		constexpr auto VPADDB           = Op(812,  "vpaddb",          Ext::AVX);
+		constexpr auto VPADDW           = Op(813,  "vpaddw",          Ext::AVX);
+		constexpr auto VPADDD           = Op(814,  "vpaddd",          Ext::AVX);
+		constexpr auto VPSHUFB          = Op(815,  "vpshufb",         Ext::AVX);
+		constexpr auto VPHADDW          = Op(816,  "vphaddw",         Ext::AVX);
+		constexpr auto VPHADDD          = Op(817,  "vphaddd",         Ext::AVX);
+		constexpr auto VPHADDSW         = Op(818,  "vphaddsw",        Ext::AVX);
+		constexpr auto VPMADDUBSW       = Op(819,  "vpmaddubsw",      Ext::AVX);
+		constexpr auto VPHSUBW          = Op(820,  "vphsubw",         Ext::AVX);
+		constexpr auto VPHSUBD          = Op(821,  "vphsubd",         Ext::AVX);
+		constexpr auto VPHSUBSW         = Op(822,  "vphsubsw",        Ext::AVX);
+		constexpr auto VPSIGNB          = Op(823,  "vpsignb",         Ext::AVX);
+		constexpr auto VPSIGNW          = Op(824,  "vpsignw",         Ext::AVX);
+		constexpr auto VPSIGND          = Op(825,  "vpsignd",         Ext::AVX);
+		constexpr auto VPMULHRSW        = Op(826,  "vpmulhrsw",       Ext::AVX);
+		constexpr auto VPBLENDVB        = Op(827,  "vpblendvb",       Ext::AVX);
+		constexpr auto VBLENDVPS        = Op(828,  "vblendvps",       Ext::AVX);
+		constexpr auto VBLENDVPD        = Op(829,  "vblendvpd",       Ext::AVX);
+		constexpr auto VPTEST           = Op(830,  "vptest",          Ext::AVX);
+		constexpr auto VPMOVSXBW        = Op(831,  "vpmovsxbw",       Ext::AVX);
+		constexpr auto VPMOVSXBD        = Op(832,  "vpmovsxbd",       Ext::AVX);
+		constexpr auto VPMOVSXBQ        = Op(833,  "vpmovsxbq",       Ext::AVX);
+		constexpr auto VPMOVSXWD        = Op(834,  "vpmovsxwd",       Ext::AVX);
+		constexpr auto VPMOVSXWQ        = Op(835,  "vpmovsxwq",       Ext::AVX);
+		constexpr auto VPMOVSXDQ        = Op(836,  "vpmovsxdq",       Ext::AVX);
+		constexpr auto VPMOVZXBW        = Op(837,  "vpmovzxbw",       Ext::AVX);
+		constexpr auto VPMOVZXBD        = Op(838,  "vpmovzxbd",       Ext::AVX);
+		constexpr auto VPMOVZXBQ        = Op(839,  "vpmovzxbq",       Ext::AVX);
+		constexpr auto VPMOVZXWD        = Op(840,  "vpmovzxwd",       Ext::AVX);
+		constexpr auto VPMOVZXWQ        = Op(841,  "vpmovzxwq",       Ext::AVX);
+		constexpr auto VPMOVZXDQ        = Op(842,  "vpmovzxdq",       Ext::AVX);
+		constexpr auto VPCMPGTQ         = Op(843,  "vpcmpgtq",        Ext::AVX);
+		constexpr auto VPMULLD          = Op(844,  "vpmulld",         Ext::AVX);
+		constexpr auto VPHMINPOSUW      = Op(845,  "vphminposuw",     Ext::AVX);
+		constexpr auto VMOVBE           = Op(846,  "vmovbe",          Ext::AVX);
+		constexpr auto VCRC32           = Op(847,  "vcrc32",          Ext::AVX);
+		constexpr auto VPABSB           = Op(848,  "vpabsb",          Ext::AVX);
+		constexpr auto VPABSW           = Op(849,  "vpabsw",          Ext::AVX);
+		constexpr auto VPABSD           = Op(850,  "vpabsd",          Ext::AVX);
+		constexpr auto VPMULDQ          = Op(851,  "vpmuldq",         Ext::AVX);
+		constexpr auto VPCMPEQQ         = Op(852,  "vpcmpeqq",        Ext::AVX);
+		constexpr auto VMOVNTDQA        = Op(853,  "vmovntdqa",       Ext::AVX);
+		constexpr auto VPACKUSDW        = Op(854,  "vpackusdw",       Ext::AVX);
+		constexpr auto VPMINSB          = Op(855,  "vpminsb",         Ext::AVX);
+		constexpr auto VPMINSD          = Op(856,  "vpminsd",         Ext::AVX);
+		constexpr auto VPMINUW          = Op(857,  "vpminuw",         Ext::AVX);
+		constexpr auto VPMINUD          = Op(858,  "vpminud",         Ext::AVX);
+		constexpr auto VPMAXSB          = Op(859,  "vpmaxsb",         Ext::AVX);
+		constexpr auto VPMAXSD          = Op(860,  "vpmaxsd",         Ext::AVX);
+		constexpr auto VPMAXUW          = Op(861,  "vpmaxuw",         Ext::AVX);
+		constexpr auto VPMAXUD          = Op(862,  "vpmaxud",         Ext::AVX);
+		constexpr auto VAESIMC          = Op(863,  "vaesimc",         Ext::AES);
+		constexpr auto VAESENC          = Op(864,  "vaesenc",         Ext::AES);
+		constexpr auto VAESENCLAST      = Op(865,  "vaesenclast",     Ext::AES);
+		constexpr auto VAESDEC          = Op(866,  "vaesdec",         Ext::AES);
+		constexpr auto VAESDECLAST      = Op(867,  "vaesdeclast",     Ext::AES);
+		constexpr auto VPEXTRB          = Op(868,  "vpextrb",         Ext::AVX);
+		constexpr auto VPEXTRD          = Op(869,  "vpextrd",         Ext::AVX);
+		constexpr auto VEXTRACTPS       = Op(870,  "vextractps",      Ext::AVX);
+		constexpr auto VPINSRB          = Op(871,  "vpinsrb",         Ext::AVX);
+		constexpr auto VINSERTPS        = Op(872,  "vinsertps",       Ext::AVX);
+		constexpr auto VPINSRD          = Op(873,  "vpinsrd",         Ext::AVX);
+		constexpr auto VDPPS            = Op(874,  "vdpps",           Ext::AVX);
+		constexpr auto VDPPD            = Op(875,  "vdppd",           Ext::AVX);
+		constexpr auto VMPSADBW         = Op(876,  "vmpsadbw",        Ext::AVX);
+		constexpr auto VPCLMULQDQ       = Op(877,  "vpclmulqdq",      Ext::CLMUL);
+		constexpr auto VPCMPESTRM       = Op(878,  "vpcmpestrm",      Ext::AVX);
+		constexpr auto VPCMPESTRI       = Op(879,  "vpcmpestri",      Ext::AVX);
+		constexpr auto VPCMPISTRM       = Op(880,  "vpcmpistrm",      Ext::AVX);
+		constexpr auto VPCMPISTRI       = Op(881,  "vpcmpistri",      Ext::AVX);
+		constexpr auto VPALIGNR         = Op(882,  "vpalignr",        Ext::AVX);
+		constexpr auto VROUNDPS         = Op(883,  "vroundps",        Ext::AVX);
+		constexpr auto VROUNDPD         = Op(884,  "vroundpd",        Ext::AVX);
+		constexpr auto VROUNDSS         = Op(885,  "vroundss",        Ext::AVX);
+		constexpr auto VROUNDSD         = Op(886,  "vroundsd",        Ext::AVX);
+		constexpr auto VBLENDPS         = Op(887,  "vblendps",        Ext::AVX);
+		constexpr auto VBLENDPD         = Op(888,  "vblendpd",        Ext::AVX);
+		constexpr auto VPBLENDW         = Op(889,  "vpblendw",        Ext::AVX);
+		constexpr auto VZEROALL         = Op(890,  "vzeroall",        Ext::AVX);
+		constexpr auto VZEROUPPER       = Op(891,  "vzeroupper",      Ext::AVX);
+		constexpr auto VLDMXCSR         = Op(892,  "vldmxcsr",        Ext::AVX);
+		constexpr auto VSTMXCSR         = Op(893,  "vstmxcsr",        Ext::AVX);
+
+
+		constexpr auto BLSR             = Op(894,  "blsr",            Ext::BMI1);
+		constexpr auto BLSMSK           = Op(895,  "blsmsk",          Ext::BMI1);
+		constexpr auto BLSI             = Op(896,  "blsi",            Ext::BMI1);
+		constexpr auto VPERMILPS        = Op(897,  "vpermilps",       Ext::AVX);
+		constexpr auto VPERMILPD        = Op(898,  "vpermilpd",       Ext::AVX);
+		constexpr auto VTESTPS          = Op(899,  "vtestps",         Ext::AVX);
+		constexpr auto VTESTPD          = Op(900,  "vtestpd",         Ext::AVX);
+		constexpr auto VCVTPH2PS        = Op(901,  "vcvtph2ps",       Ext::F16C);
+		constexpr auto VPERMPS          = Op(902,  "vpermps",         Ext::AVX2);
+
+
+		constexpr auto VBROADCASTSS     = Op(903,  "vbroadcastss",    Ext::AVX);
+		constexpr auto VBROADCASTSD     = Op(904,  "vbroadcastsd",    Ext::AVX);
+		constexpr auto VBROADCASTF128   = Op(905,  "vbroadcastf128",  Ext::AVX);
+		constexpr auto VMASKMOVPS       = Op(906,  "vmaskmovps",      Ext::AVX);
+		constexpr auto VMASKMOVPD       = Op(907,  "vmaskmovpd",      Ext::AVX);
+		constexpr auto VPERMD           = Op(908,  "vpermd",          Ext::AVX2);
+		constexpr auto VPSRLVD          = Op(909,  "vpsrlvd",         Ext::AVX2);
+		constexpr auto VPSRLVQ          = Op(910,  "vpsrlvq",         Ext::AVX2);
+
+		constexpr auto VPRAVD           = Op(911,  "vpravd",          Ext::AVX2);
+		constexpr auto VPSLLVD          = Op(912,  "vpsllvd",         Ext::AVX2);
+		constexpr auto VPSLLVQ          = Op(913,  "vpsllvq",         Ext::AVX2);
+		constexpr auto VPBROADCASTD     = Op(914,  "vpbroadcastd",    Ext::AVX2);
+		constexpr auto VPBROADCASTI128  = Op(915,  "vpbroadcasti128", Ext::AVX2);
+		constexpr auto VPBROADCASTB     = Op(916,  "vpbroadcastb",    Ext::AVX2);
+		constexpr auto VPBROADCASTW     = Op(917,  "vpbroadcastw",    Ext::AVX2);
+		constexpr auto VPMASKMOVD       = Op(918,  "vpmaskmovd",      Ext::AVX2);
+		constexpr auto VPMASKMOVQ       = Op(919,  "vpmaskmovq",      Ext::AVX2);
+		constexpr auto VFMADDSUB132PS   = Op(920,  "vfmaddsub132ps",  Ext::FMA);
+		constexpr auto VFMADDSUB132PD   = Op(921,  "vfmaddsub132pd",  Ext::FMA);
+		constexpr auto VFMSUBADD132PS   = Op(922,  "vfmsubadd132ps",  Ext::FMA);
+		constexpr auto VFMSUBADD132PD   = Op(923,  "vfmsubadd132pd",  Ext::FMA);
+		constexpr auto VFMADD132PS      = Op(924,  "vfmadd132ps",     Ext::FMA);
+		constexpr auto VFMADD132PD      = Op(925,  "vfmadd132pd",     Ext::FMA);
+		constexpr auto VFMADD132SS      = Op(926,  "vfmadd132ss",     Ext::FMA);
+		constexpr auto VFMADD132SD      = Op(927,  "vfmadd132sd",     Ext::FMA);
+		constexpr auto VFMSUB132PS      = Op(928,  "vfmsub132ps",     Ext::FMA);
+		constexpr auto VFMSUB132PD      = Op(929,  "vfmsub132pd",     Ext::FMA);
+		constexpr auto VFMSUB132SS      = Op(930,  "vfmsub132ss",     Ext::FMA);
+		constexpr auto VFMSUB132SD      = Op(931,  "vfmsub132sd",     Ext::FMA);
+		constexpr auto VFNMADD132PS     = Op(932,  "vfnmadd132ps",    Ext::FMA);
+		constexpr auto VFNMADD132PD     = Op(933,  "vfnmadd132pd",    Ext::FMA);
+		constexpr auto VFNMADD132SS     = Op(934,  "vfnmadd132ss",    Ext::FMA);
+		constexpr auto VFNMADD132SD     = Op(935,  "vfnmadd132sd",    Ext::FMA);
+		constexpr auto VFNMSUB132PS     = Op(936,  "vfnmsub132ps",    Ext::FMA);
+		constexpr auto VFNMSUB132PD     = Op(937,  "vfnmsub132pd",    Ext::FMA);
+		constexpr auto VFNMSUB132SS     = Op(938,  "vfnmsub132ss",    Ext::FMA);
+		constexpr auto VFNMSUB132SD     = Op(939,  "vfnmsub132sd",    Ext::FMA);
+		constexpr auto VFMADDSUB213PS   = Op(940,  "vfmaddsub213ps",  Ext::FMA);
+		constexpr auto VFMADDSUB213PD   = Op(941,  "vfmaddsub213pd",  Ext::FMA);
+		constexpr auto VFMSUBADD213PS   = Op(942,  "vfmsubadd213ps",  Ext::FMA);
+		constexpr auto VFMSUBADD213PD   = Op(943,  "vfmsubadd213pd",  Ext::FMA);
+		constexpr auto VFMADD213PS      = Op(944,  "vfmadd213ps",     Ext::FMA);
+		constexpr auto VFMADD213PD      = Op(945,  "vfmadd213pd",     Ext::FMA);
+		constexpr auto VFMADD213SS      = Op(946,  "vfmadd213ss",     Ext::FMA);
+		constexpr auto VFMADD213SD      = Op(947,  "vfmadd213sd",     Ext::FMA);
+		constexpr auto VFMSUB213PS      = Op(948,  "vfmsub213ps",     Ext::FMA);
+		constexpr auto VFMSUB213PD      = Op(949,  "vfmsub213pd",     Ext::FMA);
+		constexpr auto VFMSUB213SS      = Op(950,  "vfmsub213ss",     Ext::FMA);
+		constexpr auto VFMSUB213SD      = Op(951,  "vfmsub213sd",     Ext::FMA);
+		constexpr auto VFNMADD213PS     = Op(952,  "vfnmadd213ps",    Ext::FMA);
+		constexpr auto VFNMADD213PD     = Op(953,  "vfnmadd213pd",    Ext::FMA);
+		constexpr auto VFNMADD213SS     = Op(954,  "vfnmadd213ss",    Ext::FMA);
+		constexpr auto VFNMADD213SD     = Op(955,  "vfnmadd213sd",    Ext::FMA);
+		constexpr auto VFNMSUB213PS     = Op(956,  "vfnmsub213ps",    Ext::FMA);
+		constexpr auto VFNMSUB213PD     = Op(957,  "vfnmsub213pd",    Ext::FMA);
+		constexpr auto VFNMSUB213SS     = Op(958,  "vfnmsub213ss",    Ext::FMA);
+		constexpr auto VFNMSUB213SD     = Op(959,  "vfnmsub213sd",    Ext::FMA);
+		constexpr auto VFMADDSUB231PS   = Op(960,  "vfmaddsub231ps",  Ext::FMA);
+		constexpr auto VFMADDSUB231PD   = Op(961,  "vfmaddsub231pd",  Ext::FMA);
+		constexpr auto VFMSUBADD231PS   = Op(962,  "vfmsubadd231ps",  Ext::FMA);
+		constexpr auto VFMSUBADD231PD   = Op(963,  "vfmsubadd231pd",  Ext::FMA);
+		constexpr auto VFMADD231PS      = Op(964,  "vfmadd231ps",     Ext::FMA);
+		constexpr auto VFMADD231PD      = Op(965,  "vfmadd231pd",     Ext::FMA);
+		constexpr auto VFMADD231SS      = Op(966,  "vfmadd231ss",     Ext::FMA);
+		constexpr auto VFMADD231SD      = Op(967,  "vfmadd231sd",     Ext::FMA);
+		constexpr auto VFMSUB231PS      = Op(968,  "vfmsub231ps",     Ext::FMA);
+		constexpr auto VFMSUB231PD      = Op(969,  "vfmsub231pd",     Ext::FMA);
+		constexpr auto VFMSUB231SS      = Op(970,  "vfmsub231ss",     Ext::FMA);
+		constexpr auto VFMSUB231SD      = Op(971,  "vfmsub231sd",     Ext::FMA);
+		constexpr auto VFNMADD231PS     = Op(972,  "vfnmadd231ps",    Ext::FMA);
+		constexpr auto VFNMADD231PD     = Op(973,  "vfnmadd231pd",    Ext::FMA);
+		constexpr auto VFNMADD231SS     = Op(974,  "vfnmadd231ss",    Ext::FMA);
+		constexpr auto VFNMADD231SD     = Op(975,  "vfnmadd231sd",    Ext::FMA);
+		constexpr auto VFNMSUB231PS     = Op(976,  "vfnmsub231ps",    Ext::FMA);
+		constexpr auto VFNMSUB231PD     = Op(977,  "vfnmsub231pd",    Ext::FMA);
+		constexpr auto VFNMSUB231SS     = Op(978,  "vfnmsub231ss",    Ext::FMA);
+		constexpr auto VFNMSUB231SD     = Op(979,  "vfnmsub231sd",    Ext::FMA);
+		constexpr auto ANDN             = Op(980,  "andn",            Ext::BMI1);
+		constexpr auto BZHI             = Op(981,  "bzhi",            Ext::BMI2);
+		constexpr auto PDEP             = Op(982,  "pdep",            Ext::BMI2);
+		constexpr auto PEXT             = Op(983,  "pext",            Ext::BMI2);
+		constexpr auto BEXTR            = Op(984,  "bextr",           Ext::BMI1);
+		constexpr auto RORX             = Op(985,  "rorx",            Ext::BMI2);
+		constexpr auto SHLX             = Op(986,  "shlx",            Ext::BMI2);
+		constexpr auto SHRX             = Op(987,  "shrx",            Ext::BMI2);
+		constexpr auto SARX             = Op(988,  "sarx",            Ext::BMI2);
+		constexpr auto VPERMQ           = Op(989,  "vpermq",          Ext::AVX2);
+		constexpr auto VPERMPD          = Op(990,  "vpermpd",         Ext::AVX2);
+		constexpr auto VPBLENDD         = Op(991,  "vpblendd",        Ext::AVX2);
+		constexpr auto VPERM2F128       = Op(992,  "vperm2f128",      Ext::AVX);
+		constexpr auto VBLENDW          = Op(993,  "vblendw",         Ext::AVX);
+		constexpr auto VPEXTRQ          = Op(994,  "vpextrq",         Ext::AVX);
+		constexpr auto VINSERTF128      = Op(995,  "vinsertf128",     Ext::AVX);
+		constexpr auto VCVTPS2PH        = Op(996,  "vcvtps2ph",       Ext::F16C);
+		constexpr auto VINSERTI128      = Op(997,  "vinserti128",     Ext::AVX2);
+		constexpr auto VEXTRACTI128     = Op(998,  "vextracti128",    Ext::AVX2);
+		constexpr auto VPERM2I128       = Op(999, "vperm2i128",      Ext::AVX2);
+		constexpr auto VFMADDSUBPS      = Op(1000, "vfmaddsubps",     Ext::FMA4);
+		constexpr auto VFMADDSUBPD      = Op(1001, "vfmaddsubpd",     Ext::FMA4);
+		constexpr auto VFMADDSUBSS      = Op(1002, "vfmaddsubss",     Ext::FMA4);
+		constexpr auto VFMADDSUBSD      = Op(1003, "vfmaddsubsd",     Ext::FMA4);
+		constexpr auto VFMSUBADDPS      = Op(1004, "vfmsubaddps",     Ext::FMA4);
+		constexpr auto VFMSUBADDPD      = Op(1005, "vfmsubaddpd",     Ext::FMA4);
+		constexpr auto VFMSUBADDSS      = Op(1006, "vfmsubaddss",     Ext::FMA4);
+		constexpr auto VFMSUBADDSD      = Op(1007, "vfmsubaddsd",     Ext::FMA4);
+		constexpr auto VFMADDPS         = Op(1008, "vfmaddps",        Ext::FMA4);
+		constexpr auto VFMADDPD         = Op(1009, "vfmaddpd",        Ext::FMA4);
+		constexpr auto VFMADDSS         = Op(1010, "vfmaddss",        Ext::FMA4);
+		constexpr auto VFMADDSD         = Op(1011, "vfmaddsd",        Ext::FMA4);
+		constexpr auto VFMSUBPS         = Op(1012, "vfmsubps",        Ext::FMA4);
+		constexpr auto VFMSUBPD         = Op(1013, "vfmsubpd",        Ext::FMA4);
+		constexpr auto VFMSUBSS         = Op(1014, "vfmsubss",        Ext::FMA4);
+		constexpr auto VFMSUBSD         = Op(1015, "vfmsubsd",        Ext::FMA4);
+		constexpr auto VFNMADDPS        = Op(1016, "vfnmaddps",       Ext::FMA4);
+		constexpr auto VFNMADDPD        = Op(1017, "vfnmaddpd",       Ext::FMA4);
+		constexpr auto VFNMADDSS        = Op(1018, "vfnmaddss",       Ext::FMA4);
+		constexpr auto VFNMADDSD        = Op(1019, "vfnmaddsd",       Ext::FMA4);
+		constexpr auto VFNMSUBPS        = Op(1020, "vfnmsubps",       Ext::FMA4);
+		constexpr auto VFNMSUBPD        = Op(1021, "vfnmsubpd",       Ext::FMA4);
+		constexpr auto VFNMSUBSS        = Op(1022, "vfnmsubss",       Ext::FMA4);
+		constexpr auto VFNMSUBSD        = Op(1023, "vfnmsubsd",       Ext::FMA4);
+		constexpr auto VPGATHERDD       = Op(1024, "vpgatherdd",      Ext::AVX2);
+		constexpr auto VPGATHERQD       = Op(1025, "vpgatherqd",      Ext::AVX2);
+		constexpr auto VGATHERDPS       = Op(1026, "vgatherdps",      Ext::AVX2);
+		constexpr auto VGATHERQPS       = Op(1027, "vgatherqps",      Ext::AVX2);
+		constexpr auto VEXTRACTF128     = Op(1028, "vextractf128",    Ext::AVX);
+
+		// one more than the largest id above; tables indexed by op id are sized with this, so bump it
+		// when adding ops.
+		constexpr size_t COUNT          = 1029;
 	}
 }
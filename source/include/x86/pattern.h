@@ -0,0 +1,519 @@
+// pattern.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	// a small query language for sequences of instructions, in intel syntax:
+	//
+	//   mov r64, [rsp + imm]; call *
+	//
+	// instructions are separated by `;`. each one is a mnemonic (or `*` for any) followed by its
+	// operands; if no operands are given, any operands (including none) will do. operands can be:
+	//
+	//   *                      anything
+	//   rax, xmm3, ...         that exact register
+	//   reg                    any register
+	//   reg8, r16, r32, r64    any register of that width (`r8` is the register r8, not a wildcard)
+	//   xmm, ymm               any sse/avx register of that width
+	//   imm, 0x10, -4          any immediate, or that exact one
+	//   rel                    a relative branch target
+	//   mem                    any memory operand
+	//   [base + idx*s + disp]  a memory operand of that shape. each part is a register pattern (or
+	//                          a number/imm, for the displacement); the scale can be `*`. parts that
+	//                          are left out must be absent, so `[rsp]` won't match `[rsp + 8]`.
+	//                          a size (byte, word, dword, qword; `ptr` is optional) can come first.
+	namespace pattern
+	{
+		enum class Kind : uint8_t { Any, Register, Immediate, Relative, Memory };
+
+		// a wildcard that matches some registers.
+		struct RegPattern
+		{
+			enum class Type : uint8_t { None, Any, Width, Vector, Exact };
+
+			Type type = Type::None;
+			short width = 0;
+			std::string name;
+
+			bool matches(const Register& reg) const
+			{
+				switch(this->type)
+				{
+					case Type::None:    return !reg.present();
+					case Type::Any:     return reg.present();
+					case Type::Width:   return reg.present() && reg.index() < 16 && reg.width() == this->width;
+					case Type::Vector:  return reg.present() && (reg.index() & regs::REG_FLAG_SSE) && reg.width() == this->width;
+					case Type::Exact:   return strcmp(reg.name(), this->name.c_str()) == 0;
+				}
+
+				return false;
+			}
+		};
+
+		struct OperandPattern
+		{
+			Kind kind = Kind::Any;
+
+			RegPattern reg;             // Register
+
+			bool anyValue = true;       // Immediate, and the displacement of Memory
+			int64_t value = 0;
+
+			RegPattern base;            // Memory
+			RegPattern index;
+			int scale = 0;              // 0 = any
+			int bits = 0;               // 0 = any size
+			bool anyMemory = false;
+		};
+
+		struct InstrPattern
+		{
+			bool anyOp = false;
+			std::string mnemonic;
+
+			bool anyOperands = true;
+			std::vector<OperandPattern> operands;
+		};
+
+		constexpr Kind kindOf(const Operand& op)
+		{
+			if(op.isRegister())         return Kind::Register;
+			if(op.isImmediate())        return Kind::Immediate;
+			if(op.isRelativeOffset())   return Kind::Relative;
+			if(op.isMemory())           return Kind::Memory;
+
+			return Kind::Any;
+		}
+
+		// displacements are stored without sign extension, and we don't know how big they were.
+		constexpr bool displacementIs(uint64_t disp, int64_t value)
+		{
+			return disp == (uint64_t) value
+				|| (disp <= 0xFF && (int64_t) (int8_t) disp == value)
+				|| (disp <= 0xFFFFFFFF && (int64_t) (int32_t) disp == value);
+		}
+
+		inline std::string trim(const std::string& s)
+		{
+			auto a = s.find_first_not_of(" \t");
+			if(a == std::string::npos)
+				return "";
+
+			return s.substr(a, s.find_last_not_of(" \t") - a + 1);
+		}
+
+		inline bool parseNumber(const std::string& s, int64_t& out)
+		{
+			if(s.empty())
+				return false;
+
+			char* end = nullptr;
+			out = (int64_t) strtoull(s.c_str() + (s[0] == '-' ? 1 : 0), &end, 0);
+			if(s[0] == '-')
+				out = -out;
+
+			return end != nullptr && *end == 0;
+		}
+
+		inline bool parseRegister(const std::string& s, RegPattern& out)
+		{
+			out = RegPattern();
+			if(s == "reg" || s == "*")                  out.type = RegPattern::Type::Any;
+			else if(s == "reg8")                        out.type = RegPattern::Type::Width, out.width = 8;
+			else if(s == "r16" || s == "reg16")         out.type = RegPattern::Type::Width, out.width = 16;
+			else if(s == "r32" || s == "reg32")         out.type = RegPattern::Type::Width, out.width = 32;
+			else if(s == "r64" || s == "reg64")         out.type = RegPattern::Type::Width, out.width = 64;
+			else if(s == "xmm")                         out.type = RegPattern::Type::Vector, out.width = 128;
+			else if(s == "ymm")                         out.type = RegPattern::Type::Vector, out.width = 256;
+			else
+			{
+				if(s.empty() || !isalpha(s[0]))
+					return false;
+
+				for(auto c : s)
+				{
+					if(!isalnum(c))
+						return false;
+				}
+
+				out.type = RegPattern::Type::Exact;
+				out.name = s;
+			}
+
+			return true;
+		}
+
+		inline bool parseMemory(std::string s, OperandPattern& out, std::string& error)
+		{
+			out.kind = Kind::Memory;
+			out.anyValue = false;
+			out.value = 0;
+
+			constexpr std::pair<const char*, int> sizes[] = { { "byte", 8 }, { "word", 16 }, { "dword", 32 }, { "qword", 64 } };
+			for(auto& [name, bits] : sizes)
+			{
+				auto len = strlen(name);
+				if(s.compare(0, len, name) == 0 && s.size() > len && (s[len] == ' ' || s[len] == '['))
+				{
+					out.bits = bits;
+					s = trim(s.substr(len));
+					if(s.compare(0, 3, "ptr") == 0)
+						s = trim(s.substr(3));
+
+					break;
+				}
+			}
+
+			if(s.size() < 2 || s.front() != '[' || s.back() != ']')
+			{
+				error = "expected a memory operand, got '" + s + "'";
+				return false;
+			}
+
+			s = trim(s.substr(1, s.size() - 2));
+			if(s == "*")
+			{
+				out.anyMemory = true;
+				return true;
+			}
+
+			// split on + and -, keeping the sign with the term.
+			auto terms = std::vector<std::string>();
+			size_t start = 0;
+			for(size_t i = 0; i <= s.size(); i++)
+			{
+				if(i == s.size() || ((s[i] == '+' || s[i] == '-') && i > 0))
+				{
+					auto t = trim(s.substr(start, i - start));
+					if(!t.empty() && t[0] == '+')
+						t = trim(t.substr(1));
+
+					terms.push_back(t);
+					start = i;
+				}
+			}
+
+			bool haveDisp = false;
+			for(auto& t : terms)
+			{
+				int64_t num = 0;
+				if(auto star = t.find('*'); star != std::string::npos && t != "*")
+				{
+					auto scale = trim(t.substr(star + 1));
+					if(!parseRegister(trim(t.substr(0, star)), out.index) || (scale != "*" && !parseNumber(scale, num)))
+					{
+						error = "invalid index '" + t + "'";
+						return false;
+					}
+
+					out.scale = (scale == "*") ? 0 : (int) num;
+				}
+				else if(t == "imm" || parseNumber(t, num))
+				{
+					if(haveDisp)
+					{
+						error = "more than one displacement in '" + s + "'";
+						return false;
+					}
+
+					haveDisp = true;
+					out.anyValue = (t == "imm");
+					out.value = num;
+				}
+				else if(out.base.type == RegPattern::Type::None)
+				{
+					if(!parseRegister(t, out.base))
+					{
+						error = "invalid base '" + t + "'";
+						return false;
+					}
+				}
+				else if(out.index.type == RegPattern::Type::None)
+				{
+					if(!parseRegister(t, out.index))
+					{
+						error = "invalid index '" + t + "'";
+						return false;
+					}
+
+					out.scale = 1;
+				}
+				else
+				{
+					error = "too many registers in '" + s + "'";
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		inline bool parseOperand(const std::string& s, OperandPattern& out, std::string& error)
+		{
+			out = OperandPattern();
+			int64_t num = 0;
+
+			if(s == "*")                out.kind = Kind::Any;
+			else if(s == "rel")         out.kind = Kind::Relative;
+			else if(s == "imm")         out.kind = Kind::Immediate;
+			else if(s == "mem")         out.kind = Kind::Memory, out.anyMemory = true;
+			else if(parseNumber(s, num))
+			{
+				out.kind = Kind::Immediate;
+				out.anyValue = false;
+				out.value = num;
+			}
+			else if(s.find('[') != std::string::npos)
+			{
+				return parseMemory(s, out, error);
+			}
+			else if(parseRegister(s, out.reg))
+			{
+				out.kind = Kind::Register;
+			}
+			else
+			{
+				error = "invalid operand '" + s + "'";
+				return false;
+			}
+
+			return true;
+		}
+
+		inline bool matchOperand(const OperandPattern& pat, const Operand& op)
+		{
+			switch(pat.kind)
+			{
+				case Kind::Any:
+					return true;
+
+				case Kind::Register:
+					return pat.reg.matches(op.reg());
+
+				case Kind::Relative:
+					return true;
+
+				case Kind::Immediate: {
+					if(pat.anyValue)
+						return true;
+
+					// compare as many bits as the immediate actually had.
+					auto bits = op.immediateSize();
+					auto mask = (bits >= 64 || bits == 0) ? ~(uint64_t) 0 : (((uint64_t) 1 << bits) - 1);
+					return (op.imm() & mask) == ((uint64_t) pat.value & mask);
+				}
+
+				case Kind::Memory: {
+					auto& mem = op.mem();
+					if(pat.bits != 0 && mem.bits() != pat.bits)
+						return false;
+
+					if(pat.anyMemory)
+						return true;
+
+					return pat.base.matches(mem.base()) && pat.index.matches(mem.index())
+						&& (!mem.index().present() || pat.scale == 0 || mem.scale() == pat.scale)
+						&& (pat.anyValue || displacementIs(mem.displacement(), pat.value));
+				}
+			}
+
+			return false;
+		}
+	}
+
+	struct Pattern
+	{
+		std::vector<pattern::InstrPattern> instrs;
+
+		size_t size() const { return this->instrs.size(); }
+	};
+
+	// compiles the query; on failure, returns false and describes the problem in `error`.
+	inline bool compilePattern(const std::string& source, Pattern& out, std::string& error)
+	{
+		using namespace pattern;
+
+		out = Pattern();
+
+		auto text = source;
+		for(auto& c : text)
+			c = (char) tolower(c);
+
+		size_t start = 0;
+		while(start <= text.size())
+		{
+			auto semi = text.find(';', start);
+			if(semi == std::string::npos)
+				semi = text.size();
+
+			auto part = trim(text.substr(start, semi - start));
+			start = semi + 1;
+
+			if(part.empty())
+				continue;
+
+			auto ip = InstrPattern();
+			auto space = part.find_first_of(" \t");
+			auto mnem = part.substr(0, space);
+
+			ip.anyOp = (mnem == "*");
+			ip.mnemonic = mnem;
+
+			if(space != std::string::npos)
+			{
+				ip.anyOperands = false;
+
+				auto rest = part.substr(space);
+				size_t s = 0;
+				while(s <= rest.size())
+				{
+					auto comma = rest.find(',', s);
+					if(comma == std::string::npos)
+						comma = rest.size();
+
+					auto op = OperandPattern();
+					if(!parseOperand(trim(rest.substr(s, comma - s)), op, error))
+						return false;
+
+					ip.operands.push_back(op);
+					s = comma + 1;
+				}
+			}
+
+			out.instrs.push_back(std::move(ip));
+		}
+
+		if(out.instrs.empty())
+		{
+			error = "empty pattern";
+			return false;
+		}
+
+		return true;
+	}
+
+	// matches a compiled pattern against instructions. the cheap checks (op id, number and kinds of
+	// operands) are done first; the op id check is memoised per id, so the mnemonic is only compared
+	// as a string the first time each op is seen. not thread-safe; use one per thread.
+	struct PatternMatcher
+	{
+		PatternMatcher(const Pattern& p) : m_pattern(p), m_opState(p.size()) { }
+
+		size_t size() const { return this->m_pattern.size(); }
+
+		// does the k-th instruction of the pattern match this instruction?
+		bool matches(size_t k, const Instruction& instr)
+		{
+			auto& ip = this->m_pattern.instrs[k];
+			if(!ip.anyOp && !this->opMatches(k, instr.op()))
+				return false;
+
+			if(ip.anyOperands)
+				return true;
+
+			if((size_t) instr.operandCount() != ip.operands.size())
+				return false;
+
+			const Operand* operands[] = { &instr.dst(), &instr.src(), &instr.ext(), &instr.op4() };
+			for(size_t i = 0; i < ip.operands.size() && i < 4; i++)
+			{
+				auto want = ip.operands[i].kind;
+				if(want != pattern::Kind::Any && want != pattern::kindOf(*operands[i]))
+					return false;
+			}
+
+			for(size_t i = 0; i < ip.operands.size() && i < 4; i++)
+			{
+				if(!pattern::matchOperand(ip.operands[i], *operands[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+	private:
+		// 0 = not seen yet, 1 = matches, 2 = doesn't.
+		bool opMatches(size_t k, const Op& op)
+		{
+			auto id = op.id();
+			if(id >= 0x10000)
+				return false;
+
+			auto& state = this->m_opState[k];
+			if(state.size() <= id)
+				state.resize(id + 1, 0);
+
+			if(state[id] == 0)
+				state[id] = (this->m_pattern.instrs[k].mnemonic == op.mnemonic()) ? 1 : 2;
+
+			return state[id] == 1;
+		}
+
+		const Pattern& m_pattern;
+		std::vector<std::vector<uint8_t>> m_opState;
+	};
+
+	struct PatternMatch
+	{
+		uint64_t address = 0;   // of the first instruction
+		size_t length = 0;      // in bytes
+	};
+
+	// linear-sweeps the region, and calls fn(match) for every place where the pattern matches. each
+	// instruction is decoded once; the last few are kept in a ring, and a match is checked from the
+	// most recent instruction backwards.
+	template <typename Fn>
+	void searchRegion(const CodeRegion& region, PatternMatcher& matcher, Fn&& fn)
+	{
+		auto k = matcher.size();
+		if(k == 0)
+			return;
+
+		auto ring = std::vector<Instruction>(k, Instruction(ops::INVALID));
+		auto addrs = std::vector<uint64_t>(k);
+		size_t count = 0;
+
+		for(uint64_t ip = region.base(); ip < region.end(); )
+		{
+			auto instr = region.decode(ip);
+			if(instr.op() == ops::INVALID || instr.length() == 0)
+			{
+				// patterns don't match across garbage.
+				count = 0;
+				ip += 1;
+				continue;
+			}
+
+			ring[count % k] = instr;
+			addrs[count % k] = ip;
+			count++;
+
+			ip += instr.length();
+			if(count < k)
+				continue;
+
+			bool ok = true;
+			for(size_t j = 0; j < k && ok; j++)
+				ok = matcher.matches(k - 1 - j, ring[(count - 1 - j) % k]);
+
+			if(ok)
+			{
+				auto first = addrs[(count - k) % k];
+				fn(PatternMatch { first, ip - first });
+			}
+		}
+	}
+}
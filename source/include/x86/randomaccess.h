@@ -0,0 +1,207 @@
+// randomaccess.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	// decodes the instruction at (or just after) any address, without sweeping everything before it first.
+	//
+	// it keeps a sparse set of checkpoints: at most one known instruction boundary per 4k page, which come
+	// from a sweep that was already done, from symbols, or from earlier seeks (a walk from a known boundary
+	// records the first boundary of every page it goes through). a seek walks forward from the nearest
+	// checkpoint in the same or the previous page, so it never decodes more than 8k. the answer is then
+	// right as far as that boundary is: if the checkpoints came from a sweep, it's what the sweep would
+	// have given, but a symbol that points into the middle of something (or at data that decodes) can
+	// put the walk in a different instruction stream from the one the sweep saw.
+	//
+	// if there's no checkpoint that close, it resyncs instead: x86 code tends to fall back into step after a
+	// few instructions no matter where you start decoding it, so walks from a handful of different bytes a
+	// little way back vote on where the instructions around the address start. that's usually right, but
+	// not always, and the result says which of the two it was.
+	struct RandomAccessDecoder
+	{
+		static constexpr size_t CHECKPOINT_INTERVAL = 4096;
+
+		// how far back the resync walks start, and how many of them there are.
+		static constexpr size_t RESYNC_WINDOW = 64;
+		static constexpr size_t RESYNC_WALKS = 8;
+
+		struct Result
+		{
+			uint64_t address = 0;       // where the instruction starts; region.end() if there's none
+			Instruction instr = Instruction(ops::INVALID);
+
+			bool exact = false;         // walked from a known boundary (a checkpoint), and not by resyncing
+			size_t decoded = 0;         // how many instructions it took to get here
+		};
+
+		RandomAccessDecoder() { }
+		RandomAccessDecoder(const CodeRegion& region) : m_region(region),
+			m_pages((region.size() + CHECKPOINT_INTERVAL - 1) / CHECKPOINT_INTERVAL, NONE)
+		{
+			if(region.size() > 0)
+				this->m_pages[0] = 0;
+		}
+
+		// seeds the checkpoints from a sweep: bit N of `starts` is set if an instruction starts at
+		// region.base() + N (as in Disassembly::starts and IncrementalSweep::starts()).
+		RandomAccessDecoder(const CodeRegion& region, const std::vector<uint64_t>& starts) : RandomAccessDecoder(region)
+		{
+			for(size_t p = 0; p < this->m_pages.size(); p++)
+			{
+				auto first = p * CHECKPOINT_INTERVAL / 64;
+				auto last = std::min((p + 1) * CHECKPOINT_INTERVAL / 64, starts.size());
+
+				for(auto w = first; w < last; w++)
+				{
+					if(starts[w] != 0)
+					{
+						this->checkpoint(this->m_region.base() + (w * 64) + __builtin_ctzll(starts[w]));
+						break;
+					}
+				}
+			}
+		}
+
+		const CodeRegion& region() const { return this->m_region; }
+
+		// tells it that an instruction starts at addr (a function symbol, for instance). ignored if the
+		// page already has an earlier one.
+		void checkpoint(uint64_t addr)
+		{
+			if(!this->m_region.contains(addr))
+				return;
+
+			auto ofs = this->m_region.offsetOf(addr);
+			auto& cp = this->m_pages[ofs / CHECKPOINT_INTERVAL];
+
+			cp = std::min(cp, (uint32_t) (ofs % CHECKPOINT_INTERVAL));
+		}
+
+		size_t checkpointCount() const
+		{
+			return std::count_if(this->m_pages.begin(), this->m_pages.end(), [](uint32_t cp) { return cp != NONE; });
+		}
+
+		// the first instruction that starts at or after addr.
+		Result seek(uint64_t addr)
+		{
+			auto& region = this->m_region;
+
+			auto ret = Result();
+			ret.address = region.end();
+
+			if(addr < region.base() || addr >= region.end())
+				return ret;
+
+			auto ofs = region.offsetOf(addr);
+			auto page = ofs / CHECKPOINT_INTERVAL;
+
+			// the checkpoint has to be at or before the address, so if this page's one is after it,
+			// use the one before.
+			uint64_t from = 0;
+			if(this->m_pages[page] != NONE && this->m_pages[page] <= ofs % CHECKPOINT_INTERVAL)
+				from = this->pageStart(page) + this->m_pages[page];
+
+			else if(page > 0 && this->m_pages[page - 1] != NONE)
+				from = this->pageStart(page - 1) + this->m_pages[page - 1];
+
+			else
+				return this->resync(addr);
+
+			auto ip = from;
+			while(ip < addr)
+			{
+				auto next = ip + this->step(ip);
+				ret.decoded++;
+
+				// the first boundary in a page is as good a checkpoint as any.
+				if(next < region.end() && region.offsetOf(next) / CHECKPOINT_INTERVAL != region.offsetOf(ip) / CHECKPOINT_INTERVAL)
+					this->checkpoint(next);
+
+				ip = next;
+			}
+
+			ret.exact = true;
+			ret.address = ip;
+			if(ip < region.end())
+				ret.instr = region.decode(ip);
+
+			return ret;
+		}
+
+	private:
+		static constexpr uint32_t NONE = (uint32_t) -1;
+
+		uint64_t pageStart(size_t page) const { return this->m_region.base() + (page * CHECKPOINT_INTERVAL); }
+
+		size_t step(uint64_t ip) const { return this->m_region.nextBoundary(ip) - ip; }
+
+		Result resync(uint64_t addr)
+		{
+			auto& region = this->m_region;
+
+			struct Vote
+			{
+				uint64_t address;
+				size_t valid;       // walks that didn't run into anything undecodable on the way
+				size_t total;
+			};
+
+			Vote votes[RESYNC_WALKS] = { };
+			size_t numVotes = 0;
+
+			auto ret = Result();
+			auto from = addr - std::min(region.offsetOf(addr), (uint64_t) RESYNC_WINDOW);
+
+			for(size_t k = 0; k < RESYNC_WALKS && from + k <= addr; k++)
+			{
+				bool valid = true;
+				auto ip = from + k;
+				while(ip < addr)
+				{
+					auto instr = region.decode(ip);
+					valid &= (instr.op() != ops::INVALID);
+
+					ip = region.nextBoundary(ip, instr);
+					ret.decoded++;
+				}
+
+				auto it = std::find_if(votes, votes + numVotes, [ip](const Vote& v) { return v.address == ip; });
+				if(it == votes + numVotes)
+				{
+					*it = Vote { ip, 0, 0 };
+					numVotes++;
+				}
+
+				it->valid += valid;
+				it->total += 1;
+			}
+
+			// clean walks count for more than ones that had to skip junk; after that, the earliest wins.
+			auto best = std::min_element(votes, votes + numVotes, [](const Vote& a, const Vote& b) {
+				if(a.valid != b.valid)  return a.valid > b.valid;
+				if(a.total != b.total)  return a.total > b.total;
+				return a.address < b.address;
+			});
+
+			ret.address = best->address;
+			if(ret.address < region.end())
+				ret.instr = region.decode(ret.address);
+
+			return ret;
+		}
+
+		CodeRegion m_region;
+
+		// per page: the offset (into the page) of the first known instruction boundary in it, or NONE.
+		std::vector<uint32_t> m_pages;
+	};
+}
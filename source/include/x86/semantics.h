@@ -0,0 +1,518 @@
+// semantics.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <initializer_list>
+
+#include "decode.h"
+
+namespace instrad::x86
+{
+	// what an instruction does to its operands, the registers it uses without naming them, and the
+	// flags it reads and writes, keyed by op id. this is enough for liveness and dependency analyses
+	// to be table lookups, instead of a switch on the mnemonic in every pass.
+	//
+	// ops not listed in the table get the common two-operand shape: the destination is read and
+	// written, everything else is only read, and no flags are touched. for vex-encoded ops with three
+	// or more operands (the non-destructive forms), the destination is only written.
+	namespace access
+	{
+		constexpr uint8_t NONE          = 0;
+		constexpr uint8_t READ          = 1;
+		constexpr uint8_t WRITE         = 2;
+		constexpr uint8_t READ_WRITE    = 3;
+	}
+
+	namespace rflags
+	{
+		constexpr uint8_t CF    = 0x01;
+		constexpr uint8_t PF    = 0x02;
+		constexpr uint8_t AF    = 0x04;
+		constexpr uint8_t ZF    = 0x08;
+		constexpr uint8_t SF    = 0x10;
+		constexpr uint8_t OF    = 0x20;
+		constexpr uint8_t DF    = 0x40;
+
+		constexpr uint8_t ARITH = CF | PF | AF | ZF | SF | OF;
+		constexpr uint8_t ALL   = ARITH | DF;
+	}
+
+	// registers are tracked as bits in a 64-bit mask: the 16 gprs (any width) come first, then the 16
+	// vector registers (xmm and ymm share a bit). anything else isn't tracked.
+	namespace regmask
+	{
+		constexpr uint64_t RAX = 1 << 0;
+		constexpr uint64_t RCX = 1 << 1;
+		constexpr uint64_t RDX = 1 << 2;
+		constexpr uint64_t RBX = 1 << 3;
+		constexpr uint64_t RSP = 1 << 4;
+		constexpr uint64_t RBP = 1 << 5;
+		constexpr uint64_t RSI = 1 << 6;
+		constexpr uint64_t RDI = 1 << 7;
+		constexpr uint64_t R11 = 1 << 11;
+
+		constexpr uint64_t of(const Register& reg)
+		{
+			if(!reg.present())
+				return 0;
+
+			auto idx = reg.index();
+			if(idx < 16)                                    return (uint64_t) 1 << idx;
+			else if(idx & regs::REG_FLAG_HI_BYTE)           return (uint64_t) 1 << (idx & 0xF);
+			else if(idx & regs::REG_FLAG_SSE)               return (uint64_t) 1 << (16 + (idx & 0xF));
+
+			return 0;
+		}
+	}
+
+	struct OpInfo
+	{
+		static constexpr uint8_t TRAIT_DEFAULT          = 0x01;     // not in the table; see above
+		static constexpr uint8_t TRAIT_ONE_OPERAND      = 0x02;     // implicit registers only in the 1-operand form (imul)
+		static constexpr uint8_t TRAIT_REP              = 0x04;     // uses rcx as a counter with a rep prefix
+		static constexpr uint8_t TRAIT_ZERO_IDIOM       = 0x08;     // `op x, x` doesn't depend on x (xor, sub, pxor, ...)
+
+		uint8_t operands = 0;           // 2 bits of access:: per operand, the first operand in the low bits
+		uint8_t flagsRead = 0;
+		uint8_t flagsWritten = 0;       // including the ones left undefined
+		uint8_t traits = 0;
+
+		uint16_t implicitReads = 0;     // regmask::, gprs only
+		uint16_t implicitWrites = 0;
+
+		constexpr uint8_t access(int i) const { return (this->operands >> (2 * i)) & 0x3; }
+	};
+
+	namespace semantics
+	{
+		constexpr size_t TABLE_SIZE = ops::COUNT;
+
+		constexpr uint8_t shape(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0)
+		{
+			return (uint8_t) (a | (b << 2) | (c << 4) | (d << 6));
+		}
+
+		constexpr uint8_t RW_R  = shape(access::READ_WRITE, access::READ, access::READ, access::READ);
+		constexpr uint8_t W_R   = shape(access::WRITE, access::READ, access::READ, access::READ);
+		constexpr uint8_t R_R   = shape(access::READ, access::READ, access::READ, access::READ);
+		constexpr uint8_t RW_RW = shape(access::READ_WRITE, access::READ_WRITE);
+		constexpr uint8_t W_R_R = shape(access::WRITE, access::READ, access::READ);
+		constexpr uint8_t RW_R_R = shape(access::READ_WRITE, access::READ, access::READ);
+
+		struct Table
+		{
+			OpInfo info[TABLE_SIZE] = { };
+		};
+
+		constexpr Table makeTable()
+		{
+			using namespace rflags;
+			using namespace regmask;
+
+			auto ret = Table();
+			for(auto& i : ret.info)
+				i = OpInfo { RW_R, 0, 0, OpInfo::TRAIT_DEFAULT, 0, 0 };
+
+			auto set = [&ret](const Op& op, uint8_t operands, uint8_t fr = 0, uint8_t fw = 0, uint16_t ir = 0, uint16_t iw = 0,
+				uint8_t traits = 0) {
+				ret.info[op.id()] = OpInfo { operands, fr, fw, traits, ir, iw };
+			};
+
+			// arithmetic and logic
+			for(auto& op : { ops::ADD, ops::OR, ops::AND, ops::NEG, ops::SHLD, ops::SHRD })
+				set(op, RW_R, 0, ARITH);
+
+			for(auto& op : { ops::SUB, ops::XOR })
+				set(op, RW_R, 0, ARITH, 0, 0, OpInfo::TRAIT_ZERO_IDIOM);
+
+			for(auto& op : { ops::ADC, ops::SBB })
+				set(op, RW_R, CF, ARITH);
+
+			for(auto& op : { ops::INC, ops::DEC })
+				set(op, RW_R, 0, ARITH & ~CF);
+
+			for(auto& op : { ops::CMP, ops::TEST })
+				set(op, R_R, 0, ARITH);
+
+			for(auto& op : { ops::SHL, ops::SAL, ops::SHR, ops::SAR })
+				set(op, RW_R, 0, ARITH);
+
+			for(auto& op : { ops::ROL, ops::ROR })
+				set(op, RW_R, 0, CF | OF);
+
+			for(auto& op : { ops::RCL, ops::RCR })
+				set(op, RW_R, CF, CF | OF);
+
+			set(ops::NOT, RW_R);
+			set(ops::BSWAP, RW_R);
+
+			// multiply and divide
+			set(ops::MUL, R_R, 0, ARITH, RAX, RAX | RDX);
+			set(ops::IMUL, RW_R, 0, ARITH, RAX, RAX | RDX, OpInfo::TRAIT_ONE_OPERAND);
+			set(ops::DIV, R_R, 0, ARITH, RAX | RDX, RAX | RDX);
+			set(ops::IDIV, R_R, 0, ARITH, RAX | RDX, RAX | RDX);
+
+			set(ops::CBW, 0, 0, 0, RAX, RAX);
+			set(ops::CWDE, 0, 0, 0, RAX, RAX);
+			set(ops::CDQE, 0, 0, 0, RAX, RAX);
+			set(ops::CWD, 0, 0, 0, RAX, RDX);
+			set(ops::CDQ, 0, 0, 0, RAX, RDX);
+			set(ops::CQO, 0, 0, 0, RAX, RDX);
+
+			// bits
+			set(ops::BT, R_R, 0, ARITH);
+			for(auto& op : { ops::BTS, ops::BTR, ops::BTC })
+				set(op, RW_R, 0, ARITH);
+
+			for(auto& op : { ops::BSF, ops::BSR, ops::POPCNT, ops::LZCNT, ops::TZCNT })
+				set(op, W_R, 0, ARITH);
+
+			// moves
+			for(auto& op : { ops::MOV, ops::MOVZX, ops::MOVSX, ops::MOVSXD, ops::MOVBE, ops::MOVNTI })
+				set(op, W_R);
+
+			set(ops::LEA, shape(access::WRITE, access::NONE));
+			set(ops::XCHG, RW_RW);
+			set(ops::XADD, RW_RW, 0, ARITH);
+			set(ops::CMPXCHG, RW_R, 0, ARITH, RAX, RAX);
+			set(ops::CMPXCHG8B, RW_R, 0, ZF, RAX | RDX | RBX | RCX, RAX | RDX);
+			set(ops::CMPXCHG16B, RW_R, 0, ZF, RAX | RDX | RBX | RCX, RAX | RDX);
+
+			// conditions. setcc writes its operand, cmovcc only writes the destination if the condition holds.
+			struct Cond { Op set; Op cmov; uint8_t flags; };
+			const Cond conds[] = {
+				{ ops::SETO, ops::CMOVO, OF },              { ops::SETNO, ops::CMOVNO, OF },
+				{ ops::SETB, ops::CMOVB, CF },              { ops::SETNB, ops::CMOVNB, CF },
+				{ ops::SETZ, ops::CMOVZ, ZF },              { ops::SETNZ, ops::CMOVNZ, ZF },
+				{ ops::SETBE, ops::CMOVBE, CF | ZF },       { ops::SETNBE, ops::CMOVNBE, CF | ZF },
+				{ ops::SETNA, ops::CMOVNA, CF | ZF },       { ops::SETA, ops::CMOVA, CF | ZF },
+				{ ops::SETS, ops::CMOVS, SF },              { ops::SETNS, ops::CMOVNS, SF },
+				{ ops::SETP, ops::CMOVP, PF },              { ops::SETNP, ops::CMOVNP, PF },
+				{ ops::SETL, ops::CMOVL, SF | OF },         { ops::SETNL, ops::CMOVGE, SF | OF },
+				{ ops::SETGE, ops::CMOVGE, SF | OF },       { ops::SETG, ops::CMOVG, ZF | SF | OF },
+				{ ops::SETLE, ops::CMOVLE, ZF | SF | OF },  { ops::SETNLE, ops::CMOVG, ZF | SF | OF },
+			};
+
+			for(auto& c : conds)
+			{
+				set(c.set, shape(access::WRITE), c.flags);
+				set(c.cmov, RW_R, c.flags);
+			}
+
+			set(ops::JO, R_R, OF);          set(ops::JNO, R_R, OF);
+			set(ops::JB, R_R, CF);          set(ops::JNB, R_R, CF);
+			set(ops::JBO, R_R, CF);
+			set(ops::JZ, R_R, ZF);          set(ops::JNZ, R_R, ZF);
+			set(ops::JA, R_R, CF | ZF);     set(ops::JNA, R_R, CF | ZF);
+			set(ops::JS, R_R, SF);          set(ops::JNS, R_R, SF);
+			set(ops::JP, R_R, PF);          set(ops::JNP, R_R, PF);
+			set(ops::JL, R_R, SF | OF);     set(ops::JGE, R_R, SF | OF);
+			set(ops::JLE, R_R, ZF | SF | OF);
+			set(ops::JG, R_R, ZF | SF | OF);
+			set(ops::JCXZ, R_R, 0, 0, RCX);
+
+			set(ops::LOOP, R_R, 0, 0, RCX, RCX);
+			set(ops::LOOPZ, R_R, ZF, 0, RCX, RCX);
+			set(ops::LOOPNZ, R_R, ZF, 0, RCX, RCX);
+
+			// control flow and the stack
+			set(ops::JMP, R_R);
+			set(ops::CALL, R_R, 0, 0, RSP, RSP);
+			set(ops::RET, R_R, 0, 0, RSP, RSP);
+			set(ops::RETF, R_R, 0, 0, RSP, RSP);
+			set(ops::IRET, R_R, 0, ALL, RSP, RSP);
+			set(ops::PUSH, R_R, 0, 0, RSP, RSP);
+			set(ops::POP, shape(access::WRITE), 0, 0, RSP, RSP);
+			set(ops::PUSHF, 0, ALL, 0, RSP, RSP);
+			set(ops::POPF, 0, 0, ALL, RSP, RSP);
+			set(ops::PUSHA, 0, 0, 0, 0xFF, RSP);
+			set(ops::PUSHAD, 0, 0, 0, 0xFF, RSP);
+			set(ops::POPA, 0, 0, 0, RSP, 0xFF & ~RSP);
+			set(ops::POPAD, 0, 0, 0, RSP, 0xFF & ~RSP);
+			set(ops::ENTER, R_R, 0, 0, RSP | RBP, RSP | RBP);
+			set(ops::LEAVE, 0, 0, 0, RBP, RSP | RBP);
+			set(ops::INT, R_R);
+			set(ops::INT3, 0);
+			set(ops::SYSCALL, 0, 0, ALL, 0, RCX | R11);
+			set(ops::NOP, 0);
+			set(ops::PAUSE, 0);
+			set(ops::HLT, 0);
+			set(ops::UD2, 0);
+
+			// flags
+			set(ops::CLC, 0, 0, CF);
+			set(ops::STC, 0, 0, CF);
+			set(ops::CMC, 0, CF, CF);
+			set(ops::CLD, 0, 0, DF);
+			set(ops::STD, 0, 0, DF);
+			set(ops::SAHF, 0, 0, CF | PF | AF | ZF | SF, RAX);
+			set(ops::LAHF, 0, CF | PF | AF | ZF | SF, 0, 0, RAX);
+
+			// strings. the memory operands are explicit, but the pointers also get bumped.
+			for(auto& op : { ops::MOVS, ops::MOVSB, ops::MOVSW, ops::MOVSQ })
+				set(op, W_R, DF, 0, 0, RSI | RDI, OpInfo::TRAIT_REP);
+
+			for(auto& op : { ops::STOS, ops::STOSB, ops::STOSW, ops::STOSD, ops::STOSQ })
+				set(op, W_R, DF, 0, 0, RDI, OpInfo::TRAIT_REP);
+
+			for(auto& op : { ops::LODS, ops::LODSB, ops::LODSW, ops::LODSD, ops::LODSQ })
+				set(op, W_R, DF, 0, 0, RSI, OpInfo::TRAIT_REP);
+
+			for(auto& op : { ops::SCAS, ops::SCASB, ops::SCASW, ops::SCASD, ops::SCASQ })
+				set(op, R_R, DF, ARITH, 0, RDI, OpInfo::TRAIT_REP);
+
+			for(auto& op : { ops::CMPS, ops::CMPSB, ops::CMPSW, ops::CMPSQ })
+				set(op, R_R, DF, ARITH, 0, RSI | RDI, OpInfo::TRAIT_REP);
+
+			// misc system stuff
+			set(ops::CPUID, 0, 0, 0, RAX | RCX, RAX | RBX | RCX | RDX);
+			set(ops::RDTSC, 0, 0, 0, 0, RAX | RDX);
+			set(ops::RDTSCP, 0, 0, 0, 0, RAX | RCX | RDX);
+			set(ops::RDPMC, 0, 0, 0, RCX, RAX | RDX);
+			set(ops::RDMSR, 0, 0, 0, RCX, RAX | RDX);
+			set(ops::WRMSR, 0, 0, 0, RAX | RCX | RDX, 0);
+			set(ops::XGETBV, 0, 0, 0, RCX, RAX | RDX);
+			set(ops::RDRAND, shape(access::WRITE), 0, ARITH);
+			set(ops::RDSEED, shape(access::WRITE), 0, ARITH);
+			set(ops::LDMXCSR, R_R);
+			set(ops::STMXCSR, shape(access::WRITE));
+			set(ops::PREFETCH, 0);
+			set(ops::CLFLUSH, 0);
+			for(auto& op : { ops::LFENCE, ops::SFENCE, ops::MFENCE, ops::EMMS, ops::FEMMS })
+				set(op, 0);
+
+			// sse: moves, conversions and other things that don't merge into the destination.
+			for(auto& op : { ops::MOVUPS, ops::MOVUPD, ops::MOVAPS, ops::MOVAPD, ops::MOVDQA, ops::MOVDQU, ops::LDDQU, ops::MOVD,
+				ops::MOVQ, ops::MOVNTPS, ops::MOVNTPD, ops::MOVNTDQ, ops::MOVNTDQA, ops::MOVNTQ, ops::MOVDDUP, ops::MOVSLDUP,
+				ops::MOVSHDUP, ops::MOVMSKPS, ops::MOVMSKPD, ops::PMOVMSKB, ops::PSHUFD, ops::PSHUFHW, ops::PSHUFLW, ops::PSHUFW,
+				ops::SQRTPS, ops::SQRTPD, ops::RSQRTPS, ops::RCPPS, ops::CVTDQ2PS, ops::CVTDQ2PD, ops::CVTTPD2DQ, ops::CVTPD2DQ,
+				ops::CVTPS2PD, ops::CVTPD2PS, ops::CVTPS2DQ, ops::CVTTPS2DQ, ops::CVTTSS2SI, ops::CVTSS2SI, ops::CVTTSD2SI,
+				ops::CVTSD2SI, ops::PEXTRB, ops::PEXTRW, ops::PEXTRD, ops::EXTRACTPS, ops::PMOVSXBW, ops::PMOVSXBD, ops::PMOVSXBQ,
+				ops::PMOVSXWD, ops::PMOVSXWQ, ops::PMOVSXDQ, ops::PMOVZXBW, ops::PMOVZXBD, ops::PMOVZXBQ, ops::PMOVZXWD,
+				ops::PMOVZXWQ, ops::PMOVZXDQ, ops::PABSB, ops::PABSW, ops::PABSD, ops::PHMINPOSUW, ops::ROUNDPS, ops::ROUNDPD,
+				ops::AESIMC, ops::AESKEYGENASSIST })
+			{
+				set(op, W_R);
+			}
+
+			for(auto& op : { ops::XORPS, ops::XORPD, ops::PXOR, ops::PSUBB, ops::PSUBW, ops::PSUBD, ops::PSUBQ, ops::PCMPEQB,
+				ops::PCMPEQW, ops::PCMPEQD, ops::PCMPEQQ, ops::ANDNPS, ops::ANDNPD, ops::PANDN })
+			{
+				set(op, RW_R, 0, 0, 0, 0, OpInfo::TRAIT_ZERO_IDIOM);
+			}
+
+			for(auto& op : { ops::UCOMISS, ops::COMISS, ops::UCOMISD, ops::COMISD, ops::PTEST })
+				set(op, R_R, 0, ARITH);
+
+			for(auto& op : { ops::PCMPESTRI, ops::PCMPISTRI })
+				set(op, R_R, 0, ARITH, 0, RCX);
+
+			for(auto& op : { ops::PCMPESTRM, ops::PCMPISTRM })
+				set(op, R_R, 0, ARITH);
+
+			// avx: the same moves and conversions, plus broadcasts and lane inserts/extracts. the scalar forms
+			// that merge with a second source (vmovss, vsqrtss, vcvtsi2ss, ...) read it like any other source.
+			for(auto& op : { ops::VMOVUPS, ops::VMOVUPD, ops::VMOVAPS, ops::VMOVAPD, ops::VMOVDQA, ops::VMOVDQU, ops::VLDDQU,
+				ops::VMOVD, ops::VMOVQ, ops::VMOVSS, ops::VMOVSD, ops::VMOVLPS, ops::VMOVHPS, ops::VMOVLPD, ops::VMOVHPD,
+				ops::VMOVHLPS, ops::VMOVLHPS, ops::VMOVNTPS, ops::VMOVNTPD, ops::VMOVNTDQ, ops::VMOVNTDQA, ops::VMOVDDUP,
+				ops::VMOVSLDUP, ops::VMOVSHDUP, ops::VMOVMSKPS, ops::VMOVMSKPD, ops::VPMOVMSKB, ops::VMASKMOVPS,
+				ops::VMASKMOVPD, ops::VPMASKMOVD, ops::VPMASKMOVQ, ops::VPSHUFD, ops::VPSHUFHW, ops::VPSHUFLW, ops::VSQRTPS,
+				ops::VSQRTPD, ops::VRSQRTPS, ops::VRCPPS, ops::VSQRTSS, ops::VSQRTSD, ops::VRSQRTSS, ops::VRCPSS,
+				ops::VCVTDQ2PS, ops::VCVTDQ2PD, ops::VCVTTPD2DQ, ops::VCVTPD2DQ, ops::VCVTPS2PD, ops::VCVTPD2PS,
+				ops::VCVTPS2DQ, ops::VCVTTPS2DQ, ops::VCVTTSS2SI, ops::VCVTSS2SI, ops::VCVTTSD2SI, ops::VCVTSD2SI,
+				ops::VCVTSI2SS, ops::VCVTSI2SD, ops::VCVTSS2SD, ops::VCVTSD2SS, ops::VCVTPH2PS, ops::VCVTPS2PH,
+				ops::VPEXTRB, ops::VPEXTRW, ops::VPEXTRD, ops::VPEXTRQ, ops::VEXTRACTPS, ops::VEXTRACTF128, ops::VEXTRACTI128,
+				ops::VPMOVSXBW, ops::VPMOVSXBD, ops::VPMOVSXBQ, ops::VPMOVSXWD, ops::VPMOVSXWQ, ops::VPMOVSXDQ,
+				ops::VPMOVZXBW, ops::VPMOVZXBD, ops::VPMOVZXBQ, ops::VPMOVZXWD, ops::VPMOVZXWQ, ops::VPMOVZXDQ, ops::VPABSB,
+				ops::VPABSW, ops::VPABSD, ops::VPHMINPOSUW, ops::VROUNDPS, ops::VROUNDPD, ops::VAESIMC, ops::VPERMILPS,
+				ops::VPERMILPD, ops::VPERMQ, ops::VPERMPD, ops::VBROADCASTSS, ops::VBROADCASTSD, ops::VBROADCASTF128,
+				ops::VPBROADCASTB, ops::VPBROADCASTW, ops::VPBROADCASTD, ops::VPBROADCASTI128, ops::VBLENDVPS,
+				ops::VBLENDVPD, ops::VPBLENDVB })
+			{
+				set(op, W_R);
+			}
+
+			// the non-destructive three-operand arithmetic: dst = src1 op src2.
+			for(auto& op : { ops::VADDPS, ops::VADDPD, ops::VADDSS, ops::VADDSD, ops::VSUBPS, ops::VSUBPD, ops::VSUBSS,
+				ops::VSUBSD, ops::VMULPS, ops::VMULPD, ops::VMULSS, ops::VMULSD, ops::VDIVPS, ops::VDIVPD, ops::VDIVSS,
+				ops::VDIVSD, ops::VMINPS, ops::VMINPD, ops::VMINSS, ops::VMINSD, ops::VMAXPS, ops::VMAXPD, ops::VMAXSS,
+				ops::VMAXSD, ops::VADDSUBPS, ops::VADDSUBPD, ops::VHADDPS, ops::VHADDPD, ops::VHSUBPS, ops::VHSUBPD,
+				ops::VANDPS, ops::VANDPD, ops::VORPS, ops::VORPD, ops::VPAND, ops::VPOR, ops::VCMPPS, ops::VCMPPD, ops::VCMPSS,
+				ops::VUNPCKLPS, ops::VUNPCKHPS, ops::VUNPCKLPD, ops::VUNPCKHPD, ops::VPUNPCKLBW, ops::VPUNPCKLWD,
+				ops::VPUNPCKLDQ, ops::VPUNPCKLQDQ, ops::VPUNPCKHBW, ops::VPUNPCKHWD, ops::VPUNPCKHDQ, ops::VPUNPCKHQDQ,
+				ops::VPACKSSWB, ops::VPACKSSDW, ops::VPACKUSWB, ops::VPACKUSDW, ops::VPCMPGTB, ops::VPCMPGTW, ops::VPCMPGTD,
+				ops::VPCMPGTQ, ops::VSHUFPS, ops::VSHUFPD, ops::VPSHUFB, ops::VPALIGNR, ops::VPSRLW, ops::VPSRLD, ops::VPSRLQ,
+				ops::VPSRLDQ, ops::VPSRAW, ops::VPSRAD, ops::VPSLLW, ops::VPSLLD, ops::VPSLLQ, ops::VPSLLDQ, ops::VPSRLVD,
+				ops::VPSRLVQ, ops::VPRAVD, ops::VPSLLVD, ops::VPSLLVQ, ops::VPADDB, ops::VPADDW, ops::VPADDD, ops::VPADDQ,
+				ops::VPADDSB, ops::VPADDSW, ops::VPADDUSB, ops::VPADDUSW, ops::VPSUBSB, ops::VPSUBSW, ops::VPSUBUSB,
+				ops::VPSUBUSW, ops::VPMULLW, ops::VPMULLD, ops::VPMULHW, ops::VPMULHUW, ops::VPMULUDQ, ops::VPMULDQ,
+				ops::VPMULHRSW, ops::VPMADDWD, ops::VPMADDUBSW, ops::VPSADBW, ops::VMPSADBW, ops::VPAVGB, ops::VPAVGW,
+				ops::VPMINUB, ops::VPMINUW, ops::VPMINUD, ops::VPMINSB, ops::VPMINSW, ops::VPMINSD, ops::VPMAXUB,
+				ops::VPMAXUW, ops::VPMAXUD, ops::VPMAXSB, ops::VPMAXSW, ops::VPMAXSD, ops::VPHADDW, ops::VPHADDD,
+				ops::VPHADDSW, ops::VPHSUBW, ops::VPHSUBD, ops::VPHSUBSW, ops::VPSIGNB, ops::VPSIGNW, ops::VPSIGND,
+				ops::VDPPS, ops::VDPPD, ops::VROUNDSS, ops::VROUNDSD, ops::VBLENDPS, ops::VBLENDPD, ops::VPBLENDW,
+				ops::VPBLENDD, ops::VINSERTPS, ops::VPINSRB, ops::VPINSRW, ops::VPINSRD, ops::VPINSRQ, ops::VINSERTF128,
+				ops::VINSERTI128, ops::VPERM2F128, ops::VPERM2I128, ops::VPERMD, ops::VPERMPS, ops::VPCLMULQDQ,
+				ops::VAESENC, ops::VAESENCLAST, ops::VAESDEC, ops::VAESDECLAST })
+			{
+				set(op, W_R_R);
+			}
+
+			// `vpxor x, y, y` and friends.
+			for(auto& op : { ops::VXORPS, ops::VXORPD, ops::VPXOR, ops::VPSUBB, ops::VPSUBW, ops::VPSUBD, ops::VPSUBQ,
+				ops::VPCMPEQB, ops::VPCMPEQW, ops::VPCMPEQD, ops::VPCMPEQQ, ops::VANDNPS, ops::VANDNPD, ops::VPANDN })
+			{
+				set(op, W_R_R, 0, 0, 0, 0, OpInfo::TRAIT_ZERO_IDIOM);
+			}
+
+			// fma3 accumulates into the destination, whichever of the three forms it is.
+			for(auto& op : { ops::VFMADD132PS, ops::VFMADD132PD, ops::VFMADD132SS, ops::VFMADD132SD, ops::VFMADD213PS,
+				ops::VFMADD213PD, ops::VFMADD213SS, ops::VFMADD213SD, ops::VFMADD231PS, ops::VFMADD231PD, ops::VFMADD231SS,
+				ops::VFMADD231SD, ops::VFMSUB132PS, ops::VFMSUB132PD, ops::VFMSUB132SS, ops::VFMSUB132SD, ops::VFMSUB213PS,
+				ops::VFMSUB213PD, ops::VFMSUB213SS, ops::VFMSUB213SD, ops::VFMSUB231PS, ops::VFMSUB231PD, ops::VFMSUB231SS,
+				ops::VFMSUB231SD, ops::VFNMADD132PS, ops::VFNMADD132PD, ops::VFNMADD132SS, ops::VFNMADD132SD,
+				ops::VFNMADD213PS, ops::VFNMADD213PD, ops::VFNMADD213SS, ops::VFNMADD213SD, ops::VFNMADD231PS,
+				ops::VFNMADD231PD, ops::VFNMADD231SS, ops::VFNMADD231SD, ops::VFNMSUB132PS, ops::VFNMSUB132PD,
+				ops::VFNMSUB132SS, ops::VFNMSUB132SD, ops::VFNMSUB213PS, ops::VFNMSUB213PD, ops::VFNMSUB213SS,
+				ops::VFNMSUB213SD, ops::VFNMSUB231PS, ops::VFNMSUB231PD, ops::VFNMSUB231SS, ops::VFNMSUB231SD,
+				ops::VFMADDSUB132PS, ops::VFMADDSUB132PD, ops::VFMADDSUB213PS, ops::VFMADDSUB213PD, ops::VFMADDSUB231PS,
+				ops::VFMADDSUB231PD, ops::VFMSUBADD132PS, ops::VFMSUBADD132PD, ops::VFMSUBADD213PS, ops::VFMSUBADD213PD,
+				ops::VFMSUBADD231PS, ops::VFMSUBADD231PD })
+			{
+				set(op, RW_R_R);
+			}
+
+			// gathers merge into the destination, and clear the mask as they go.
+			for(auto& op : { ops::VPGATHERDD, ops::VPGATHERQD, ops::VGATHERDPS, ops::VGATHERQPS })
+				set(op, shape(access::READ_WRITE, access::READ, access::READ_WRITE));
+
+			for(auto& op : { ops::VUCOMISS, ops::VCOMISS, ops::VUCOMISD, ops::VCOMISD, ops::VPTEST, ops::VTESTPS, ops::VTESTPD })
+				set(op, R_R, 0, ARITH);
+
+			for(auto& op : { ops::VPCMPESTRI, ops::VPCMPISTRI })
+				set(op, R_R, 0, ARITH, 0, RCX);
+
+			for(auto& op : { ops::VPCMPESTRM, ops::VPCMPISTRM })
+				set(op, R_R, 0, ARITH);
+
+			// x87. the stack registers aren't tracked, so all that's left is which way the explicit operand goes;
+			// the stores also list st0 as their source.
+			for(auto& op : { ops::FLD, ops::FILD, ops::FBLD })
+				set(op, shape(access::READ));
+
+			for(auto& op : { ops::FST, ops::FSTP, ops::FIST, ops::FISTP, ops::FISTTP, ops::FBSTP })
+				set(op, W_R);
+
+			return ret;
+		}
+
+		constexpr auto OpTable = makeTable();
+		constexpr auto UnknownOp = OpInfo { 0, 0, 0, OpInfo::TRAIT_DEFAULT, 0, 0 };
+	}
+
+	constexpr const OpInfo& opInfo(const Op& op)
+	{
+		if(op.id() >= semantics::TABLE_SIZE)
+			return semantics::UnknownOp;
+
+		return semantics::OpTable.info[op.id()];
+	}
+
+	constexpr const Operand& operandAt(const Instruction& instr, int i)
+	{
+		return i == 0 ? instr.dst() : i == 1 ? instr.src() : i == 2 ? instr.ext() : instr.op4();
+	}
+
+	// how the i-th operand (0 = destination) is accessed, taking the encoding into account.
+	constexpr uint8_t operandAccess(const Instruction& instr, int i)
+	{
+		if(i < 0 || i >= instr.operandCount())
+			return access::NONE;
+
+		auto& info = opInfo(instr.op());
+		auto ret = info.access(i);
+
+		// vex forms don't destroy their first source, and neither does the three-operand imul.
+		if(i == 0 && instr.operandCount() >= 3 && ((info.traits & OpInfo::TRAIT_DEFAULT && instr.mods().vex.present())
+			|| instr.op() == ops::IMUL))
+		{
+			ret = access::WRITE;
+		}
+
+		// the one-operand mul/imul/div forms read their operand, and implicitly use rax/rdx.
+		if(i == 0 && instr.operandCount() == 1 && (info.traits & OpInfo::TRAIT_ONE_OPERAND))
+			ret = access::READ;
+
+		return ret;
+	}
+
+	// all the registers (as regmask:: bits) that an instruction reads and writes, and its flags.
+	struct RegisterUse
+	{
+		uint64_t reads = 0;
+		uint64_t writes = 0;
+		uint8_t flagsRead = 0;
+		uint8_t flagsWritten = 0;
+	};
+
+	constexpr RegisterUse registerUse(const Instruction& instr)
+	{
+		auto& info = opInfo(instr.op());
+		auto ret = RegisterUse();
+
+		ret.flagsRead = info.flagsRead;
+		ret.flagsWritten = info.flagsWritten;
+
+		if(!(info.traits & OpInfo::TRAIT_ONE_OPERAND) || instr.operandCount() == 1)
+		{
+			ret.reads |= info.implicitReads;
+			ret.writes |= info.implicitWrites;
+		}
+
+		if((info.traits & OpInfo::TRAIT_REP) && (instr.repPrefix() || instr.repnzPrefix()))
+		{
+			ret.reads |= regmask::RCX;
+			ret.writes |= regmask::RCX;
+		}
+
+		// `xor eax, eax` and friends: the result doesn't depend on the old value.
+		// the vex forms are `vpxor x, y, y`, where it's the two sources that have to match.
+		bool zeroIdiom = false;
+		if((info.traits & OpInfo::TRAIT_ZERO_IDIOM) && instr.operandCount() == 2)
+			zeroIdiom = instr.dst().isRegister() && instr.src().isRegister() && instr.dst().reg() == instr.src().reg();
+
+		else if((info.traits & OpInfo::TRAIT_ZERO_IDIOM) && instr.operandCount() == 3)
+			zeroIdiom = instr.src().isRegister() && instr.ext().isRegister() && instr.src().reg() == instr.ext().reg();
+
+		for(int i = 0; i < instr.operandCount() && i < 4; i++)
+		{
+			auto& op = operandAt(instr, i);
+			auto acc = operandAccess(instr, i);
+
+			if(op.isRegister())
+			{
+				auto bit = regmask::of(op.reg());
+				if((acc & access::READ) && !zeroIdiom)
+					ret.reads |= bit;
+
+				if(acc & access::WRITE)
+				{
+					ret.writes |= bit;
+
+					// writing an 8 or 16-bit register merges with whatever was there.
+					if(op.reg().width() < 32 && op.reg().index() < 16)
+						ret.reads |= bit;
+				}
+			}
+			else if(op.isMemory())
+			{
+				// the address is always computed, even if the memory isn't touched (lea).
+				ret.reads |= regmask::of(op.mem().base()) | regmask::of(op.mem().index());
+			}
+		}
+
+		return ret;
+	}
+}
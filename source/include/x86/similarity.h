@@ -0,0 +1,272 @@
+// similarity.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	namespace minhash
+	{
+		// the signature length, and how it's cut up into bands for the lsh. 16 bands of 4 rows make
+		// anything above ~0.7 similar almost certain to land in a bucket with its twin, and anything
+		// under ~0.3 unlikely to.
+		constexpr size_t SIZE = 64;
+		constexpr size_t BANDS = 16;
+		constexpr size_t ROWS = SIZE / BANDS;
+
+		static_assert(BANDS * ROWS == SIZE);
+
+		constexpr uint64_t mix(uint64_t x)
+		{
+			x ^= x >> 30;
+			x *= 0xBF58476D1CE4E5B9;
+			x ^= x >> 27;
+			x *= 0x94D049BB133111EB;
+			x ^= x >> 31;
+			return x;
+		}
+
+		constexpr uint64_t combine(uint64_t h, uint64_t x) { return mix(h ^ (x + 0x9E3779B97F4A7C15 + (h << 6))); }
+
+		// the registers that mean the same thing in every function, and so don't get renamed.
+		constexpr bool isFixedRegister(const Register& reg)
+		{
+			return (reg.index() & regs::REG_FLAG_IP) || (reg.index() & regs::REG_FLAG_SEGMENT) || reg.index() == regs::RSP.index();
+		}
+
+		// renames registers in the order they're first seen, so that two copies of a function that only
+		// differ in register allocation come out the same.
+		struct RegisterRenamer
+		{
+			uint64_t map(const Register& reg)
+			{
+				if(!reg.present())
+					return 0;
+
+				// al and ah (and so on) are the same register; the width is kept separately.
+				auto key = (uint16_t) (reg.index() & ~regs::REG_FLAG_HI_BYTE);
+				if(!this->enabled || isFixedRegister(reg))
+					return combine(key, reg.width());
+
+				for(size_t i = 0; i < this->count; i++)
+				{
+					if(this->seen[i] == key)
+						return combine(0x1000 + i, reg.width());
+				}
+
+				if(this->count < MAX)
+					this->seen[this->count++] = key;
+
+				return combine(0x1000 + this->count - 1, reg.width());
+			}
+
+			bool enabled = false;
+
+		private:
+			static constexpr size_t MAX = 64;
+
+			uint16_t seen[MAX] = { };
+			size_t count = 0;
+		};
+
+		// one 64-bit token per instruction: the op, the prefixes that change what it does, and the shape of
+		// each operand. displacements, immediates, branch targets and absolute addresses are left out, since
+		// they're what changes when the same code gets linked somewhere else.
+		inline uint64_t token(const Instruction& instr, RegisterRenamer& regs)
+		{
+			auto h = combine(instr.op().id(), instr.operandCount());
+			h = combine(h, (instr.lockPrefix() ? 1 : 0) | (instr.repPrefix() ? 2 : 0) | (instr.repnzPrefix() ? 4 : 0));
+
+			const Operand* operands[] = { &instr.dst(), &instr.src(), &instr.ext(), &instr.op4() };
+			for(int i = 0; i < instr.operandCount() && i < 4; i++)
+			{
+				auto& o = *operands[i];
+				if(o.isRegister())
+				{
+					h = combine(h, 1);
+					h = combine(h, regs.map(o.reg()));
+				}
+				else if(o.isImmediate())
+				{
+					h = combine(h, 2);
+					h = combine(h, o.immediateSize());
+				}
+				else if(o.isMemory())
+				{
+					auto& mem = o.mem();
+					h = combine(h, 3);
+					h = combine(h, mem.bits());
+					h = combine(h, regs.map(mem.base()));
+					h = combine(h, regs.map(mem.index()));
+					h = combine(h, mem.index().present() ? mem.scale() : 0);
+					h = combine(h, mem.segment().present() ? mem.segment().index() : 0);
+				}
+				else if(o.isRelativeOffset())
+				{
+					h = combine(h, 4);
+				}
+				else
+				{
+					h = combine(h, 5);
+				}
+			}
+
+			return h;
+		}
+	}
+
+	struct FingerprintOptions
+	{
+		bool renameRegisters = true;
+
+		size_t shingle = 4;             // instructions per shingle
+		size_t minInstructions = 16;    // anything shorter isn't worth comparing (or distinctive enough to)
+	};
+
+	struct FunctionFingerprint
+	{
+		uint64_t address = 0;
+		uint64_t size = 0;
+		size_t instructions = 0;
+
+		uint64_t signature[minhash::SIZE] = { };
+	};
+
+	// the fraction of signature slots that two fingerprints agree on, which estimates the jaccard
+	// similarity of their sets of shingles.
+	inline double similarity(const FunctionFingerprint& a, const FunctionFingerprint& b)
+	{
+		size_t same = 0;
+		for(size_t i = 0; i < minhash::SIZE; i++)
+			same += (a.signature[i] == b.signature[i]);
+
+		return (double) same / minhash::SIZE;
+	}
+
+	// decodes [lo, hi) linearly, turns every `opts.shingle` consecutive instructions into a shingle, and
+	// makes a minhash signature out of the set of those. returns false if the function is too small
+	// (counting only the instructions that decoded).
+	inline bool fingerprintFunction(const CodeRegion& region, uint64_t lo, uint64_t hi, const FingerprintOptions& opts,
+		FunctionFingerprint& out)
+	{
+		lo = std::max(lo, region.base());
+		hi = std::min(hi, region.end());
+
+		auto regs = minhash::RegisterRenamer();
+		regs.enabled = opts.renameRegisters;
+
+		auto tokens = std::vector<uint64_t>();
+		for(auto ip = lo; ip < hi; )
+		{
+			auto instr = region.decode(ip);
+			if(instr.op() != ops::INVALID)
+				tokens.push_back(minhash::token(instr, regs));
+
+			ip = region.nextBoundary(ip, instr);
+		}
+
+		if(tokens.size() < std::max(opts.minInstructions, (size_t) 1))
+			return false;
+
+		out.address = lo;
+		out.size = hi - lo;
+		out.instructions = tokens.size();
+		std::fill(std::begin(out.signature), std::end(out.signature), ~(uint64_t) 0);
+
+		auto k = std::max((size_t) 1, std::min(opts.shingle, tokens.size()));
+		for(size_t i = 0; i + k <= tokens.size(); i++)
+		{
+			uint64_t sh = 0;
+			for(size_t j = 0; j < k; j++)
+				sh = minhash::combine(sh, tokens[i + j]);
+
+			// one hash function per slot, all derived from the same shingle hash.
+			for(size_t s = 0; s < minhash::SIZE; s++)
+				out.signature[s] = std::min(out.signature[s], minhash::mix(sh ^ (0x9E3779B97F4A7C15 * (s + 1))));
+		}
+
+		return true;
+	}
+
+	// groups the fingerprints into clusters of functions that are at least `threshold` similar (and
+	// transitively so). returns the clusters with more than one member, biggest first, as indices into
+	// `fps`; the members are in the order they were in `fps`.
+	//
+	// the lsh part: every signature is cut into bands, and fingerprints whose band is identical land in
+	// the same bucket (found by sorting, not hashing, so the result doesn't depend on the order of the
+	// buckets). only the fingerprints that share a bucket are ever compared, and even then only against
+	// the first one in the bucket, so a bucket of a thousand identical thunks costs a thousand
+	// comparisons, not half a million.
+	inline std::vector<std::vector<size_t>> clusterFunctions(const std::vector<FunctionFingerprint>& fps, double threshold)
+	{
+		auto parent = std::vector<size_t>(fps.size());
+		std::iota(parent.begin(), parent.end(), 0);
+
+		auto find = [&parent](size_t x) -> size_t {
+			while(parent[x] != x)
+			{
+				parent[x] = parent[parent[x]];
+				x = parent[x];
+			}
+			return x;
+		};
+
+		struct Entry
+		{
+			uint64_t key;
+			size_t fp;
+
+			bool operator < (const Entry& other) const { return this->key != other.key ? this->key < other.key : this->fp < other.fp; }
+		};
+
+		auto entries = std::vector<Entry>(fps.size());
+		for(size_t b = 0; b < minhash::BANDS; b++)
+		{
+			for(size_t i = 0; i < fps.size(); i++)
+			{
+				uint64_t key = b;
+				for(size_t r = 0; r < minhash::ROWS; r++)
+					key = minhash::combine(key, fps[i].signature[(b * minhash::ROWS) + r]);
+
+				entries[i] = Entry { key, i };
+			}
+
+			std::sort(entries.begin(), entries.end());
+			for(size_t i = 0; i < entries.size(); )
+			{
+				auto j = i + 1;
+				for(; j < entries.size() && entries[j].key == entries[i].key; j++)
+				{
+					auto a = entries[i].fp;
+					auto c = entries[j].fp;
+
+					if(find(a) != find(c) && similarity(fps[a], fps[c]) >= threshold)
+						parent[find(c)] = find(a);
+				}
+
+				i = j;
+			}
+		}
+
+		auto groups = std::vector<std::vector<size_t>>(fps.size());
+		for(size_t i = 0; i < fps.size(); i++)
+			groups[find(i)].push_back(i);
+
+		auto ret = std::vector<std::vector<size_t>>();
+		for(auto& g : groups)
+		{
+			if(g.size() > 1)
+				ret.push_back(std::move(g));
+		}
+
+		std::stable_sort(ret.begin(), ret.end(), [](auto& a, auto& b) { return a.size() > b.size(); });
+		return ret;
+	}
+}
@@ -0,0 +1,358 @@
+// stack.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "cfg.h"
+#include "semantics.h"
+
+namespace instrad::x86
+{
+	// the value of rsp relative to what it was on entry to the function: 0 at the first instruction,
+	// -8 right after a push (in 64-bit code), and so on. the return address isn't counted; it was pushed
+	// before the function started.
+	constexpr int32_t UNKNOWN_DELTA = INT32_MIN;
+
+	enum class StackIssue : uint8_t
+	{
+		Lost,           // the delta became unknown at this instruction (it can come back, from the frame pointer)
+		Conflict,       // two paths into this block disagree on the delta; the first one wins
+		Unbalanced,     // a ret, or a jump out of the function, with a delta other than 0
+		Unreached,      // only reachable by a back edge, so the single pass never had a delta for it
+	};
+
+	struct StackNote
+	{
+		uint64_t address;
+		StackIssue issue;
+		int32_t delta;          // at that point; for a conflict, the one that lost
+	};
+
+	struct StackDeltas
+	{
+		// per block, in the graph's order: where its instructions are in the arrays below (they're in
+		// the order the blocks were visited, not by address), and the rsp and rbp deltas on entry.
+		std::vector<uint32_t> blockFirst;
+		std::vector<uint32_t> blockCount;
+		std::vector<int32_t> blockEntry;
+		std::vector<int32_t> blockEntryFrame;
+
+		// one per instruction: its address, and the delta right before it executes.
+		std::vector<uint64_t> addresses;
+		std::vector<int32_t> deltas;
+
+		std::vector<StackNote> notes;
+
+		// the delta before the instruction at `addr`, or UNKNOWN_DELTA (also if it isn't an instruction).
+		int32_t deltaAt(const ControlFlowGraph& g, uint64_t addr) const
+		{
+			auto b = g.blockContaining(addr);
+			if(b < 0)
+				return UNKNOWN_DELTA;
+
+			auto first = this->addresses.begin() + this->blockFirst[b];
+			auto last = first + this->blockCount[b];
+			auto it = std::lower_bound(first, last, addr);
+			if(it == last || *it != addr)
+				return UNKNOWN_DELTA;
+
+			return this->deltas[it - this->addresses.begin()];
+		}
+
+		// calls fn(addr, delta) for every instruction, in address order.
+		template <typename Fn>
+		void forEach(Fn&& fn) const
+		{
+			for(size_t b = 0; b < this->blockFirst.size(); b++)
+			{
+				for(auto i = this->blockFirst[b]; i < this->blockFirst[b] + this->blockCount[b]; i++)
+					fn(this->addresses[i], this->deltas[i]);
+			}
+		}
+	};
+
+	namespace stack
+	{
+		// rsp and rbp, relative to rsp on entry. rbp is only known once it's been set from rsp.
+		struct State
+		{
+			int32_t sp = 0;
+			int32_t fp = UNKNOWN_DELTA;
+		};
+
+		constexpr int64_t signExtend(uint64_t value, int bits)
+		{
+			if(bits >= 64)
+				return (int64_t) value;
+
+			auto shift = 64 - bits;
+			return ((int64_t) (value << shift)) >> shift;
+		}
+
+		// the decoder keeps displacements zero-extended without their size, so for the one place where
+		// the sign matters (lea rsp, [rsp - x]), read the mod bits out of the modrm byte.
+		constexpr int64_t leaDisplacement(const Instruction& instr, const uint8_t* bytes)
+		{
+			size_t i = 0;
+			while(i < instr.length() && bytes[i] != 0x8D)
+				i++;
+
+			if(i + 1 >= instr.length())
+				return 0;
+
+			auto mod = bytes[i + 1] >> 6;
+			auto disp = instr.src().mem().displacement();
+			return mod == 1 ? signExtend(disp, 8) : signExtend(disp, 32);
+		}
+
+		constexpr bool isSP(const Operand& op) { return op.isRegister() && op.reg().index() == 4; }
+		constexpr bool isFP(const Operand& op) { return op.isRegister() && op.reg().index() == 5; }
+
+		constexpr int32_t add(int32_t delta, int64_t by)
+		{
+			return delta == UNKNOWN_DELTA ? UNKNOWN_DELTA : (int32_t) (delta + by);
+		}
+
+		// applies one instruction. `slot` is the size of a push (2, 4 or 8).
+		constexpr State step(State st, const Instruction& instr, const uint8_t* bytes, int slot)
+		{
+			auto& op = instr.op();
+			auto& dst = instr.dst();
+			auto& src = instr.src();
+			auto count = instr.operandCount();
+
+			// a push of a 16-bit operand only moves rsp by 2.
+			auto pushSize = [&]() -> int32_t {
+				if(count > 0 && dst.isRegister() && dst.reg().width() == 16)   return 2;
+				if(count > 0 && dst.isImmediate() && dst.immediateSize() == 16) return 2;
+				return slot;
+			};
+
+			if(op == ops::PUSH || op == ops::PUSHF)
+			{
+				st.sp = add(st.sp, -pushSize());
+				return st;
+			}
+			else if(op == ops::POP || op == ops::POPF)
+			{
+				if(count > 0 && isSP(dst))      st.sp = UNKNOWN_DELTA;
+				else                            st.sp = add(st.sp, pushSize());
+
+				if(count > 0 && isFP(dst))
+					st.fp = UNKNOWN_DELTA;
+
+				return st;
+			}
+			else if(op == ops::PUSHA || op == ops::PUSHAD || op == ops::POPA || op == ops::POPAD)
+			{
+				auto size = (op == ops::PUSHA || op == ops::POPA) ? 16 : 32;
+				st.sp = add(st.sp, (op == ops::PUSHA || op == ops::PUSHAD) ? -size : size);
+				if(op == ops::POPA || op == ops::POPAD)
+					st.fp = UNKNOWN_DELTA;
+
+				return st;
+			}
+			else if(op == ops::ENTER)
+			{
+				// enter size, 0 = push rbp; mov rbp, rsp; sub rsp, size. with a nesting level, it also copies
+				// that many frame pointers, which nobody does.
+				st.sp = add(st.sp, -slot);
+				st.fp = st.sp;
+
+				if(count > 1 && src.isImmediate() && (src.imm() & 0x1F) != 0)
+					st.sp = UNKNOWN_DELTA;
+				else
+					st.sp = add(st.sp, -(int64_t) (dst.imm() & 0xFFFF));
+
+				return st;
+			}
+			else if(op == ops::LEAVE)
+			{
+				// mov rsp, rbp; pop rbp.
+				st.sp = add(st.fp, slot);
+				st.fp = UNKNOWN_DELTA;
+				return st;
+			}
+			else if(isCall(op) || op == ops::RET || op == ops::RETF)
+			{
+				// the callee pops what the call pushed (no stdcall); a ret is the end of the line anyway.
+				return st;
+			}
+			else if((op == ops::ADD || op == ops::SUB) && count == 2 && isSP(dst) && src.isImmediate())
+			{
+				auto imm = signExtend(src.imm(), src.immediateSize());
+				st.sp = add(st.sp, op == ops::ADD ? imm : -imm);
+				return st;
+			}
+			else if(op == ops::LEA && count == 2 && (isSP(dst) || isFP(dst)) && src.isMemory() && !src.mem().index().present())
+			{
+				auto base = src.mem().base();
+				auto from = (base.present() && base.index() == 4) ? st.sp : ((base.present() && base.index() == 5) ? st.fp : UNKNOWN_DELTA);
+				auto val = add(from, leaDisplacement(instr, bytes));
+
+				if(isSP(dst))   st.sp = val;
+				else            st.fp = val;
+
+				return st;
+			}
+			else if(op == ops::MOV && count == 2 && dst.isRegister() && src.isRegister() && (isSP(dst) || isFP(dst)))
+			{
+				auto val = isSP(src) ? st.sp : (isFP(src) ? st.fp : UNKNOWN_DELTA);
+				if(isSP(dst))   st.sp = val;
+				else            st.fp = val;
+
+				return st;
+			}
+
+			// anything else that writes rsp (and rsp, -16; sub rsp, rax; mov rsp, [x]) loses it, and the
+			// same goes for rbp.
+			auto use = registerUse(instr);
+			if(use.writes & regmask::RSP)
+				st.sp = UNKNOWN_DELTA;
+
+			if(use.writes & regmask::RBP)
+				st.fp = UNKNOWN_DELTA;
+
+			return st;
+		}
+	}
+
+	// computes the stack pointer delta at every instruction of a function, given its control flow graph.
+	// the blocks are visited once each in reverse postorder, so every block's forward predecessors are
+	// done before it; each instruction is decoded once, and all the buffers (in here and in the output)
+	// are reused from one function to the next, so there is no allocation per instruction.
+	struct StackTracker
+	{
+		void analyse(const CodeRegion& region, const ControlFlowGraph& g, StackDeltas& out)
+		{
+			auto n = g.numBlocks();
+			auto slot = (region.mode() == ExecMode::Long ? 8 : (region.mode() == ExecMode::Compat ? 4 : 2));
+
+			out.blockFirst.assign(n, 0);
+			out.blockCount.assign(n, 0);
+			out.blockEntry.assign(n, UNKNOWN_DELTA);
+			out.blockEntryFrame.assign(n, UNKNOWN_DELTA);
+			out.addresses.clear();
+			out.deltas.clear();
+			out.notes.clear();
+
+			if(n == 0)
+				return;
+
+			this->postorder(g);
+
+			this->entered.assign(n, 0);
+			this->entered[g.entryBlock] = 1;
+			out.blockEntry[g.entryBlock] = 0;
+
+			for(auto it = this->order.rbegin(); it != this->order.rend(); ++it)
+			{
+				auto b = *it;
+				auto st = stack::State { out.blockEntry[b], out.blockEntryFrame[b] };
+
+				if(!this->entered[b])
+					out.notes.push_back(StackNote { g.blockStarts[b], StackIssue::Unreached, UNKNOWN_DELTA });
+
+				out.blockFirst[b] = out.addresses.size();
+
+				auto end = g.blockStarts[b] + g.blockSizes[b];
+				for(auto ip = g.blockStarts[b]; ip < end; )
+				{
+					auto instr = region.decode(ip);
+					out.addresses.push_back(ip);
+					out.deltas.push_back(st.sp);
+
+					auto next = stack::step(st, instr, region.bytes() + region.offsetOf(ip), slot);
+					if(st.sp != UNKNOWN_DELTA && next.sp == UNKNOWN_DELTA)
+						out.notes.push_back(StackNote { ip, StackIssue::Lost, st.sp });
+
+					// the delta on the way out; for ret and tail calls, it had better be 0.
+					if(this->leaves(g, instr, ip) && st.sp != UNKNOWN_DELTA && st.sp != 0)
+						out.notes.push_back(StackNote { ip, StackIssue::Unbalanced, st.sp });
+
+					st = next;
+					ip = region.nextBoundary(ip, instr);
+				}
+
+				out.blockCount[b] = out.addresses.size() - out.blockFirst[b];
+
+				for(auto e = g.firstEdge(b); e < g.lastEdge(b); e++)
+				{
+					auto s = g.edgeTargets[e];
+					if(!this->entered[s])
+					{
+						this->entered[s] = 1;
+						out.blockEntry[s] = st.sp;
+						out.blockEntryFrame[s] = st.fp;
+					}
+					else if(out.blockEntry[s] != st.sp && st.sp != UNKNOWN_DELTA && out.blockEntry[s] != UNKNOWN_DELTA)
+					{
+						out.notes.push_back(StackNote { g.blockStarts[s], StackIssue::Conflict, st.sp });
+					}
+				}
+			}
+
+			std::sort(out.notes.begin(), out.notes.end(), [](auto& a, auto& b) { return a.address < b.address; });
+		}
+
+	private:
+		// a ret, or a jump to somewhere that isn't in the function.
+		bool leaves(const ControlFlowGraph& g, const Instruction& instr, uint64_t ip) const
+		{
+			auto& op = instr.op();
+			if(op == ops::RET || op == ops::RETF)
+				return true;
+
+			if(op == ops::JMP && hasRelativeTarget(instr))
+				return g.blockContaining(branchTarget(instr, ip)) < 0;
+
+			return false;
+		}
+
+		void postorder(const ControlFlowGraph& g)
+		{
+			auto n = g.numBlocks();
+			this->order.clear();
+			this->visited.assign(n, 0);
+			this->stack.clear();
+
+			// (block, next edge to look at)
+			this->stack.emplace_back(g.entryBlock, g.firstEdge(g.entryBlock));
+			this->visited[g.entryBlock] = 1;
+
+			while(!this->stack.empty())
+			{
+				auto& [b, e] = this->stack.back();
+				if(e == g.lastEdge(b))
+				{
+					this->order.push_back(b);
+					this->stack.pop_back();
+					continue;
+				}
+
+				auto s = g.edgeTargets[e++];
+				if(!this->visited[s])
+				{
+					this->visited[s] = 1;
+					this->stack.emplace_back(s, g.firstEdge(s));
+				}
+			}
+
+			// anything the edges don't reach (there shouldn't be anything) still gets a turn, at the end.
+			for(uint32_t b = n; b-- > 0; )
+			{
+				if(!this->visited[b])
+					this->order.insert(this->order.begin(), b);
+			}
+		}
+
+		std::vector<uint32_t> order;
+		std::vector<uint8_t> visited;
+		std::vector<uint8_t> entered;
+		std::vector<std::pair<uint32_t, uint32_t>> stack;
+	};
+}
@@ -0,0 +1,390 @@
+// stats.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "flow.h"
+
+namespace instrad::x86
+{
+	namespace stats
+	{
+		enum class Prefix : uint8_t
+		{
+			OperandSize, AddressSize, CS, DS, ES, FS, GS, SS, Lock, Rep, Repnz, Rex, RexW, Vex2, Vex3, Count
+		};
+
+		enum class OperandKind : uint8_t
+		{
+			Gpr, Vector, Mmx, X87, Segment, System, Imm8, Imm16, Imm32, Imm64, Memory, Relative, Far, Count
+		};
+
+		// how the memory operands were addressed.
+		enum class MemoryForm : uint8_t
+		{
+			Base, BaseDisp8, BaseDisp32, Sib, SibDisp8, SibDisp32, RipRelative, Absolute, Implicit, Count
+		};
+
+		// which opcode table the instruction came out of. x87 is the d8-df part of the primary map.
+		enum class OpcodeMap : uint8_t
+		{
+			Primary, X87, Map0F, Map0F38, Map0F3A, Amd3DNow, Vex1, Vex2, Vex3, Count
+		};
+
+		constexpr const char* PREFIX_NAMES[] = {
+			"66 (operand size)", "67 (address size)", "2e (cs)", "3e (ds)", "26 (es)", "64 (fs)", "65 (gs)",
+			"36 (ss)", "f0 (lock)", "f3 (rep)", "f2 (repnz)", "rex", "rex.w", "vex (2 byte)", "vex (3 byte)",
+		};
+
+		constexpr const char* OPERAND_NAMES[] = {
+			"gpr", "xmm/ymm", "mmx", "x87", "segment", "control/debug", "imm8", "imm16", "imm32", "imm64",
+			"memory", "relative", "far",
+		};
+
+		constexpr const char* MEMORY_FORM_NAMES[] = {
+			"[base]", "[base + disp8]", "[base + disp32]", "[sib]", "[sib + disp8]", "[sib + disp32]",
+			"[rip + disp32]", "[disp]", "implicit (no modrm)",
+		};
+
+		constexpr const char* MAP_NAMES[] = {
+			"primary", "x87", "0f", "0f 38", "0f 3a", "3dnow", "vex map 1", "vex map 2", "vex map 3",
+		};
+
+		static_assert(sizeof(PREFIX_NAMES) / sizeof(PREFIX_NAMES[0]) == (size_t) Prefix::Count);
+		static_assert(sizeof(OPERAND_NAMES) / sizeof(OPERAND_NAMES[0]) == (size_t) OperandKind::Count);
+		static_assert(sizeof(MEMORY_FORM_NAMES) / sizeof(MEMORY_FORM_NAMES[0]) == (size_t) MemoryForm::Count);
+		static_assert(sizeof(MAP_NAMES) / sizeof(MAP_NAMES[0]) == (size_t) OpcodeMap::Count);
+
+		// op ids go from -2 (INVALID) up, plus one more slot at the end for anything past ops::COUNT.
+		constexpr size_t OP_SLOTS = ops::COUNT + 3;
+
+		constexpr size_t opSlot(const Op& op) { return std::min((size_t) (op.id() + 2), OP_SLOTS - 1); }
+
+		// below this many bytes per thread, it's not worth starting one.
+		constexpr size_t MIN_CHUNK = 64 * 1024;
+	}
+
+	// histograms over a bunch of instructions. fixed-size arrays of counters all the way down, so that
+	// counting is just some increments, and merging the per-thread ones is just adding them up.
+	struct InstructionStats
+	{
+		uint64_t instructions = 0;      // not counting the undecodable bytes
+		uint64_t invalid = 0;
+		uint64_t bytes = 0;
+
+		uint64_t ops[stats::OP_SLOTS] = { };
+		const char* opNames[stats::OP_SLOTS] = { };
+
+		uint64_t lengths[16] = { };     // the last one is 15 and up (which the cpu wouldn't take)
+		uint64_t prefixes[(size_t) stats::Prefix::Count] = { };
+		uint64_t operands[(size_t) stats::OperandKind::Count] = { };
+		uint64_t memoryForms[(size_t) stats::MemoryForm::Count] = { };
+		uint64_t maps[(size_t) stats::OpcodeMap::Count] = { };
+
+		// `bytes` are the instruction's own. a weight of (uint64_t) -1 takes an instruction back out
+		// again; the counters wrap around, so that works out as long as it was put in first.
+		void add(const Instruction& instr, const uint8_t* bytes, ExecMode mode, uint64_t weight = 1)
+		{
+			using namespace stats;
+
+			auto& op = instr.op();
+			auto len = instr.length();
+			auto slot = opSlot(op);
+
+			if(this->ops[slot] == 0)
+				this->opNames[slot] = op.mnemonic();
+
+			this->ops[slot] += weight;
+			if(op == ops::INVALID)
+			{
+				this->invalid += weight;
+				this->bytes += weight;
+				return;
+			}
+
+			this->instructions += weight;
+			this->bytes += len * weight;
+			this->lengths[std::min(len, (size_t) 15)] += weight;
+
+			auto& mods = instr.mods();
+			auto count = [&](auto& array, auto which) { array[(size_t) which] += weight; };
+
+			// the legacy prefixes (each kind only once, however many times it shows up).
+			uint32_t seen = 0;
+			size_t p = 0;
+			for(bool more = true; more && p < len; )
+			{
+				switch(bytes[p])
+				{
+					case 0x66: seen |= 1u << (int) Prefix::OperandSize; break;
+					case 0x67: seen |= 1u << (int) Prefix::AddressSize; break;
+					case 0x2E: seen |= 1u << (int) Prefix::CS; break;
+					case 0x3E: seen |= 1u << (int) Prefix::DS; break;
+					case 0x26: seen |= 1u << (int) Prefix::ES; break;
+					case 0x64: seen |= 1u << (int) Prefix::FS; break;
+					case 0x65: seen |= 1u << (int) Prefix::GS; break;
+					case 0x36: seen |= 1u << (int) Prefix::SS; break;
+					case 0xF0: seen |= 1u << (int) Prefix::Lock; break;
+					case 0xF3: seen |= 1u << (int) Prefix::Rep; break;
+					case 0xF2: seen |= 1u << (int) Prefix::Repnz; break;
+					default: more = false; continue;
+				}
+
+				p++;
+			}
+
+			// then vex or rex, and the escape bytes; `modrm` ends up where the modrm would be, if it has one.
+			auto map = OpcodeMap::Primary;
+			size_t modrm = 0;
+			auto at = [&](size_t i) -> uint8_t { return i < len ? bytes[i] : 0; };
+
+			if(mods.vex.present())
+			{
+				bool three = (at(p) == 0xC4);
+				seen |= 1u << (int) (three ? Prefix::Vex3 : Prefix::Vex2);
+
+				auto m = mods.vex.map();
+				map = (m == 2) ? OpcodeMap::Vex2 : (m == 3) ? OpcodeMap::Vex3 : OpcodeMap::Vex1;
+				modrm = p + (three ? 3 : 2) + 1;
+			}
+			else
+			{
+				if(mode == ExecMode::Long && (at(p) & 0xF0) == 0x40)
+				{
+					seen |= 1u << (int) Prefix::Rex;
+					if(at(p) & 0x8)
+						seen |= 1u << (int) Prefix::RexW;
+
+					p++;
+				}
+
+				if(at(p) == 0x0F)
+				{
+					auto next = at(p + 1);
+					if(next == 0x0F)        map = OpcodeMap::Amd3DNow,  modrm = p + 2;
+					else if(next == 0x38)   map = OpcodeMap::Map0F38,   modrm = p + 3;
+					else if(next == 0x3A)   map = OpcodeMap::Map0F3A,   modrm = p + 3;
+					else                    map = OpcodeMap::Map0F,     modrm = p + 2;
+				}
+				else
+				{
+					if(at(p) >= 0xD8 && at(p) <= 0xDF)
+						map = OpcodeMap::X87;
+
+					modrm = p + 1;
+				}
+			}
+
+			count(this->maps, map);
+			for(size_t k = 0; k < (size_t) Prefix::Count; k++)
+			{
+				if(seen & (1u << k))
+					this->prefixes[k] += weight;
+			}
+
+			// the decoder keeps the modrm it used, but a zero one looks the same as none at all; so check
+			// that it's actually there in the bytes.
+			auto rm = mods.modrm;
+			bool hasModRM = modrm < len && at(modrm) == ((rm.mod() << 6) | (rm.reg() << 3) | rm.rm());
+
+			const Operand* operands[] = { &instr.dst(), &instr.src(), &instr.ext(), &instr.op4() };
+			for(int i = 0; i < instr.operandCount() && i < 4; i++)
+			{
+				auto& o = *operands[i];
+				if(o.isRegister())
+				{
+					auto idx = o.reg().index();
+					if(idx & regs::REG_FLAG_SSE)                                        count(this->operands, OperandKind::Vector);
+					else if(idx & regs::REG_FLAG_MMX)                                   count(this->operands, OperandKind::Mmx);
+					else if(idx & regs::REG_FLAG_X87)                                   count(this->operands, OperandKind::X87);
+					else if(idx & regs::REG_FLAG_SEGMENT)                               count(this->operands, OperandKind::Segment);
+					else if(idx & (regs::REG_FLAG_CONTROL | regs::REG_FLAG_DEBUG))      count(this->operands, OperandKind::System);
+					else                                                                count(this->operands, OperandKind::Gpr);
+				}
+				else if(o.isImmediate())
+				{
+					auto bits = o.immediateSize();
+					count(this->operands, bits <= 8 ? OperandKind::Imm8 : bits <= 16 ? OperandKind::Imm16
+						: bits <= 32 ? OperandKind::Imm32 : OperandKind::Imm64);
+				}
+				else if(o.isRelativeOffset())
+				{
+					count(this->operands, OperandKind::Relative);
+				}
+				else if(o.isFarOffset())
+				{
+					count(this->operands, OperandKind::Far);
+				}
+				else if(o.isMemory())
+				{
+					count(this->operands, OperandKind::Memory);
+
+					auto& mem = o.mem();
+					if(mem.base() == regs::RIP)
+					{
+						count(this->memoryForms, MemoryForm::RipRelative);
+					}
+					else if(!mem.base().present() && !mem.index().present())
+					{
+						count(this->memoryForms, MemoryForm::Absolute);
+					}
+					else if(!hasModRM || rm.mod() == 3)
+					{
+						count(this->memoryForms, MemoryForm::Implicit);
+					}
+					else
+					{
+						bool sib = !mods.legacyAddressingMode && rm.rm() == 4;
+						auto disp = rm.mod();
+
+						// mod 0 with a sib but no base is a disp32 too.
+						if(sib && disp == 0 && !mem.base().present())
+							disp = 2;
+
+						if(disp == 0)       count(this->memoryForms, sib ? MemoryForm::Sib : MemoryForm::Base);
+						else if(disp == 1)  count(this->memoryForms, sib ? MemoryForm::SibDisp8 : MemoryForm::BaseDisp8);
+						else                count(this->memoryForms, sib ? MemoryForm::SibDisp32 : MemoryForm::BaseDisp32);
+					}
+				}
+			}
+		}
+
+		InstructionStats& operator += (const InstructionStats& other)
+		{
+			this->instructions += other.instructions;
+			this->invalid += other.invalid;
+			this->bytes += other.bytes;
+
+			for(size_t i = 0; i < stats::OP_SLOTS; i++)
+			{
+				this->ops[i] += other.ops[i];
+				if(this->opNames[i] == nullptr)
+					this->opNames[i] = other.opNames[i];
+			}
+
+			auto merge = [](auto& a, auto& b) {
+				for(size_t i = 0; i < sizeof(a) / sizeof(a[0]); i++)
+					a[i] += b[i];
+			};
+
+			merge(this->lengths, other.lengths);
+			merge(this->prefixes, other.prefixes);
+			merge(this->operands, other.operands);
+			merge(this->memoryForms, other.memoryForms);
+			merge(this->maps, other.maps);
+
+			return *this;
+		}
+	};
+
+	// the same linear sweep as the driver's, split up
+	// between threads, with the same answer as doing it on one.
+	//
+	// each thread takes a chunk and sweeps it from its first byte, which might well be in the middle of an
+	// instruction; it keeps going past the end of the chunk to finish the last one, and notes where it
+	// stopped, and which bytes it thought instructions started at. afterwards, going through the chunks in
+	// order: where the previous one stopped is where this one should have started. if that's one of this
+	// chunk's starts, then everything from there on was right, and only the (one or two) instructions it
+	// saw before that come back out of the counts. if not, the right stream gets decoded until it runs into
+	// one of the starts, taking out the wrong ones it passes; x86 falls back into step quickly enough that
+	// this is hardly ever more than a few instructions.
+	inline InstructionStats collectStats(const CodeRegion& region, size_t threads = 0)
+	{
+		if(threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		auto size = region.size();
+		auto chunks = std::max((size_t) 1, std::min(threads, size / stats::MIN_CHUNK));
+
+		// chunks start on a multiple of 64 bytes, so that no two threads write the same word of the bitmap.
+		auto bounds = std::vector<uint64_t>();
+		for(size_t c = 0; c < chunks; c++)
+			bounds.push_back(region.base() + (((size * c) / chunks) & ~(size_t) 63));
+
+		bounds.push_back(region.end());
+
+		auto starts = std::vector<uint64_t>((size + 63) / 64);
+		auto results = std::vector<InstructionStats>(chunks);
+		auto ends = std::vector<uint64_t>(chunks);
+
+		auto mark = [&starts, &region](uint64_t ip, bool set) {
+			auto ofs = region.offsetOf(ip);
+			if(set) starts[ofs / 64] |= ((uint64_t) 1 << (ofs % 64));
+			else    starts[ofs / 64] &= ~((uint64_t) 1 << (ofs % 64));
+		};
+
+		auto isStart = [&starts, &region](uint64_t ip) -> bool {
+			auto ofs = region.offsetOf(ip);
+			return starts[ofs / 64] & ((uint64_t) 1 << (ofs % 64));
+		};
+
+		auto work = [&](size_t c) {
+			auto ip = bounds[c];
+			while(ip < bounds[c + 1])
+			{
+				auto instr = region.decode(ip);
+				results[c].add(instr, region.bytes() + region.offsetOf(ip), region.mode());
+				mark(ip, true);
+
+				ip = region.nextBoundary(ip, instr);
+			}
+
+			ends[c] = ip;
+		};
+
+		auto pool = std::vector<std::thread>();
+		for(size_t c = 1; c < chunks; c++)
+			pool.emplace_back(work, c);
+
+		work(0);
+		for(auto& t : pool)
+			t.join();
+
+		auto ret = results[0];
+		for(size_t c = 1; c < chunks; c++)
+		{
+			auto& stats = results[c];
+			auto lo = bounds[c];
+			auto hi = bounds[c + 1];
+
+			// follow the real stream until it lands on one of this chunk's starts (or leaves the chunk).
+			auto ip = ends[c - 1];
+			auto sync = ip;
+			while(sync < hi && !isStart(sync))
+				sync = region.nextBoundary(sync);
+
+			// every start this chunk had before that is wrong: the ones before `ip` are in the middle of the
+			// previous chunk's last instruction, and the real stream never landed on the ones after it.
+			for(auto a = lo; a < std::min(sync, hi); a++)
+			{
+				if(isStart(a))
+				{
+					stats.add(region.decode(a), region.bytes() + region.offsetOf(a), region.mode(), (uint64_t) -1);
+					mark(a, false);
+				}
+			}
+
+			for(auto a = ip; a < sync; )
+			{
+				auto instr = region.decode(a);
+				stats.add(instr, region.bytes() + region.offsetOf(a), region.mode());
+				mark(a, true);
+
+				a = region.nextBoundary(a, instr);
+			}
+
+			// if it never synced up, then this chunk's end is wherever the real stream got to.
+			if(sync >= hi)
+				ends[c] = sync;
+
+			ret += stats;
+		}
+
+		return ret;
+	}
+}
@@ -5,6 +5,31 @@
 #pragma once
 
 #include "tables/entry.h"
+#include "tables/vexentry.h"
+
+// by default the tables are compiled into every TU that includes this (and merged when linking). with
+// INSTRAD_EXTERN_TABLES, this only declares the ones that decode.h looks at directly (the rest are reached
+// through pointers in those), and they come from libinstrad.a instead; that saves parsing and evaluating
+// ~4000 constexpr table entries per TU. the price is that the decoder can't run in constant expressions
+// any more, since the tables aren't visible to the compiler.
+#if defined(INSTRAD_EXTERN_TABLES) || defined(INSTRAD_DEFINE_TABLES)
+
+namespace instrad::x86::tables
+{
+	extern const TableEntry PrimaryOpcodeMap[256];
+	extern const TableEntry SecondaryOpcodeMap_0F[256];
+	extern const TableEntry SecondaryOpcodeMap_0F_38[256];
+	extern const TableEntry SecondaryOpcodeMap_0F_3A[256];
+	extern const TableEntry SecondaryOpcodeMap_0F_0F_3DNow[256];
+
+	extern const VexEntry VEX_Map_1[256];
+	extern const VexEntry VEX_Map_2[256];
+	extern const VexEntry VEX_Map_3[256];
+}
+
+#endif
+
+#if !defined(INSTRAD_EXTERN_TABLES) || defined(INSTRAD_DEFINE_TABLES)
 
 #include "tables/primary.h"
 #include "tables/secondary.h"
@@ -381,3 +406,5 @@ namespace instrad::x86::tables
 	static_assert(ArrayLength(VEX_Map_3) == 256, "table invalid");
 
 }
+
+#endif
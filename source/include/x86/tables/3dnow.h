@@ -8,7 +8,7 @@
 
 namespace instrad::x86::tables
 {
-	constexpr TableEntry SecondaryOpcodeMap_0F_0F_3DNow[] = {
+	INSTRAD_TABLE TableEntry SecondaryOpcodeMap_0F_0F_3DNow[] = {
 		/*00*/ entry_blank,
 		/*01*/ entry_blank,
 		/*02*/ entry_blank,
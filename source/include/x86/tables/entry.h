@@ -6,6 +6,15 @@
 
 #include "../ops.h"
 
+// every table is defined with this. normally they're inline, so however many TUs include the decoder,
+// the linker keeps one copy of each. the TU that defines INSTRAD_DEFINE_TABLES (source/lib/tables.cpp)
+// gives them external linkage instead, for the ones that use INSTRAD_EXTERN_TABLES; see table.h.
+#if defined(INSTRAD_DEFINE_TABLES)
+	#define INSTRAD_TABLE extern constexpr
+#else
+	#define INSTRAD_TABLE inline constexpr
+#endif
+
 namespace instrad::x86
 {
 	enum class OpKind
@@ -10,7 +10,7 @@
 namespace instrad::x86::tables
 {
 	// the extension tables are indexed by the ModRM.REG value.
-	constexpr TableEntry ModRMExt_80[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_80[] = {
 		/*0*/ entry_2(0x80, ops::ADD, OpKind::RegMem8, OpKind::Imm8),
 		/*1*/ entry_2(0x80, ops::OR,  OpKind::RegMem8, OpKind::Imm8),
 		/*2*/ entry_2(0x80, ops::ADC, OpKind::RegMem8, OpKind::Imm8),
@@ -21,7 +21,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0x80, ops::CMP, OpKind::RegMem8, OpKind::Imm8),
 	};
 
-	constexpr TableEntry ModRMExt_81[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_81[] = {
 		/*0*/ entry_2(0x81, ops::ADD, OpKind::RegMemNative, OpKind::ImmNative),
 		/*1*/ entry_2(0x81, ops::OR,  OpKind::RegMemNative, OpKind::ImmNative),
 		/*2*/ entry_2(0x81, ops::ADC, OpKind::RegMemNative, OpKind::ImmNative),
@@ -33,7 +33,7 @@ namespace instrad::x86::tables
 	};
 
 	// these are apparently invalid in 64-bit mode.
-	constexpr TableEntry ModRMExt_82[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_82[] = {
 		/*0*/ entry_2(0x82, ops::ADD, OpKind::RegMem8, OpKind::Imm8),
 		/*1*/ entry_2(0x82, ops::OR,  OpKind::RegMem8, OpKind::Imm8),
 		/*2*/ entry_2(0x82, ops::ADC, OpKind::RegMem8, OpKind::Imm8),
@@ -44,7 +44,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0x82, ops::CMP, OpKind::RegMem8, OpKind::Imm8),
 	};
 
-	constexpr TableEntry ModRMExt_83[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_83[] = {
 		/*0*/ entry_2(0x83, ops::ADD, OpKind::RegMemNative, OpKind::SignExtImm8),
 		/*1*/ entry_2(0x83, ops::OR,  OpKind::RegMemNative, OpKind::SignExtImm8),
 		/*2*/ entry_2(0x83, ops::ADC, OpKind::RegMemNative, OpKind::SignExtImm8),
@@ -55,7 +55,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0x83, ops::CMP, OpKind::RegMemNative, OpKind::SignExtImm8),
 	};
 
-	constexpr TableEntry ModRMExt_8F[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_8F[] = {
 		/*0*/ entry_1(0x8F, ops::POP, OpKind::RegMem64),
 
 		/*1*/ entry_blank,
@@ -67,7 +67,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_C0[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_C0[] = {
 		/*0*/ entry_2(0xC0, ops::ROL, OpKind::RegMem8, OpKind::Imm8),
 		/*1*/ entry_2(0xC0, ops::ROR, OpKind::RegMem8, OpKind::Imm8),
 		/*2*/ entry_2(0xC0, ops::RCL, OpKind::RegMem8, OpKind::Imm8),
@@ -78,7 +78,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0xC0, ops::SAR, OpKind::RegMem8, OpKind::Imm8),
 	};
 
-	constexpr TableEntry ModRMExt_C1[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_C1[] = {
 		/*0*/ entry_2(0xC1, ops::ROL, OpKind::RegMemNative, OpKind::Imm8),
 		/*1*/ entry_2(0xC1, ops::ROR, OpKind::RegMemNative, OpKind::Imm8),
 		/*2*/ entry_2(0xC1, ops::RCL, OpKind::RegMemNative, OpKind::Imm8),
@@ -89,7 +89,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0xC1, ops::SAR, OpKind::RegMemNative, OpKind::Imm8),
 	};
 
-	constexpr TableEntry ModRMExt_C6[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_C6[] = {
 		/*0*/ entry_2(0xC6, ops::MOV, OpKind::RegMem8, OpKind::Imm8),
 
 		/*1*/ entry_blank,
@@ -101,7 +101,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_C7[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_C7[] = {
 		/*0*/ entry_2(0xC7, ops::MOV, OpKind::RegMemNative, OpKind::ImmNative),
 
 		/*1*/ entry_blank,
@@ -113,7 +113,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_D0[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_D0[] = {
 		/*0*/ entry_1(0xD0, ops::ROL, OpKind::RegMem8),
 		/*1*/ entry_1(0xD0, ops::ROR, OpKind::RegMem8),
 		/*2*/ entry_1(0xD0, ops::RCL, OpKind::RegMem8),
@@ -124,7 +124,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_1(0xD0, ops::SAR, OpKind::RegMem8),
 	};
 
-	constexpr TableEntry ModRMExt_D1[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_D1[] = {
 		/*0*/ entry_1(0xD1, ops::ROL, OpKind::RegMemNative),
 		/*1*/ entry_1(0xD1, ops::ROR, OpKind::RegMemNative),
 		/*2*/ entry_1(0xD1, ops::RCL, OpKind::RegMemNative),
@@ -135,7 +135,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_1(0xD1, ops::SAR, OpKind::RegMemNative),
 	};
 
-	constexpr TableEntry ModRMExt_D2[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_D2[] = {
 		/*0*/ entry_2(0xD2, ops::ROL, OpKind::RegMem8, OpKind::ImplicitCL),
 		/*1*/ entry_2(0xD2, ops::ROR, OpKind::RegMem8, OpKind::ImplicitCL),
 		/*2*/ entry_2(0xD2, ops::RCL, OpKind::RegMem8, OpKind::ImplicitCL),
@@ -146,7 +146,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0xD2, ops::SAR, OpKind::RegMem8, OpKind::ImplicitCL),
 	};
 
-	constexpr TableEntry ModRMExt_D3[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_D3[] = {
 		/*0*/ entry_2(0xD3, ops::ROL, OpKind::RegMemNative, OpKind::ImplicitCL),
 		/*1*/ entry_2(0xD3, ops::ROR, OpKind::RegMemNative, OpKind::ImplicitCL),
 		/*2*/ entry_2(0xD3, ops::RCL, OpKind::RegMemNative, OpKind::ImplicitCL),
@@ -158,7 +158,7 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry ModRMExt_F6[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_F6[] = {
 		/*0*/ entry_2(0xF6, ops::TEST, OpKind::RegMem8, OpKind::Imm8),
 		/*1*/ entry_2(0xF6, ops::TEST, OpKind::RegMem8, OpKind::Imm8),
 		/*2*/ entry_1(0xF6, ops::NOT,  OpKind::RegMem8),
@@ -169,7 +169,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_1(0xF6, ops::IDIV, OpKind::RegMem8),
 	};
 
-	constexpr TableEntry ModRMExt_F7[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_F7[] = {
 		/*0*/ entry_2(0xF7, ops::TEST, OpKind::RegMemNative, OpKind::ImmNative),
 		/*1*/ entry_2(0xF7, ops::TEST, OpKind::RegMemNative, OpKind::ImmNative),
 		/*2*/ entry_1(0xF7, ops::NOT,  OpKind::RegMemNative),
@@ -180,7 +180,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_1(0xF7, ops::IDIV, OpKind::RegMemNative),
 	};
 
-	constexpr TableEntry ModRMExt_FE[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_FE[] = {
 		/*0*/ entry_1(0xFE, ops::INC, OpKind::RegMem8),
 		/*1*/ entry_1(0xFE, ops::DEC, OpKind::RegMem8),
 
@@ -192,7 +192,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_FF[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_FF[] = {
 		/*0*/ entry_1(0xFF, ops::INC,  OpKind::RegMemNative),
 		/*1*/ entry_1(0xFF, ops::DEC,  OpKind::RegMemNative),
 		/*2*/ entry_1(0xFF, ops::CALL, OpKind::RegMem64),
@@ -206,7 +206,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry PrimaryOpcodeMap[] = {
+	INSTRAD_TABLE TableEntry PrimaryOpcodeMap[] = {
 		/*00*/ entry_2(0x00, ops::ADD,  OpKind::RegMem8, OpKind::Reg8),
 		/*01*/ entry_2(0x01, ops::ADD,  OpKind::RegMemNative, OpKind::RegNative),
 		/*02*/ entry_2(0x02, ops::ADD,  OpKind::Reg8, OpKind::RegMem8),
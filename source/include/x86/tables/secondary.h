@@ -9,7 +9,7 @@
 namespace instrad::x86::tables
 {
 	// group 6
-	constexpr TableEntry ModRMExt_0F_00[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_00[] = {
 		/*0*/ entry_1(0x00, ops::SLDT, OpKind::RegMem32),                   // it's not really r/m32, but... it works.
 		/*1*/ entry_1(0x00, ops::STR,  OpKind::RegMem32),                   // it's not really r/m32, but... it works.
 		/*2*/ entry_1(0x00, ops::LLDT, OpKind::RegMem16),
@@ -25,7 +25,7 @@ namespace instrad::x86::tables
 	// each entry here is offset by 1; the extensions are only used when modRM.mod == 3; if it is not, then
 	// the first entry is the real instruction. if it == 3, then use the following instructions, but add 1 to
 	// modRM.rm to get which instruction to use.
-	constexpr TableEntry ModRMExt_0F_01_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_01_Mod3_Reg1_RM[] = {
 		/*0*/ entry_1(0x01, ops::SIDT, OpKind::Memory),                     // it's actually mem16:32/64, but... it works.
 
 		/*1*/ entry_0_modrm(0x01, ops::MONITOR),                            // modRM == 0xC8
@@ -39,7 +39,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_01_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_01_Mod3_Reg2_RM[] = {
 		/*0*/ entry_1(0x01, ops::LGDT, OpKind::Memory),                     // it's actually mem16:32/64, but... it works.
 
 		/*1*/ entry_0_modrm(0x01, ops::XGETBV),                             // modRM == 0xD0
@@ -53,7 +53,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_01_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_01_Mod3_Reg3_RM[] = {
 		/*0*/ entry_1(0x01, ops::LIDT, OpKind::Memory),                     // it's actually mem16:32/64, but... it works.
 
 		/*1*/ entry_0_modrm(0x01, ops::VMRUN),                              // modRM == 0xD8
@@ -66,7 +66,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0x01, ops::INVLPGA, OpKind::ImplicitRAX, OpKind::ImplicitECX), // modRM == 0xDF
 	};
 
-	constexpr TableEntry ModRMExt_0F_01_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_01_Mod3_Reg7_RM[] = {
 		/*0*/ entry_1(0x01, ops::INVLPG, OpKind::Memory),
 
 		/*1*/ entry_0_modrm(0x01, ops::SWAPGS),                             // modRM == 0xF8
@@ -80,7 +80,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_01[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_01[] = {
 		/*0*/ entry_1(0x01, ops::SGDT, OpKind::Memory),                     // it's actually mem16:32/64, but... it works.
 		/*1*/ entry_ext_rm(0x01, &ModRMExt_0F_01_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0x01, &ModRMExt_0F_01_Mod3_Reg2_RM[0]),
@@ -92,7 +92,7 @@ namespace instrad::x86::tables
 	};
 
 	// group 16
-	constexpr TableEntry ModRMExt_0F_18[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_18[] = {
 		/*0*/ entry_1(0x18, ops::PREFETCH, OpKind::Memory),
 		/*1*/ entry_1(0x18, ops::PREFETCH, OpKind::Memory),
 		/*2*/ entry_1(0x18, ops::PREFETCH, OpKind::Memory),
@@ -107,28 +107,28 @@ namespace instrad::x86::tables
 	// modRM.mod == 3 or modRM.mod != 3. we follow the same structure as the nested tables above.
 	// since there's no differentiation based on modRM.rm, the first entry is modRM.mod != 3
 	// and the second entry is modRM.mod == 3.
-	constexpr TableEntry ModRMExt_0F_AE_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_AE_Mod3_Reg4_RM[] = {
 		/*0*/ entry_1(0xAE, ops::XSAVE, OpKind::Memory),                    // modRM.mod != 3
 		/*1*/ entry_blank,                                                  // modRM.mod == 3
 	};
 
-	constexpr TableEntry ModRMExt_0F_AE_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_AE_Mod3_Reg5_RM[] = {
 		/*0*/ entry_1(0xAE, ops::XRSTOR, OpKind::Memory),                   // modRM.mod != 3
 		/*1*/ entry_0_modrm(0xAE, ops::LFENCE),                             // modRM.mod == 3
 	};
 
-	constexpr TableEntry ModRMExt_0F_AE_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_AE_Mod3_Reg6_RM[] = {
 		/*0*/ entry_1(0xAE, ops::XSAVEOPT, OpKind::Memory),                 // modRM.mod != 3
 		/*1*/ entry_0_modrm(0xAE, ops::MFENCE),                             // modRM.mod == 3
 	};
 
-	constexpr TableEntry ModRMExt_0F_AE_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_AE_Mod3_Reg7_RM[] = {
 		/*0*/ entry_1(0xAE, ops::CLFLUSH, OpKind::Memory),                  // modRM.mod != 3
 		/*1*/ entry_0_modrm(0xAE, ops::SFENCE),                             // modRM.mod == 3
 	};
 
 	// only used when opcode == 0x0F 0xAE, and has no prefix
-	constexpr TableEntry ModRMExt_0F_AE_Prefix_None[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_AE_Prefix_None[] = {
 		/*0*/ entry_1(0xAE, ops::FXSAVE,  OpKind::Memory),
 		/*1*/ entry_1(0xAE, ops::FXRSTOR, OpKind::Memory),
 		/*2*/ entry_1(0xAE, ops::LDMXCSR, OpKind::Memory),
@@ -140,7 +140,7 @@ namespace instrad::x86::tables
 	};
 
 	// only used when opcode == 0x0F 0xAE, and has prefix 0xF3
-	constexpr TableEntry ModRMExt_0F_AE_Prefix_F3[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_AE_Prefix_F3[] = {
 		/*0*/ entry_1(0xAE, ops::RDFSBASE, OpKind::Reg32_Rm),
 		/*1*/ entry_1(0xAE, ops::RDGSBASE, OpKind::Reg32_Rm),
 		/*2*/ entry_1(0xAE, ops::WRFSBASE, OpKind::Reg32_Rm),
@@ -163,25 +163,25 @@ namespace instrad::x86::tables
 
 	// also, there are some instructions taking two register operands; in these cases we must
 	// manually specify which register goes in the modRM.reg slot, and which one in the modRM.rm slot.
-	constexpr TableEntry ModRMExt_0F_PrefixNone_12_Mod3[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_12_Mod3[] = {
 		/*0*/ entry_2(0x12, ops::MOVLPS,  OpKind::RegXmm, OpKind::Mem64),       // modRM.mod != 3
 		/*1*/ entry_2(0x12, ops::MOVHLPS, OpKind::RegXmm, OpKind::RegXmm_Rm),   // modRM.mod == 3
 	};
 
-	constexpr TableEntry ModRMExt_0F_PrefixNone_16_Mod3[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_16_Mod3[] = {
 		/*0*/ entry_2(0x16, ops::MOVHPS,  OpKind::RegXmm, OpKind::Mem64),       // modRM.mod != 3
 		/*1*/ entry_2(0x16, ops::MOVLHPS, OpKind::RegXmm, OpKind::RegXmm_Rm),   // modRM.mod == 3
 	};
 
 	// very specific table for cmpxchg8B/16B -- if REX.W is present, then it's 16b, if not it's 8b.
 	// so far, this is the only instruction that does this -- but we still need to support it.
-	constexpr TableEntry ModRMExt_0F_PrefixAny_C7_RexW[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixAny_C7_RexW[] = {
 		/*0*/ entry_1(0xC7, ops::CMPXCHG8B, OpKind::Mem64),                     // rex.W == 0
 		/*1*/ entry_1(0xC7, ops::CMPXCHG16B, OpKind::Mem128)                    // rex.W == 1
 	};
 
 	// "normal" extensions
-	constexpr TableEntry ModRMExt_0F_PrefixAny_C7[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixAny_C7[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_ext_rexw(0xC7, &ModRMExt_0F_PrefixAny_C7_RexW[0]),
 		/*2*/ entry_blank,
@@ -192,7 +192,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_1(0xC7, ops::RDSEED, OpKind::Reg32_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_0F_PrefixNone_71[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_71[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0x71, ops::PSRLW, OpKind::RegMmx_Rm, OpKind::Imm8),
@@ -203,7 +203,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_PrefixNone_72[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_72[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0x72, ops::PSRLD, OpKind::RegMmx_Rm, OpKind::Imm8),
@@ -214,7 +214,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_PrefixNone_73[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_73[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0x73, ops::PSRLQ, OpKind::RegMmx_Rm, OpKind::Imm8),
@@ -225,7 +225,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_PrefixNone_B9[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_B9[] = {
 		/*0*/ entry_0(0xB9, ops::UD1),
 		/*1*/ entry_0(0xB9, ops::UD1),
 		/*2*/ entry_0(0xB9, ops::UD1),
@@ -236,7 +236,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_0(0xB9, ops::UD1),
 	};
 
-	constexpr TableEntry ModRMExt_0F_PrefixNone_BA[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_PrefixNone_BA[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
@@ -247,7 +247,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0xBA, ops::BTC, OpKind::RegMem32, OpKind::Imm8),
 	};
 
-	constexpr TableEntry ModRMExt_0F_Prefix66_71[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_Prefix66_71[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0x71, ops::PSRLW, OpKind::RegXmm_Rm, OpKind::Imm8),
@@ -258,7 +258,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_Prefix66_72[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_Prefix66_72[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0x72, ops::PSRLD, OpKind::RegXmm_Rm, OpKind::Imm8),
@@ -269,7 +269,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_0F_Prefix66_73[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_Prefix66_73[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0x73, ops::PSRLQ, OpKind::RegXmm_Rm, OpKind::Imm8),
@@ -280,7 +280,7 @@ namespace instrad::x86::tables
 		/*7*/ entry_2(0x73, ops::PSLLDQ, OpKind::RegXmm_Rm, OpKind::Imm8),
 	};
 
-	constexpr TableEntry ModRMExt_0F_Prefix66_78[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_Prefix66_78[] = {
 		/*0*/ entry_3(0x73, ops::EXTRQ, OpKind::RegMmx_Rm, OpKind::Imm8, OpKind::Imm8),
 
 		/*1*/ entry_blank,
@@ -293,49 +293,49 @@ namespace instrad::x86::tables
 	};
 
 	// the order for these are NONE, 0x66, 0xF2, 0xF3
-	constexpr TableEntry PrefixExt_0F_10[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_10[] = {
 		/*0*/ entry_2(0x10, ops::MOVUPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x10, ops::MOVUPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x10, ops::MOVSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x10, ops::MOVSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_11[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_11[] = {
 		/*0*/ entry_2(0x11, ops::MOVUPS, OpKind::RegXmmMem128, OpKind::RegXmm),
 		/*1*/ entry_2(0x11, ops::MOVUPD, OpKind::RegXmmMem128, OpKind::RegXmm),
 		/*2*/ entry_2(0x11, ops::MOVSD, OpKind::RegXmmMem128, OpKind::RegXmm),
 		/*3*/ entry_2(0x11, ops::MOVSS, OpKind::RegXmmMem32, OpKind::RegXmm),
 	};
-	constexpr TableEntry PrefixExt_0F_12[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_12[] = {
 		/*0*/ entry_ext_mod(0x12, &ModRMExt_0F_PrefixNone_12_Mod3[0]),
 		/*1*/ entry_2(0x12, ops::MOVLPD, OpKind::RegXmm, OpKind::Mem64),
 		/*2*/ entry_2(0x12, ops::MOVDDUP, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x12, ops::MOVSLDUP, OpKind::RegXmm, OpKind::RegXmmMem128),
 	};
-	constexpr TableEntry PrefixExt_0F_13[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_13[] = {
 		/*0*/ entry_2(0x13, ops::MOVLPS, OpKind::Mem64, OpKind::RegXmm),
 		/*1*/ entry_2(0x13, ops::MOVLPD, OpKind::Mem64, OpKind::RegXmm),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_14[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_14[] = {
 		/*0*/ entry_2(0x14, ops::UNPCKLPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x14, ops::UNPCKLPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_15[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_15[] = {
 		/*0*/ entry_2(0x15, ops::UNPCKHPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x15, ops::UNPCKHPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_16[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_16[] = {
 		/*0*/ entry_ext_mod(0x16, &ModRMExt_0F_PrefixNone_16_Mod3[0]),
 		/*1*/ entry_2(0x16, ops::MOVHPD, OpKind::RegXmm, OpKind::Mem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0x16, ops::MOVSHDUP, OpKind::RegXmm, OpKind::RegXmmMem128),
 	};
-	constexpr TableEntry PrefixExt_0F_17[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_17[] = {
 		/*0*/ entry_2(0x17, ops::MOVHPS, OpKind::Mem64, OpKind::RegXmm),
 		/*1*/ entry_2(0x17, ops::MOVHPD, OpKind::Mem64, OpKind::RegXmm),
 		/*2*/ entry_blank,
@@ -343,49 +343,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_28[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_28[] = {
 		/*0*/ entry_2(0x28, ops::MOVAPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x28, ops::MOVAPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_29[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_29[] = {
 		/*0*/ entry_2(0x29, ops::MOVAPS, OpKind::RegXmmMem128, OpKind::RegXmm),
 		/*1*/ entry_2(0x29, ops::MOVAPD, OpKind::RegXmmMem128, OpKind::RegXmm),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_2A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_2A[] = {
 		/*0*/ entry_2(0x2A, ops::CVTPI2PS, OpKind::RegXmm, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x2A, ops::CVTPI2PD, OpKind::RegXmm, OpKind::RegMmxMem64),
 		/*2*/ entry_2(0x2A, ops::CVTSI2SD, OpKind::RegXmm, OpKind::RegMem32),
 		/*3*/ entry_2(0x2A, ops::CVTSI2SS, OpKind::RegXmm, OpKind::RegMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_2B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_2B[] = {
 		/*0*/ entry_2(0x2B, ops::MOVNTPS, OpKind::Mem128, OpKind::RegXmm),
 		/*1*/ entry_2(0x2B, ops::MOVNTPD, OpKind::Mem128, OpKind::RegXmm),
 		/*2*/ entry_2(0x2B, ops::MOVNTSD, OpKind::Mem64, OpKind::RegXmm),
 		/*3*/ entry_2(0x2B, ops::MOVNTSS, OpKind::Mem32, OpKind::RegXmm),
 	};
-	constexpr TableEntry PrefixExt_0F_2C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_2C[] = {
 		/*0*/ entry_2(0x2C, ops::CVTTPS2PI, OpKind::RegMmx, OpKind::RegXmmMem64),
 		/*1*/ entry_2(0x2C, ops::CVTTPD2PI, OpKind::RegMmx, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x2C, ops::CVTTSD2SI, OpKind::Reg32, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x2C, ops::CVTTSS2SI, OpKind::Reg32, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_2D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_2D[] = {
 		/*0*/ entry_2(0x2D, ops::CVTPS2PI, OpKind::RegMmx, OpKind::RegXmmMem64),
 		/*1*/ entry_2(0x2D, ops::CVTPD2PI, OpKind::RegMmx, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x2D, ops::CVTSD2SI, OpKind::Reg32, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x2D, ops::CVTSS2SI, OpKind::Reg32, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_2E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_2E[] = {
 		/*0*/ entry_2(0x2E, ops::UCOMISS, OpKind::RegXmm, OpKind::RegXmmMem32),
 		/*1*/ entry_2(0x2E, ops::UCOMISD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_2F[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_2F[] = {
 		/*0*/ entry_2(0x2F, ops::COMISS, OpKind::RegXmm, OpKind::RegXmmMem32),
 		/*1*/ entry_2(0x2F, ops::COMISD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
@@ -393,49 +393,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_50[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_50[] = {
 		/*0*/ entry_2(0x50, ops::MOVMSKPS, OpKind::Reg32, OpKind::RegXmm_Rm),
 		/*1*/ entry_2(0x50, ops::MOVMSKPD, OpKind::Reg32, OpKind::RegXmm_Rm),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_51[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_51[] = {
 		/*0*/ entry_2(0x51, ops::SQRTPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x51, ops::SQRTPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x51, ops::SQRTSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x51, ops::SQRTSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_52[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_52[] = {
 		/*0*/ entry_2(0x52, ops::RSQRTPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0x52, ops::RSQRTSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_53[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_53[] = {
 		/*0*/ entry_2(0x53, ops::RCPPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0x53, ops::RCPSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_54[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_54[] = {
 		/*0*/ entry_2(0x54, ops::ANDPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x54, ops::ANDPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_55[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_55[] = {
 		/*0*/ entry_2(0x55, ops::ANDNPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x55, ops::ANDNPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_56[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_56[] = {
 		/*0*/ entry_2(0x56, ops::ORPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x56, ops::ORPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_57[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_57[] = {
 		/*0*/ entry_2(0x57, ops::XORPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x57, ops::XORPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
@@ -443,49 +443,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_58[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_58[] = {
 		/*0*/ entry_2(0x58, ops::ADDPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x58, ops::ADDPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x58, ops::ADDSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x58, ops::ADDSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_59[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_59[] = {
 		/*0*/ entry_2(0x59, ops::MULPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x59, ops::MULPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x59, ops::MULSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x59, ops::MULSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_5A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_5A[] = {
 		/*0*/ entry_2(0x5A, ops::CVTPS2PD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*1*/ entry_2(0x5A, ops::CVTPD2PS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x5A, ops::CVTSD2SS, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x5A, ops::CVTSS2SD, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_5B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_5B[] = {
 		/*0*/ entry_2(0x5B, ops::CVTDQ2PS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x5B, ops::CVTPS2DQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0x5B, ops::CVTTPS2DQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 	};
-	constexpr TableEntry PrefixExt_0F_5C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_5C[] = {
 		/*0*/ entry_2(0x5C, ops::SUBPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x5C, ops::SUBPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x5C, ops::SUBSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x5C, ops::SUBSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_5D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_5D[] = {
 		/*0*/ entry_2(0x5D, ops::MINPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x5D, ops::MINPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x5D, ops::MINSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x5D, ops::MINSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_5E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_5E[] = {
 		/*0*/ entry_2(0x5E, ops::DIVPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x5E, ops::DIVPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x5E, ops::DIVSD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*3*/ entry_2(0x5E, ops::DIVSS, OpKind::RegXmm, OpKind::RegXmmMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_5F[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_5F[] = {
 		/*0*/ entry_2(0x5F, ops::MAXPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*1*/ entry_2(0x5F, ops::MAXPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x5F, ops::MAXSD, OpKind::RegXmm, OpKind::RegXmmMem64),
@@ -493,49 +493,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_60[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_60[] = {
 		/*0*/ entry_2(0x60, ops::PUNPCKLBW, OpKind::RegMmx, OpKind::RegMmxMem32),
 		/*1*/ entry_2(0x60, ops::PUNPCKLBW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_61[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_61[] = {
 		/*0*/ entry_2(0x61, ops::PUNPCKLWD, OpKind::RegMmx, OpKind::RegMmxMem32),
 		/*1*/ entry_2(0x61, ops::PUNPCKLWD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_62[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_62[] = {
 		/*0*/ entry_2(0x62, ops::PUNPCKLDQ, OpKind::RegMmx, OpKind::RegMmxMem32),
 		/*1*/ entry_2(0x62, ops::PUNPCKLDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_63[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_63[] = {
 		/*0*/ entry_2(0x63, ops::PACKSSWB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x63, ops::PACKSSWB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_64[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_64[] = {
 		/*0*/ entry_2(0x64, ops::PCMPGTB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x64, ops::PCMPGTB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_65[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_65[] = {
 		/*0*/ entry_2(0x65, ops::PCMPGTW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x65, ops::PCMPGTW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_66[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_66[] = {
 		/*0*/ entry_2(0x66, ops::PCMPGTD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x66, ops::PCMPGTD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_67[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_67[] = {
 		/*0*/ entry_2(0x67, ops::PACKUSWB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x67, ops::PACKUSWB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
@@ -543,49 +543,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_68[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_68[] = {
 		/*0*/ entry_2(0x68, ops::PUNPCKHBW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x68, ops::PUNPCKHBW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_69[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_69[] = {
 		/*0*/ entry_2(0x69, ops::PUNPCKHWD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x69, ops::PUNPCKHWD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_6A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_6A[] = {
 		/*0*/ entry_2(0x6A, ops::PUNPCKHDQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x6A, ops::PUNPCKHDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_6B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_6B[] = {
 		/*0*/ entry_2(0x6B, ops::PACKSSDW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x6B, ops::PACKSSDW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_6C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_6C[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x6C, ops::PUNPCKLQDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_6D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_6D[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x6D, ops::PUNPCKHQDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_6E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_6E[] = {
 		/*0*/ entry_2(0x6E, ops::MOVD, OpKind::RegMmx, OpKind::RegMem32),   // this will auto-promote to RegMem64 based on REX.W
 		/*1*/ entry_2(0x6E, ops::MOVD, OpKind::RegXmm, OpKind::RegMem32),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_6F[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_6F[] = {
 		/*0*/ entry_2(0x6F, ops::MOVQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x6F, ops::MOVDQA, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
@@ -593,49 +593,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_70[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_70[] = {
 		/*0*/ entry_3(0x70, ops::PSHUFW, OpKind::RegMmx, OpKind::RegMmxMem64, OpKind::Imm8),
 		/*1*/ entry_3(0x70, ops::PSHUFD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_3(0x70, ops::PSHUFLW, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*3*/ entry_3(0x70, ops::PSHUFHW, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 	};
-	constexpr TableEntry PrefixExt_0F_71[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_71[] = {
 		/*0*/ entry_ext(0x71, &ModRMExt_0F_PrefixNone_71[0]),
 		/*1*/ entry_ext(0x71, &ModRMExt_0F_Prefix66_71[0]),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_72[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_72[] = {
 		/*0*/ entry_ext(0x72, &ModRMExt_0F_PrefixNone_72[0]),
 		/*1*/ entry_ext(0x72, &ModRMExt_0F_Prefix66_72[0]),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_73[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_73[] = {
 		/*0*/ entry_ext(0x73, &ModRMExt_0F_PrefixNone_73[0]),
 		/*1*/ entry_ext(0x73, &ModRMExt_0F_Prefix66_73[0]),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_74[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_74[] = {
 		/*0*/ entry_2(0x74, ops::PCMPEQB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x74, ops::PCMPEQB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_75[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_75[] = {
 		/*0*/ entry_2(0x75, ops::PCMPEQW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x75, ops::PCMPEQW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_76[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_76[] = {
 		/*0*/ entry_2(0x76, ops::PCMPEQD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x76, ops::PCMPEQD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_77[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_77[] = {
 		/*0*/ entry_0(0x77, ops::EMMS),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
@@ -643,49 +643,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_78[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_78[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_ext(0x78, &ModRMExt_0F_Prefix66_78[0]),
 		/*2*/ entry_4(0x78, ops::INSERTQ, OpKind::RegXmm, OpKind::RegXmm_Rm, OpKind::Imm8, OpKind::Imm8),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_79[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_79[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x79, ops::EXTRQ, OpKind::RegXmm, OpKind::RegXmm_Rm),
 		/*2*/ entry_2(0x79, ops::INSERTQ, OpKind::RegXmm, OpKind::RegXmm_Rm),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_7A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_7A[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_7B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_7B[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_7C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_7C[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x7C, ops::HADDPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x7C, ops::HADDPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_7D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_7D[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x7D, ops::HSUBPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0x7D, ops::HSUBPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_7E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_7E[] = {
 		/*0*/ entry_2(0x7E, ops::MOVD, OpKind::RegMem32, OpKind::RegMmx),    // this will auto-promote to RegMem64 based on REX.W
 		/*1*/ entry_2(0x7E, ops::MOVD, OpKind::RegMem32, OpKind::RegXmm),
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0x7E, ops::MOVQ, OpKind::RegXmm, OpKind::RegXmmMem64),
 	};
-	constexpr TableEntry PrefixExt_0F_7F[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_7F[] = {
 		/*0*/ entry_2(0x7F, ops::MOVQ, OpKind::RegMmxMem64, OpKind::RegMmx),
 		/*1*/ entry_2(0x7F, ops::MOVDQA, OpKind::RegXmmMem128, OpKind::RegXmm),
 		/*2*/ entry_blank,
@@ -693,7 +693,7 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_AE[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_AE[] = {
 		/*0*/ entry_ext(0xAE, &ModRMExt_0F_AE_Prefix_None[0]),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
@@ -701,49 +701,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_B8[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_B8[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0xB8, ops::POPCNT, OpKind::Reg32, OpKind::RegMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_B9[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_B9[] = {
 		/*0*/ entry_ext(0xB9, &ModRMExt_0F_PrefixNone_B9[0]),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_BA[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_BA[] = {
 		/*0*/ entry_ext(0xBA, &ModRMExt_0F_PrefixNone_BA[0]),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_BB[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_BB[] = {
 		/*0*/ entry_2(0xBB, ops::BTC, OpKind::RegMem32, OpKind::Reg32),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_BC[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_BC[] = {
 		/*0*/ entry_2(0xBC, ops::BSF, OpKind::Reg32, OpKind::RegMem32),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0xBC, ops::TZCNT, OpKind::Reg32, OpKind::RegMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_BD[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_BD[] = {
 		/*0*/ entry_2(0xBD, ops::BSR, OpKind::Reg32, OpKind::RegMem32),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_2(0xBD, ops::LZCNT, OpKind::Reg32, OpKind::RegMem32),
 	};
-	constexpr TableEntry PrefixExt_0F_BE[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_BE[] = {
 		/*0*/ entry_2(0xBE, ops::MOVSX, OpKind::Reg32, OpKind::RegMem8),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_BF[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_BF[] = {
 		/*0*/ entry_2(0xBF, ops::MOVSX, OpKind::Reg32, OpKind::RegMem16),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
@@ -751,49 +751,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_C0[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C0[] = {
 		/*0*/ entry_2(0xC0, ops::XADD, OpKind::RegMem8, OpKind::Reg8),
 		/*1*/ entry_2(0xC0, ops::XADD, OpKind::RegMem8, OpKind::Reg8),
 		/*2*/ entry_2(0xC0, ops::XADD, OpKind::RegMem8, OpKind::Reg8),
 		/*3*/ entry_2(0xC0, ops::XADD, OpKind::RegMem8, OpKind::Reg8),
 	};
-	constexpr TableEntry PrefixExt_0F_C1[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C1[] = {
 		/*0*/ entry_2(0xC1, ops::XADD, OpKind::RegMem32, OpKind::Reg32),
 		/*1*/ entry_2(0xC1, ops::XADD, OpKind::RegMem32, OpKind::Reg32),
 		/*2*/ entry_2(0xC1, ops::XADD, OpKind::RegMem32, OpKind::Reg32),
 		/*3*/ entry_2(0xC1, ops::XADD, OpKind::RegMem32, OpKind::Reg32),
 	};
-	constexpr TableEntry PrefixExt_0F_C2[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C2[] = {
 		/*0*/ entry_3(0xC2, ops::CMPPS, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*1*/ entry_3(0xC2, ops::CMPPD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_3(0xC2, ops::CMPSD, OpKind::RegXmm, OpKind::RegXmmMem64, OpKind::Imm8),
 		/*3*/ entry_3(0xC2, ops::CMPSS, OpKind::RegXmm, OpKind::RegXmmMem32, OpKind::Imm8),
 	};
-	constexpr TableEntry PrefixExt_0F_C3[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C3[] = {
 		/*0*/ entry_2(0xC3, ops::MOVNTI, OpKind::Mem32, OpKind::Reg32),
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_C4[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C4[] = {
 		/*0*/ entry_3(0xC4, ops::PINSRW, OpKind::RegMmx, OpKind::Reg32Mem16, OpKind::Imm8),
 		/*1*/ entry_3(0xC4, ops::PINSRW, OpKind::RegXmm, OpKind::Reg32Mem16, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_C5[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C5[] = {
 		/*0*/ entry_3(0xC5, ops::PEXTRW, OpKind::Reg32, OpKind::RegMmx_Rm, OpKind::Imm8),
 		/*1*/ entry_3(0xC5, ops::PEXTRW, OpKind::Reg32, OpKind::RegXmm_Rm, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_C6[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C6[] = {
 		/*0*/ entry_3(0xC6, ops::SHUFPS, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*1*/ entry_3(0xC6, ops::SHUFPD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_C7[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_C7[] = {
 		/*0*/ entry_ext(0xC7, &ModRMExt_0F_PrefixAny_C7[0]),
 		/*1*/ entry_ext(0xC7, &ModRMExt_0F_PrefixAny_C7[0]),
 		/*2*/ entry_ext(0xC7, &ModRMExt_0F_PrefixAny_C7[0]),
@@ -801,49 +801,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_D0[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D0[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xD0, ops::ADDSUBPD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0xD0, ops::ADDSUBPS, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D1[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D1[] = {
 		/*0*/ entry_2(0xD1, ops::PSRLW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD1, ops::PSRLW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D2[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D2[] = {
 		/*0*/ entry_2(0xD2, ops::PSRLD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD2, ops::PSRLD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D3[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D3[] = {
 		/*0*/ entry_2(0xD3, ops::PSRLQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD3, ops::PSRLQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D4[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D4[] = {
 		/*0*/ entry_2(0xD4, ops::PADDQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD4, ops::PADDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D5[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D5[] = {
 		/*0*/ entry_2(0xD5, ops::PMULLW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD5, ops::PMULLW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D6[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D6[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xD6, ops::MOVQ, OpKind::RegXmmMem64, OpKind::RegXmm),
 		/*2*/ entry_2(0xD6, ops::MOVDQ2Q, OpKind::RegMmx, OpKind::RegXmm_Rm),
 		/*3*/ entry_2(0xD6, ops::MOVQ2DQ, OpKind::RegXmm, OpKind::RegMmx_Rm),
 	};
-	constexpr TableEntry PrefixExt_0F_D7[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D7[] = {
 		/*0*/ entry_2(0xD7, ops::PMOVMSKB, OpKind::Reg32, OpKind::RegMmx_Rm),
 		/*1*/ entry_2(0xD7, ops::PMOVMSKB, OpKind::Reg32, OpKind::RegXmm_Rm),
 		/*2*/ entry_blank,
@@ -851,49 +851,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_D8[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D8[] = {
 		/*0*/ entry_2(0xD8, ops::PSUBUSB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD8, ops::PSUBUSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_D9[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_D9[] = {
 		/*0*/ entry_2(0xD9, ops::PSUBUSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xD9, ops::PSUBUSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_DA[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_DA[] = {
 		/*0*/ entry_2(0xDA, ops::PMINUB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xDA, ops::PMINUB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_DB[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_DB[] = {
 		/*0*/ entry_2(0xDB, ops::PAND, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xDB, ops::PAND, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_DC[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_DC[] = {
 		/*0*/ entry_2(0xDC, ops::PADDUSB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xDC, ops::PADDUSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_DD[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_DD[] = {
 		/*0*/ entry_2(0xDD, ops::PADDUSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xDD, ops::PADDUSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_DE[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_DE[] = {
 		/*0*/ entry_2(0xDE, ops::PMAXUB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xDE, ops::PMAXUB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_DF[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_DF[] = {
 		/*0*/ entry_2(0xDF, ops::PANDN, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xDF, ops::PANDN, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
@@ -901,49 +901,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_E0[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E0[] = {
 		/*0*/ entry_2(0xE0, ops::PAVGB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE0, ops::PAVGB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E1[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E1[] = {
 		/*0*/ entry_2(0xE1, ops::PSRAW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE1, ops::PSRAW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E2[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E2[] = {
 		/*0*/ entry_2(0xE2, ops::PSRAD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE2, ops::PSRAD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E3[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E3[] = {
 		/*0*/ entry_2(0xE3, ops::PAVGW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE3, ops::PAVGW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E4[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E4[] = {
 		/*0*/ entry_2(0xE4, ops::PMULHUW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE4, ops::PMULHUW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E5[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E5[] = {
 		/*0*/ entry_2(0xE5, ops::PMULHW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE5, ops::PMULHW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E6[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E6[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xE6, ops::CVTTPD2DQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_2(0xE6, ops::CVTPD2DQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*3*/ entry_2(0xE6, ops::CVTDQ2PD, OpKind::RegXmm, OpKind::RegXmmMem64),
 	};
-	constexpr TableEntry PrefixExt_0F_E7[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E7[] = {
 		/*0*/ entry_2(0xE7, ops::MOVNTQ, OpKind::Mem64, OpKind::RegMmx),
 		/*1*/ entry_2(0xE7, ops::MOVNTDQ, OpKind::Mem128, OpKind::RegXmm),
 		/*2*/ entry_blank,
@@ -951,49 +951,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_E8[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E8[] = {
 		/*0*/ entry_2(0xE8, ops::PSUBSB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE8, ops::PSUBSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_E9[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_E9[] = {
 		/*0*/ entry_2(0xE9, ops::PSUBSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xE9, ops::PSUBSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_EA[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_EA[] = {
 		/*0*/ entry_2(0xEA, ops::PMINSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xEA, ops::PMINSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_EB[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_EB[] = {
 		/*0*/ entry_2(0xEB, ops::POR, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xEB, ops::POR, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_EC[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_EC[] = {
 		/*0*/ entry_2(0xEC, ops::PADDSB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xEC, ops::PADDSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_ED[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_ED[] = {
 		/*0*/ entry_2(0xED, ops::PADDSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xED, ops::PADDSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_EE[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_EE[] = {
 		/*0*/ entry_2(0xEE, ops::PMAXSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xEE, ops::PMAXSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_EF[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_EF[] = {
 		/*0*/ entry_2(0xEF, ops::PXOR, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xEF, ops::PXOR, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
@@ -1001,49 +1001,49 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_F0[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F0[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0xF2, ops::LDDQU, OpKind::RegXmm, OpKind::Mem128),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F1[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F1[] = {
 		/*0*/ entry_2(0xF1, ops::PSLLW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF1, ops::PSLLW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F2[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F2[] = {
 		/*0*/ entry_2(0xF2, ops::PSLLD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF2, ops::PSLLD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F3[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F3[] = {
 		/*0*/ entry_2(0xF3, ops::PSLLQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF3, ops::PSLLQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F4[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F4[] = {
 		/*0*/ entry_2(0xF4, ops::PMULUDQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF4, ops::PMULUDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F5[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F5[] = {
 		/*0*/ entry_2(0xF5, ops::PMADDWD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF5, ops::PMADDWD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F6[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F6[] = {
 		/*0*/ entry_2(0xF6, ops::PSADBW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF6, ops::PSADBW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F7[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F7[] = {
 		/*0*/ entry_2(0xF7, ops::MASKMOVQ, OpKind::RegMmx, OpKind::RegMmx_Rm),
 		/*1*/ entry_2(0xF7, ops::MASKMOVDQU, OpKind::RegXmm, OpKind::RegXmm_Rm),
 		/*2*/ entry_blank,
@@ -1051,56 +1051,56 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry PrefixExt_0F_F8[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F8[] = {
 		/*0*/ entry_2(0xF8, ops::PSUBB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF8, ops::PSUBB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_F9[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_F9[] = {
 		/*0*/ entry_2(0xF9, ops::PSUBW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xF9, ops::PSUBW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_FA[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_FA[] = {
 		/*0*/ entry_2(0xFA, ops::PSUBD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xFA, ops::PSUBD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_FB[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_FB[] = {
 		/*0*/ entry_2(0xFB, ops::PSUBQ, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xFB, ops::PSUBQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_FC[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_FC[] = {
 		/*0*/ entry_2(0xFC, ops::PADDB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xFC, ops::PADDB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_FD[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_FD[] = {
 		/*0*/ entry_2(0xFD, ops::PADDW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xFD, ops::PADDW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_FE[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_FE[] = {
 		/*0*/ entry_2(0xFE, ops::PADDD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0xFE, ops::PADDD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_FF[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_FF[] = {
 		/*0*/ entry_0(0xFF, ops::UD0),
 		/*1*/ entry_0(0xFF, ops::UD0),
 		/*2*/ entry_0(0xFF, ops::UD0),
 		/*3*/ entry_0(0xFF, ops::UD0),
 	};
 
-	constexpr TableEntry SecondaryOpcodeMap_0F[] = {
+	INSTRAD_TABLE TableEntry SecondaryOpcodeMap_0F[] = {
 		/*00*/ entry_ext(0x00, &ModRMExt_0F_00[0]),
 		/*01*/ entry_ext(0x01, &ModRMExt_0F_01[0]),
 		/*02*/ entry_2(0x02, ops::LAR, OpKind::Reg32, OpKind::RegMem16),
@@ -1391,326 +1391,326 @@ namespace instrad::x86::tables
 		/*FF*/ entry_0(0xFF, ops::UD0),
 	};
 
-	constexpr TableEntry PrefixExt_0F_38_00[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_00[] = {
 		/*0*/ entry_2(0x00, ops::PSHUFB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x00, ops::PSHUFB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_01[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_01[] = {
 		/*0*/ entry_2(0x01, ops::PHADDW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x01, ops::PHADDW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_02[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_02[] = {
 		/*0*/ entry_2(0x02, ops::PHADDD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x02, ops::PHADDD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_03[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_03[] = {
 		/*0*/ entry_2(0x03, ops::PHADDSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x03, ops::PHADDSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_04[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_04[] = {
 		/*0*/ entry_2(0x04, ops::PMADDUBSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x04, ops::PMADDUBSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_05[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_05[] = {
 		/*0*/ entry_2(0x05, ops::PHSUBW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x05, ops::PHSUBW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_06[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_06[] = {
 		/*0*/ entry_2(0x06, ops::PHSUBD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x06, ops::PHSUBD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_07[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_07[] = {
 		/*0*/ entry_2(0x07, ops::PHSUBSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x07, ops::PHSUBSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_08[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_08[] = {
 		/*0*/ entry_2(0x08, ops::PSIGNB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x08, ops::PSIGNB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_09[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_09[] = {
 		/*0*/ entry_2(0x09, ops::PSIGNW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x09, ops::PSIGNW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_0A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_0A[] = {
 		/*0*/ entry_2(0x0A, ops::PSIGND, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x0A, ops::PSIGND, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_0B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_0B[] = {
 		/*0*/ entry_2(0x0B, ops::PMULHRSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x0B, ops::PMULHRSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_10[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_10[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x10, ops::PBLENDVB, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::ImplicitXMM0),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_14[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_14[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x14, ops::BLENDVPS, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::ImplicitXMM0),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_15[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_15[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x15, ops::BLENDVPD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::ImplicitXMM0),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_17[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_17[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x17, ops::PTEST, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_1C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_1C[] = {
 		/*0*/ entry_2(0x1C, ops::PABSB, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x1C, ops::PABSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_1D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_1D[] = {
 		/*0*/ entry_2(0x1D, ops::PABSW, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x1D, ops::PABSW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_1E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_1E[] = {
 		/*0*/ entry_2(0x1E, ops::PABSD, OpKind::RegMmx, OpKind::RegMmxMem64),
 		/*1*/ entry_2(0x1E, ops::PABSD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_20[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_20[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x20, ops::PMOVSXBW, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_21[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_21[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x21, ops::PMOVSXBD, OpKind::RegXmm, OpKind::RegXmmMem32),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_22[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_22[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x22, ops::PMOVSXBQ, OpKind::RegXmm, OpKind::RegXmmMem16),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_23[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_23[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x23, ops::PMOVSXWD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_24[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_24[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x24, ops::PMOVSXWQ, OpKind::RegXmm, OpKind::RegXmmMem32),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_25[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_25[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x25, ops::PMOVSXDQ, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_28[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_28[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x28, ops::PMULDQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_29[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_29[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x29, ops::PCMPEQQ, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_2A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_2A[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x2A, ops::MOVNTDQA, OpKind::RegXmm, OpKind::Mem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_2B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_2B[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x2B, ops::PACKUSDW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_30[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_30[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x30, ops::PMOVZXBW, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_31[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_31[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x31, ops::PMOVZXBD, OpKind::RegXmm, OpKind::RegXmmMem32),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_32[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_32[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x32, ops::PMOVZXBQ, OpKind::RegXmm, OpKind::RegXmmMem16),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_33[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_33[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x33, ops::PMOVZXWD, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_34[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_34[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x34, ops::PMOVZXWQ, OpKind::RegXmm, OpKind::RegXmmMem32),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_35[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_35[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x35, ops::PMOVZXDQ, OpKind::RegXmm, OpKind::RegXmmMem64),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_37[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_37[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x37, ops::PCMPGTQ,  OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_38[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_38[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x38, ops::PMINSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_39[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_39[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x39, ops::PMINSD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_3A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_3A[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x3A, ops::PMINUW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_3B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_3B[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x3B, ops::PMINUD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_3C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_3C[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x3C, ops::PMAXSB, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_3D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_3D[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x3D, ops::PMAXSD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_3E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_3E[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x3E, ops::PMAXUW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_3F[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_3F[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x3F, ops::PMAXUD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_40[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_40[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x40, ops::PMULLD, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_41[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_41[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0x41, ops::PHMINPOSUW, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_DB[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_DB[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xDB, ops::AESIMC, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_DC[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_DC[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xDC, ops::AESENC, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_DD[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_DD[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xDD, ops::AESENCLAST, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_DE[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_DE[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xDE, ops::AESDEC, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_DF[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_DF[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_2(0xDF, ops::AESDECLAST, OpKind::RegXmm, OpKind::RegXmmMem128),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_F0[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_F0[] = {
 		/*0*/ entry_2(0xF0, ops::MOVBE, OpKind::Reg32, OpKind::Mem32),
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0xF0, ops::CRC32, OpKind::Reg32, OpKind::RegMem8),
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_38_F1[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_38_F1[] = {
 		/*0*/ entry_2(0xF1, ops::MOVBE, OpKind::Mem32, OpKind::Reg32),
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0xF1, ops::CRC32, OpKind::Reg32, OpKind::RegMem32),
 		/*3*/ entry_blank,
 	};
 
-	constexpr TableEntry SecondaryOpcodeMap_0F_38[] = {
+	INSTRAD_TABLE TableEntry SecondaryOpcodeMap_0F_38[] = {
 		/*00*/ entry_ext_prefix(0x00, &PrefixExt_0F_38_00[0]),
 		/*01*/ entry_ext_prefix(0x01, &PrefixExt_0F_38_01[0]),
 		/*02*/ entry_ext_prefix(0x02, &PrefixExt_0F_38_02[0]),
@@ -1985,156 +1985,156 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_0F_3A_Prefix66_22_RexW[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_0F_3A_Prefix66_22_RexW[] = {
 		/*0*/ entry_3(0x22, ops::PINSRD, OpKind::RegXmm, OpKind::RegMem32, OpKind::Imm8),   // rex.W == 0
 		/*1*/ entry_3(0x22, ops::PINSRQ, OpKind::RegXmm, OpKind::RegMem64, OpKind::Imm8)    // rex.W == 1
 	};
 
-	constexpr TableEntry PrefixExt_0F_3A_08[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_08[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x08, ops::ROUNDPS, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_09[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_09[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x09, ops::ROUNDPD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_0A[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_0A[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x0A, ops::ROUNDSS, OpKind::RegXmm, OpKind::RegXmmMem32, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_0B[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_0B[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x0B, ops::ROUNDSD, OpKind::RegXmm, OpKind::RegXmmMem64, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_0C[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_0C[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x0C, ops::BLENDPS, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_0D[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_0D[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x0D, ops::BLENDPD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_0E[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_0E[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x0E, ops::PBLENDW, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_0F[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_0F[] = {
 		/*0*/ entry_3(0x0F, ops::PALIGNR, OpKind::RegMmx, OpKind::RegMmxMem64, OpKind::Imm8),
 		/*1*/ entry_3(0x0F, ops::PALIGNR, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_14[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_14[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x14, ops::PEXTRB, OpKind::RegMem8, OpKind::RegXmm, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_15[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_15[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x15, ops::PEXTRW, OpKind::RegMem16, OpKind::RegXmm, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_16[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_16[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x16, ops::PEXTRD, OpKind::RegMem32, OpKind::RegXmm, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_17[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_17[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x17, ops::EXTRACTPS, OpKind::RegMem32, OpKind::RegXmm, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_20[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_20[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x20, ops::PINSRB, OpKind::RegXmm, OpKind::Reg32Mem8, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_21[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_21[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x21, ops::PINSRW, OpKind::RegXmm, OpKind::RegXmmMem32, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_22[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_22[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_ext_rexw(0x22, &ModRMExt_0F_3A_Prefix66_22_RexW[0]),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_40[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_40[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x40, ops::DPPS, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_41[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_41[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x41, ops::DPPD, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_42[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_42[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x42, ops::MPSADBW, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_44[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_44[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x44, ops::PCLMULQDQ, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_60[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_60[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x60, ops::PCMPESTRM, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_61[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_61[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x61, ops::PCMPESTRI, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_62[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_62[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x62, ops::PCMPISTRM, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_63[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_63[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0x63, ops::PCMPISTRI, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry PrefixExt_0F_3A_DF[] = {
+	INSTRAD_TABLE TableEntry PrefixExt_0F_3A_DF[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_3(0xDF, ops::AESKEYGENASSIST, OpKind::RegXmm, OpKind::RegXmmMem128, OpKind::Imm8),
 		/*2*/ entry_blank,
 		/*3*/ entry_blank,
 	};
-	constexpr TableEntry SecondaryOpcodeMap_0F_3A[] = {
+	INSTRAD_TABLE TableEntry SecondaryOpcodeMap_0F_3A[] = {
 		/*00*/ entry_blank,
 		/*01*/ entry_blank,
 		/*02*/ entry_blank,
@@ -0,0 +1,195 @@
+// vexentry.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include "entry.h"
+
+namespace instrad::x86
+{
+	// VEX is a special child.
+	// note: to keep things aligned, we use "mod0" and "mod3", even though the distinction
+	// is actually mod == 3 and mod != 3. oh well.
+
+	struct VexEntry
+	{
+	private:
+		using TE = TableEntry;
+		using VE = VexEntry;
+	public:
+		constexpr VexEntry() : m_opcode(0), m_present(false) { }
+		constexpr explicit VexEntry(uint8_t opcode) : m_opcode(opcode), m_present(true) { }
+		constexpr VexEntry(uint8_t opcode, const VexEntry* ext) : m_opcode(opcode), m_present(false), m_extension(ext) { }
+
+		constexpr uint8_t opcode() const { return this->m_opcode; }
+		constexpr bool present() const { return this->m_present; }
+
+		constexpr VE& pNN_W0_L0_mod3(TE e)  { this->entries[0x00] = e; return *this; }
+		constexpr VE& pNN_W0_L1_mod3(TE e)  { this->entries[0x01] = e; return *this; }
+		constexpr VE& pNN_W1_L0_mod3(TE e)  { this->entries[0x02] = e; return *this; }
+		constexpr VE& pNN_W1_L1_mod3(TE e)  { this->entries[0x03] = e; return *this; }
+		constexpr VE& p66_W0_L0_mod3(TE e)  { this->entries[0x04] = e; return *this; }
+		constexpr VE& p66_W0_L1_mod3(TE e)  { this->entries[0x05] = e; return *this; }
+		constexpr VE& p66_W1_L0_mod3(TE e)  { this->entries[0x06] = e; return *this; }
+		constexpr VE& p66_W1_L1_mod3(TE e)  { this->entries[0x07] = e; return *this; }
+		constexpr VE& pF2_W0_L0_mod3(TE e)  { this->entries[0x08] = e; return *this; }
+		constexpr VE& pF2_W0_L1_mod3(TE e)  { this->entries[0x09] = e; return *this; }
+		constexpr VE& pF2_W1_L0_mod3(TE e)  { this->entries[0x0A] = e; return *this; }
+		constexpr VE& pF2_W1_L1_mod3(TE e)  { this->entries[0x0B] = e; return *this; }
+		constexpr VE& pF3_W0_L0_mod3(TE e)  { this->entries[0x0C] = e; return *this; }
+		constexpr VE& pF3_W0_L1_mod3(TE e)  { this->entries[0x0D] = e; return *this; }
+		constexpr VE& pF3_W1_L0_mod3(TE e)  { this->entries[0x0E] = e; return *this; }
+		constexpr VE& pF3_W1_L1_mod3(TE e)  { this->entries[0x0F] = e; return *this; }
+		constexpr VE& pNN_W0_L0_mod0(TE e)  { this->entries[0x10] = e; return *this; }
+		constexpr VE& pNN_W0_L1_mod0(TE e)  { this->entries[0x11] = e; return *this; }
+		constexpr VE& pNN_W1_L0_mod0(TE e)  { this->entries[0x12] = e; return *this; }
+		constexpr VE& pNN_W1_L1_mod0(TE e)  { this->entries[0x13] = e; return *this; }
+		constexpr VE& p66_W0_L0_mod0(TE e)  { this->entries[0x14] = e; return *this; }
+		constexpr VE& p66_W0_L1_mod0(TE e)  { this->entries[0x15] = e; return *this; }
+		constexpr VE& p66_W1_L0_mod0(TE e)  { this->entries[0x16] = e; return *this; }
+		constexpr VE& p66_W1_L1_mod0(TE e)  { this->entries[0x17] = e; return *this; }
+		constexpr VE& pF2_W0_L0_mod0(TE e)  { this->entries[0x18] = e; return *this; }
+		constexpr VE& pF2_W0_L1_mod0(TE e)  { this->entries[0x19] = e; return *this; }
+		constexpr VE& pF2_W1_L0_mod0(TE e)  { this->entries[0x1A] = e; return *this; }
+		constexpr VE& pF2_W1_L1_mod0(TE e)  { this->entries[0x1B] = e; return *this; }
+		constexpr VE& pF3_W0_L0_mod0(TE e)  { this->entries[0x1C] = e; return *this; }
+		constexpr VE& pF3_W0_L1_mod0(TE e)  { this->entries[0x1D] = e; return *this; }
+		constexpr VE& pF3_W1_L0_mod0(TE e)  { this->entries[0x1E] = e; return *this; }
+		constexpr VE& pF3_W1_L1_mod0(TE e)  { this->entries[0x1F] = e; return *this; }
+
+		// now, some convenience functions
+		constexpr VE& pNN_L0_mod3(TE e)     { return pNN_W0_L0_mod3(e).pNN_W1_L0_mod3(e); }
+		constexpr VE& pNN_L1_mod3(TE e)     { return pNN_W0_L1_mod3(e).pNN_W1_L1_mod3(e); }
+		constexpr VE& pNN_W0_mod3(TE e)     { return pNN_W0_L0_mod3(e).pNN_W0_L1_mod3(e); }
+		constexpr VE& pNN_W1_mod3(TE e)     { return pNN_W1_L0_mod3(e).pNN_W1_L1_mod3(e); }
+		constexpr VE& p66_L0_mod3(TE e)     { return p66_W0_L0_mod3(e).p66_W1_L0_mod3(e); }
+		constexpr VE& p66_L1_mod3(TE e)     { return p66_W0_L1_mod3(e).p66_W1_L1_mod3(e); }
+		constexpr VE& p66_W0_mod3(TE e)     { return p66_W0_L0_mod3(e).p66_W0_L1_mod3(e); }
+		constexpr VE& p66_W1_mod3(TE e)     { return p66_W1_L0_mod3(e).p66_W1_L1_mod3(e); }
+		constexpr VE& pF2_L0_mod3(TE e)     { return pF2_W0_L0_mod3(e).pF2_W1_L0_mod3(e); }
+		constexpr VE& pF2_L1_mod3(TE e)     { return pF2_W0_L1_mod3(e).pF2_W1_L1_mod3(e); }
+		constexpr VE& pF2_W0_mod3(TE e)     { return pF2_W0_L0_mod3(e).pF2_W0_L1_mod3(e); }
+		constexpr VE& pF2_W1_mod3(TE e)     { return pF2_W1_L0_mod3(e).pF2_W1_L1_mod3(e); }
+		constexpr VE& pF3_L0_mod3(TE e)     { return pF3_W0_L0_mod3(e).pF3_W1_L0_mod3(e); }
+		constexpr VE& pF3_L1_mod3(TE e)     { return pF3_W0_L1_mod3(e).pF3_W1_L1_mod3(e); }
+		constexpr VE& pF3_W0_mod3(TE e)     { return pF3_W0_L0_mod3(e).pF3_W0_L1_mod3(e); }
+		constexpr VE& pF3_W1_mod3(TE e)     { return pF3_W1_L0_mod3(e).pF3_W1_L1_mod3(e); }
+		constexpr VE& pNN_L0_mod0(TE e)     { return pNN_W0_L0_mod0(e).pNN_W1_L0_mod0(e); }
+		constexpr VE& pNN_L1_mod0(TE e)     { return pNN_W0_L1_mod0(e).pNN_W1_L1_mod0(e); }
+		constexpr VE& pNN_W0_mod0(TE e)     { return pNN_W0_L0_mod0(e).pNN_W0_L1_mod0(e); }
+		constexpr VE& pNN_W1_mod0(TE e)     { return pNN_W1_L0_mod0(e).pNN_W1_L1_mod0(e); }
+		constexpr VE& p66_L0_mod0(TE e)     { return p66_W0_L0_mod0(e).p66_W1_L0_mod0(e); }
+		constexpr VE& p66_L1_mod0(TE e)     { return p66_W0_L1_mod0(e).p66_W1_L1_mod0(e); }
+		constexpr VE& p66_W0_mod0(TE e)     { return p66_W0_L0_mod0(e).p66_W0_L1_mod0(e); }
+		constexpr VE& p66_W1_mod0(TE e)     { return p66_W1_L0_mod0(e).p66_W1_L1_mod0(e); }
+		constexpr VE& pF2_L0_mod0(TE e)     { return pF2_W0_L0_mod0(e).pF2_W1_L0_mod0(e); }
+		constexpr VE& pF2_L1_mod0(TE e)     { return pF2_W0_L1_mod0(e).pF2_W1_L1_mod0(e); }
+		constexpr VE& pF2_W0_mod0(TE e)     { return pF2_W0_L0_mod0(e).pF2_W0_L1_mod0(e); }
+		constexpr VE& pF2_W1_mod0(TE e)     { return pF2_W1_L0_mod0(e).pF2_W1_L1_mod0(e); }
+		constexpr VE& pF3_L0_mod0(TE e)     { return pF3_W0_L0_mod0(e).pF3_W1_L0_mod0(e); }
+		constexpr VE& pF3_L1_mod0(TE e)     { return pF3_W0_L1_mod0(e).pF3_W1_L1_mod0(e); }
+		constexpr VE& pF3_W0_mod0(TE e)     { return pF3_W0_L0_mod0(e).pF3_W0_L1_mod0(e); }
+		constexpr VE& pF3_W1_mod0(TE e)     { return pF3_W1_L0_mod0(e).pF3_W1_L1_mod0(e); }
+
+		constexpr VE& pNN_W0_L0(TE e)       { return pNN_W0_L0_mod3(e).pNN_W0_L0_mod0(e); }
+		constexpr VE& pNN_W0_L1(TE e)       { return pNN_W0_L1_mod3(e).pNN_W0_L1_mod0(e); }
+		constexpr VE& pNN_W1_L0(TE e)       { return pNN_W1_L0_mod3(e).pNN_W1_L0_mod0(e); }
+		constexpr VE& pNN_W1_L1(TE e)       { return pNN_W1_L1_mod3(e).pNN_W1_L1_mod0(e); }
+		constexpr VE& p66_W0_L0(TE e)       { return p66_W0_L0_mod3(e).p66_W0_L0_mod0(e); }
+		constexpr VE& p66_W0_L1(TE e)       { return p66_W0_L1_mod3(e).p66_W0_L1_mod0(e); }
+		constexpr VE& p66_W1_L0(TE e)       { return p66_W1_L0_mod3(e).p66_W1_L0_mod0(e); }
+		constexpr VE& p66_W1_L1(TE e)       { return p66_W1_L1_mod3(e).p66_W1_L1_mod0(e); }
+		constexpr VE& pF2_W0_L0(TE e)       { return pF2_W0_L0_mod3(e).pF2_W0_L0_mod0(e); }
+		constexpr VE& pF2_W0_L1(TE e)       { return pF2_W0_L1_mod3(e).pF2_W0_L1_mod0(e); }
+		constexpr VE& pF2_W1_L0(TE e)       { return pF2_W1_L0_mod3(e).pF2_W1_L0_mod0(e); }
+		constexpr VE& pF2_W1_L1(TE e)       { return pF2_W1_L1_mod3(e).pF2_W1_L1_mod0(e); }
+		constexpr VE& pF3_W0_L0(TE e)       { return pF3_W0_L0_mod3(e).pF3_W0_L0_mod0(e); }
+		constexpr VE& pF3_W0_L1(TE e)       { return pF3_W0_L1_mod3(e).pF3_W0_L1_mod0(e); }
+		constexpr VE& pF3_W1_L0(TE e)       { return pF3_W1_L0_mod3(e).pF3_W1_L0_mod0(e); }
+		constexpr VE& pF3_W1_L1(TE e)       { return pF3_W1_L1_mod3(e).pF3_W1_L1_mod0(e); }
+
+		constexpr VE& pNN_L0(TE e)          { return pNN_L0_mod3(e).pNN_L0_mod0(e); }
+		constexpr VE& pNN_L1(TE e)          { return pNN_L1_mod3(e).pNN_L1_mod0(e); }
+		constexpr VE& pNN_W0(TE e)          { return pNN_W0_mod3(e).pNN_W0_mod0(e); }
+		constexpr VE& pNN_W1(TE e)          { return pNN_W1_mod3(e).pNN_W1_mod0(e); }
+		constexpr VE& p66_L0(TE e)          { return p66_L0_mod3(e).p66_L0_mod0(e); }
+		constexpr VE& p66_L1(TE e)          { return p66_L1_mod3(e).p66_L1_mod0(e); }
+		constexpr VE& p66_W0(TE e)          { return p66_W0_mod3(e).p66_W0_mod0(e); }
+		constexpr VE& p66_W1(TE e)          { return p66_W1_mod3(e).p66_W1_mod0(e); }
+		constexpr VE& pF2_L0(TE e)          { return pF2_L0_mod3(e).pF2_L0_mod0(e); }
+		constexpr VE& pF2_L1(TE e)          { return pF2_L1_mod3(e).pF2_L1_mod0(e); }
+		constexpr VE& pF2_W0(TE e)          { return pF2_W0_mod3(e).pF2_W0_mod0(e); }
+		constexpr VE& pF2_W1(TE e)          { return pF2_W1_mod3(e).pF2_W1_mod0(e); }
+		constexpr VE& pF3_L0(TE e)          { return pF3_L0_mod3(e).pF3_L0_mod0(e); }
+		constexpr VE& pF3_L1(TE e)          { return pF3_L1_mod3(e).pF3_L1_mod0(e); }
+		constexpr VE& pF3_W0(TE e)          { return pF3_W0_mod3(e).pF3_W0_mod0(e); }
+		constexpr VE& pF3_W1(TE e)          { return pF3_W1_mod3(e).pF3_W1_mod0(e); }
+
+		constexpr VE& pNN_mod3(TE e)        { return pNN_W0_L0_mod3(e).pNN_W0_L1_mod3(e).pNN_W1_L0_mod3(e).pNN_W1_L1_mod3(e); }
+		constexpr VE& p66_mod3(TE e)        { return p66_W0_L0_mod3(e).p66_W0_L1_mod3(e).p66_W1_L0_mod3(e).p66_W1_L1_mod3(e); }
+		constexpr VE& pF2_mod3(TE e)        { return pF2_W0_L0_mod3(e).pF2_W0_L1_mod3(e).pF2_W1_L0_mod3(e).pF2_W1_L1_mod3(e); }
+		constexpr VE& pF3_mod3(TE e)        { return pF3_W0_L0_mod3(e).pF3_W0_L1_mod3(e).pF3_W1_L0_mod3(e).pF3_W1_L1_mod3(e); }
+		constexpr VE& pNN_mod0(TE e)        { return pNN_W0_L0_mod0(e).pNN_W0_L1_mod0(e).pNN_W1_L0_mod0(e).pNN_W1_L1_mod0(e); }
+		constexpr VE& p66_mod0(TE e)        { return p66_W0_L0_mod0(e).p66_W0_L1_mod0(e).p66_W1_L0_mod0(e).p66_W1_L1_mod0(e); }
+		constexpr VE& pF2_mod0(TE e)        { return pF2_W0_L0_mod0(e).pF2_W0_L1_mod0(e).pF2_W1_L0_mod0(e).pF2_W1_L1_mod0(e); }
+		constexpr VE& pF3_mod0(TE e)        { return pF3_W0_L0_mod0(e).pF3_W0_L1_mod0(e).pF3_W1_L0_mod0(e).pF3_W1_L1_mod0(e); }
+		constexpr VE& pNN(TE e)             { return pNN_mod3(e).pNN_mod0(e); }
+		constexpr VE& p66(TE e)             { return p66_mod3(e).p66_mod0(e); }
+		constexpr VE& pF2(TE e)             { return pF2_mod3(e).pF2_mod0(e); }
+		constexpr VE& pF3(TE e)             { return pF3_mod3(e).pF3_mod0(e); }
+
+		constexpr const VexEntry* extension() const { return this->m_extension; }
+		constexpr VE& noModRM() { this->m_needsModRM = false; return *this; }
+
+		constexpr bool needsModRM() const { return this->m_needsModRM; }
+
+	private:
+		uint8_t m_opcode;
+		bool m_present;
+
+		bool m_needsModRM = true;
+		const VexEntry* m_extension = nullptr;
+
+		// keep an internal table of 32 values. see the methods for the indices.
+		TableEntry entries[32] = { };
+
+		friend struct VexEntryDecoder;
+	};
+
+	struct VexEntryDecoder
+	{
+		constexpr VexEntryDecoder(const VexEntry& ent) : m_ent(ent) { }
+
+		constexpr VexEntryDecoder& setMod3()    { this->m_mod3 = true; return *this; }
+		constexpr VexEntryDecoder& setModNot3() { this->m_mod3 = false; return *this; }
+		constexpr VexEntryDecoder& setVexW()    { this->m_W = true; return *this; }
+		constexpr VexEntryDecoder& setVexL()    { this->m_L = true; return *this; }
+		constexpr VexEntryDecoder& setPref66()  { this->m_66 = true; return *this; }
+		constexpr VexEntryDecoder& setPrefF2()  { this->m_F2 = true; return *this; }
+		constexpr VexEntryDecoder& setPrefF3()  { this->m_F3 = true; return *this; }
+
+		constexpr TableEntry get()
+		{
+			size_t idx = 0;
+			if(!m_mod3) idx |= 0x10;
+			if(m_66)    idx |= 0x04;
+			if(m_F2)    idx |= 0x08;
+			if(m_F3)    idx |= 0x0C;
+			if(m_W)     idx |= 0x02;
+			if(m_L)     idx |= 0x01;
+
+			return m_ent.entries[idx];
+		}
+
+	private:
+		bool m_mod3 = false;
+		bool m_W = false;
+		bool m_L = false;
+		bool m_66 = false;
+		bool m_F2 = false;
+		bool m_F3 = false;
+
+		const VexEntry& m_ent;
+	};
+}
@@ -11,7 +11,7 @@ namespace instrad::x86::tables
 	// ok, so this is quite messy. the x87 instruction set will need 2-level extension tables
 	// for most opcodes; from the AMD manuals, the row hinges on modRM.reg, and the column
 	// hinges on modRM.rm
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg0_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FADD, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FADD, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -24,7 +24,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FADD, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FMUL, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FMUL, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -37,7 +37,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FMUL, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FCOM, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FCOM, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -50,7 +50,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FCOM, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FCOMP, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FCOMP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -63,7 +63,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FCOMP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg4_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FSUB, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FSUB, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -76,7 +76,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FSUB, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg5_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FSUBR, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FSUBR, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -89,7 +89,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FSUBR, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg6_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FDIV, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FDIV, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -102,7 +102,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FDIV, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8_Mod3_Reg7_RM[] = {
 		/*0*/ entry_2(0xD8, ops::FDIVR, OpKind::ImplicitST0, OpKind::Mem32), // modRM.mod != 3
 
 		/*1*/ entry_2(0xD8, ops::FDIVR, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -115,7 +115,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD8, ops::FDIVR, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D8[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D8[] = {
 		/*0*/ entry_ext_rm(0xD8, &ModRMExt_x87_D8_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xD8, &ModRMExt_x87_D8_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xD8, &ModRMExt_x87_D8_Mod3_Reg2_RM[0]),
@@ -135,7 +135,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg0_RM[] = {
 		/*0*/ entry_1(0xD9, ops::FLD, OpKind::Mem32),
 
 		/*1*/ entry_1(0xD9, ops::FLD, OpKind::RegX87_Rm),
@@ -148,7 +148,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_1(0xD9, ops::FLD, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg1_RM[] = {
 		/*0*/ entry_blank,
 
 		/*1*/ entry_2(0xD9, ops::FXCH, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -161,7 +161,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xD9, ops::FXCH, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xD9, ops::FST, OpKind::Mem32, OpKind::ImplicitST0),
 
 		/*1*/ entry_0(0xD9, ops::FNOP),
@@ -175,7 +175,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xD9, ops::FSTP, OpKind::Mem32, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -188,7 +188,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg4_RM[] = {
 		/*0*/ entry_1(0xD9, ops::FLDENV, OpKind::Memory),
 
 		/*1*/ entry_1(0xD9, ops::FCHS, OpKind::ImplicitST0),
@@ -202,7 +202,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg5_RM[] = {
 		/*0*/ entry_1(0xD9, ops::FLDCW, OpKind::Memory),
 
 		/*1*/ entry_0(0xD9, ops::FLD1),
@@ -216,7 +216,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg6_RM[] = {
 		/*0*/ entry_1(0xD9, ops::FNSTENV, OpKind::Memory),
 
 		/*1*/ entry_1(0xD9, ops::F2XM1, OpKind::ImplicitST0),
@@ -229,7 +229,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_0(0xD9, ops::FINCSTP),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9_Mod3_Reg7_RM[] = {
 		/*0*/ entry_1(0xD9, ops::FNSTCW, OpKind::Memory),
 
 		/*1*/ entry_2(0xD9, ops::FPREM, OpKind::ImplicitST0, OpKind::ImplicitST1),
@@ -242,7 +242,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_1(0xD9, ops::FCOS, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_D9[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_D9[] = {
 		/*0*/ entry_ext_rm(0xD9, &ModRMExt_x87_D9_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xD9, &ModRMExt_x87_D9_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xD9, &ModRMExt_x87_D9_Mod3_Reg2_RM[0]),
@@ -255,7 +255,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg0_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FIADD, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_2(0xDA, ops::FCMOVB, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -268,7 +268,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDA, ops::FCMOVB, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FIMUL, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_2(0xDA, ops::FCMOVE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -281,7 +281,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDA, ops::FCMOVE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FICOM, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_2(0xDA, ops::FCMOVBE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -294,7 +294,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDA, ops::FCMOVBE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FICOMP, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_2(0xDA, ops::FCMOVU, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -307,7 +307,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDA, ops::FCMOVU, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg4_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FISUB, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_blank,
@@ -320,7 +320,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg5_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FISUBR, OpKind::ImplicitST0, OpKind::Mem32),
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0xDA, ops::FUCOMPP, OpKind::ImplicitST0, OpKind::ImplicitST1),
@@ -333,7 +333,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg6_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FIDIV, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_blank,
@@ -346,7 +346,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DA_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA_Mod3_Reg7_RM[] = {
 		/*0*/ entry_2(0xDA, ops::FIDIVR, OpKind::ImplicitST0, OpKind::Mem32),
 
 		/*1*/ entry_blank,
@@ -360,7 +360,7 @@ namespace instrad::x86::tables
 	};
 
 
-	constexpr TableEntry ModRMExt_x87_DA[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DA[] = {
 		/*0*/ entry_ext_rm(0xDA, &ModRMExt_x87_DA_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xDA, &ModRMExt_x87_DA_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xDA, &ModRMExt_x87_DA_Mod3_Reg2_RM[0]),
@@ -373,7 +373,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg0_RM[] = {
 		/*0*/ entry_1(0xDB, ops::FILD, OpKind::Mem32),
 
 		/*1*/ entry_2(0xDB, ops::FCMOVNB, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -386,7 +386,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDB, ops::FCMOVNB, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xDB, ops::FISTTP, OpKind::Mem32, OpKind::ImplicitST0),
 
 		/*1*/ entry_2(0xDB, ops::FCMOVNE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -399,7 +399,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDB, ops::FCMOVNE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xDB, ops::FIST, OpKind::Mem32, OpKind::ImplicitST0),
 
 		/*1*/ entry_2(0xDB, ops::FCMOVNBE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -412,7 +412,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDB, ops::FCMOVNBE, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xDB, ops::FISTP, OpKind::Mem32, OpKind::ImplicitST0),
 
 		/*1*/ entry_2(0xDB, ops::FCMOVNU, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -425,7 +425,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDB, ops::FCMOVNU, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg4_RM[] = {
 		/*0*/ entry_blank,
 		/*1*/ entry_blank,
 		/*2*/ entry_blank,
@@ -439,7 +439,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg5_RM[] = {
 		/*0*/ entry_1(0xDB, ops::FLD, OpKind::Mem80),
 
 		/*1*/ entry_2(0xDB, ops::FUCOMI, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -452,7 +452,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDB, ops::FUCOMI, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg6_RM[] = {
 		/*0*/ entry_blank,
 
 		/*1*/ entry_2(0xDB, ops::FCOMI, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -465,7 +465,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDB, ops::FCOMI, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB_Mod3_Reg7_RM[] = {
 		/*0*/ entry_2(0xDB, ops::FSTP, OpKind::Mem80, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -478,7 +478,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DB[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DB[] = {
 		/*0*/ entry_ext_rm(0xDB, &ModRMExt_x87_DB_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xDB, &ModRMExt_x87_DB_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xDB, &ModRMExt_x87_DB_Mod3_Reg2_RM[0]),
@@ -491,7 +491,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg0_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FADD, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDC, ops::FADD, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -504,7 +504,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDC, ops::FADD, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FMUL, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDC, ops::FMUL, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -517,7 +517,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDC, ops::FMUL, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FCOM, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_blank,
@@ -530,7 +530,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FCOMP, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_blank,
@@ -543,7 +543,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg4_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FSUB, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDC, ops::FSUBR, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -556,7 +556,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDC, ops::FSUBR, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg5_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FSUBR, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDC, ops::FSUB, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -569,7 +569,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDC, ops::FSUB, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg6_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FDIV, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDC, ops::FDIVR, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -582,7 +582,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDC, ops::FDIVR, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC_Mod3_Reg7_RM[] = {
 		/*0*/ entry_2(0xDC, ops::FDIVR, OpKind::ImplicitST0, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDC, ops::FDIV, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -595,7 +595,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDC, ops::FDIV, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DC[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DC[] = {
 		/*0*/ entry_ext_rm(0xDC, &ModRMExt_x87_DC_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xDC, &ModRMExt_x87_DC_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xDC, &ModRMExt_x87_DC_Mod3_Reg2_RM[0]),
@@ -608,7 +608,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg0_RM[] = {
 		/*0*/ entry_1(0xDD, ops::FLD, OpKind::Mem64),
 
 		/*1*/ entry_1(0xDD, ops::FFREE, OpKind::RegX87_Rm),
@@ -621,7 +621,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_1(0xDD, ops::FFREE, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xDD, ops::FISTTP, OpKind::Mem64, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -634,7 +634,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xDD, ops::FST, OpKind::Mem64, OpKind::ImplicitST0),
 
 		/*1*/ entry_2(0xDD, ops::FST, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -647,7 +647,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDD, ops::FST, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xDD, ops::FSTP, OpKind::Mem64, OpKind::ImplicitST0),
 
 		/*1*/ entry_2(0xDD, ops::FSTP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -660,7 +660,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDD, ops::FSTP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg4_RM[] = {
 		/*0*/ entry_1(0xDD, ops::FRSTOR, OpKind::Memory),
 
 		/*1*/ entry_2(0xDD, ops::FUCOM, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -673,7 +673,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDD, ops::FUCOM, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg5_RM[] = {
 		/*0*/ entry_blank,
 
 		/*1*/ entry_2(0xDD, ops::FUCOMP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -686,7 +686,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDD, ops::FUCOMP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg6_RM[] = {
 		/*0*/ entry_1(0xDD, ops::FNSAVE, OpKind::Memory),
 
 		/*1*/ entry_blank,
@@ -699,7 +699,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD_Mod3_Reg7_RM[] = {
 		/*0*/ entry_1(0xDD, ops::FNSTSW, OpKind::Memory),
 
 		/*1*/ entry_blank,
@@ -712,7 +712,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DD[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DD[] = {
 		/*0*/ entry_ext_rm(0xDD, &ModRMExt_x87_DD_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xDD, &ModRMExt_x87_DD_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xDD, &ModRMExt_x87_DD_Mod3_Reg2_RM[0]),
@@ -725,7 +725,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg0_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FIADD, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_2(0xDE, ops::FADDP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -738,7 +738,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDE, ops::FADDP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FIMUL, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_2(0xDE, ops::FMULP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -751,7 +751,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDE, ops::FMULP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FICOM, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_blank,
@@ -764,7 +764,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FICOMP, OpKind::ImplicitST0, OpKind::Mem16),
 		/*1*/ entry_blank,
 		/*2*/ entry_2(0xDE, ops::FCOMPP, OpKind::ImplicitST0, OpKind::ImplicitST1),
@@ -777,7 +777,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg4_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FISUB, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_2(0xDE, ops::FSUBRP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -790,7 +790,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDE, ops::FSUBRP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg5_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FISUBR, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_2(0xDE, ops::FSUBP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -803,7 +803,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDE, ops::FSUBP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg6_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FIDIV, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_2(0xDE, ops::FDIVRP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -816,7 +816,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDE, ops::FDIVRP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE_Mod3_Reg7_RM[] = {
 		/*0*/ entry_2(0xDE, ops::FIDIVR, OpKind::ImplicitST0, OpKind::Mem16),
 
 		/*1*/ entry_2(0xDE, ops::FDIVP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
@@ -829,7 +829,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDE, ops::FDIVP, OpKind::RegX87_Rm, OpKind::ImplicitST0),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DE[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DE[] = {
 		/*0*/ entry_ext_rm(0xDE, &ModRMExt_x87_DE_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xDE, &ModRMExt_x87_DE_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xDE, &ModRMExt_x87_DE_Mod3_Reg2_RM[0]),
@@ -842,7 +842,7 @@ namespace instrad::x86::tables
 
 
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg0_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg0_RM[] = {
 		/*0*/ entry_1(0xDF, ops::FILD, OpKind::Mem16),
 
 		/*1*/ entry_blank,
@@ -855,7 +855,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg1_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg1_RM[] = {
 		/*0*/ entry_2(0xDF, ops::FISTTP, OpKind::Mem16, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -868,7 +868,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg2_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg2_RM[] = {
 		/*0*/ entry_2(0xDF, ops::FIST, OpKind::Mem16, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -881,7 +881,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg3_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg3_RM[] = {
 		/*0*/ entry_2(0xDF, ops::FISTP, OpKind::Mem16, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -894,7 +894,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg4_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg4_RM[] = {
 		/*0*/ entry_1(0xDF, ops::FBLD, OpKind::Mem80),
 
 		/*1*/ entry_1(0xDF, ops::FNSTSW, OpKind::ImplicitAX),
@@ -908,7 +908,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg5_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg5_RM[] = {
 		/*0*/ entry_1(0xDF, ops::FILD, OpKind::Mem64),
 
 		/*1*/ entry_2(0xDF, ops::FUCOMIP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -921,7 +921,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDF, ops::FUCOMIP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg6_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg6_RM[] = {
 		/*0*/ entry_2(0xDF, ops::FBSTP, OpKind::Mem80, OpKind::ImplicitST0),
 
 		/*1*/ entry_2(0xDF, ops::FCOMIP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
@@ -934,7 +934,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_2(0xDF, ops::FCOMIP, OpKind::ImplicitST0, OpKind::RegX87_Rm),
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF_Mod3_Reg7_RM[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF_Mod3_Reg7_RM[] = {
 		/*0*/ entry_2(0xDF, ops::FISTP, OpKind::Mem64, OpKind::ImplicitST0),
 
 		/*1*/ entry_blank,
@@ -947,7 +947,7 @@ namespace instrad::x86::tables
 		/*8*/ entry_blank,
 	};
 
-	constexpr TableEntry ModRMExt_x87_DF[] = {
+	INSTRAD_TABLE TableEntry ModRMExt_x87_DF[] = {
 		/*0*/ entry_ext_rm(0xDF, &ModRMExt_x87_DF_Mod3_Reg0_RM[0]),
 		/*1*/ entry_ext_rm(0xDF, &ModRMExt_x87_DF_Mod3_Reg1_RM[0]),
 		/*2*/ entry_ext_rm(0xDF, &ModRMExt_x87_DF_Mod3_Reg2_RM[0]),
@@ -0,0 +1,169 @@
+// xrefs.h
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "descent.h"
+
+namespace instrad::x86
+{
+	enum class XrefKind : uint8_t
+	{
+		Call,       // direct call
+		Jump,       // direct jmp, jcc or loop
+		Read,       // memory operand with a known address (including `call [rip + x]` and friends)
+		Address,    // lea of a known address; the address escapes, but nothing is read yet
+	};
+
+	constexpr size_t NUM_XREF_KINDS = 4;
+
+	// the sources referencing one target; a view into the index, so don't keep it around for longer.
+	struct XrefRange
+	{
+		const uint64_t* first = nullptr;
+		const uint64_t* last = nullptr;
+
+		const uint64_t* begin() const { return this->first; }
+		const uint64_t* end() const { return this->last; }
+
+		size_t size() const { return this->last - this->first; }
+		bool empty() const { return this->first == this->last; }
+	};
+
+	// for each kind, two parallel arrays sorted by (target, source). a lookup is one binary search
+	// over a flat array of targets, and the sources for a target are contiguous.
+	struct XrefIndex
+	{
+		struct Table
+		{
+			std::vector<uint64_t> targets;
+			std::vector<uint64_t> sources;
+		};
+
+		Table tables[NUM_XREF_KINDS];
+
+		const Table& table(XrefKind kind) const { return this->tables[(size_t) kind]; }
+
+		XrefRange referencesTo(XrefKind kind, uint64_t target) const
+		{
+			auto& t = this->table(kind);
+			auto lo = std::lower_bound(t.targets.begin(), t.targets.end(), target);
+			auto hi = std::upper_bound(lo, t.targets.end(), target);
+
+			return XrefRange {
+				t.sources.data() + (lo - t.targets.begin()),
+				t.sources.data() + (hi - t.targets.begin())
+			};
+		}
+
+		size_t count(XrefKind kind) const { return this->table(kind).targets.size(); }
+	};
+
+	namespace xref
+	{
+		struct Ref
+		{
+			uint64_t target;
+			uint64_t source;
+
+			bool operator < (const Ref& other) const
+			{
+				return this->target < other.target || (this->target == other.target && this->source < other.source);
+			}
+		};
+
+		template <typename Fn>
+		void collect(const Instruction& instr, uint64_t ip, Fn&& add)
+		{
+			auto& op = instr.op();
+			if(hasRelativeTarget(instr))
+			{
+				add(isCall(op) ? XrefKind::Call : XrefKind::Jump, branchTarget(instr, ip));
+				return;
+			}
+
+			const Operand* operands[] = { &instr.dst(), &instr.src(), &instr.ext(), &instr.op4() };
+			for(int i = 0; i < instr.operandCount() && i < 4; i++)
+			{
+				if(operands[i]->isMemory() && hasStaticAddress(operands[i]->mem()))
+					add(op == ops::LEA ? XrefKind::Address : XrefKind::Read, effectiveAddress(instr, ip, operands[i]->mem()));
+			}
+		}
+	}
+
+	// builds the cross-reference index for every instruction found by a recursive descent. the
+	// instructions are split between `threads` workers (0 = one per core) by address; each worker
+	// keeps its own lists, which are then joined and sorted (one kind per thread).
+	inline XrefIndex buildXrefs(const Disassembly& dis, size_t threads = 0)
+	{
+		if(threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+
+		auto& words = dis.starts;
+		threads = std::max((size_t) 1, std::min(threads, words.size()));
+
+		auto lists = std::vector<std::vector<xref::Ref>>(threads * NUM_XREF_KINDS);
+		auto scan = [&](size_t t) {
+			auto chunk = (words.size() + threads - 1) / threads;
+			auto end = std::min(words.size(), (t + 1) * chunk);
+
+			for(size_t w = t * chunk; w < end; w++)
+			{
+				for(auto bits = words[w]; bits != 0; bits &= (bits - 1))
+				{
+					auto ip = dis.region.base() + (w * 64) + __builtin_ctzll(bits);
+					xref::collect(dis.region.decode(ip), ip, [&](XrefKind kind, uint64_t target) {
+						lists[t * NUM_XREF_KINDS + (size_t) kind].push_back(xref::Ref { target, ip });
+					});
+				}
+			}
+		};
+
+		auto ret = XrefIndex();
+		auto finish = [&](size_t k) {
+			auto all = std::vector<xref::Ref>();
+			for(size_t t = 0; t < threads; t++)
+				all.insert(all.end(), lists[t * NUM_XREF_KINDS + k].begin(), lists[t * NUM_XREF_KINDS + k].end());
+
+			std::sort(all.begin(), all.end());
+
+			auto& table = ret.tables[k];
+			table.targets.resize(all.size());
+			table.sources.resize(all.size());
+			for(size_t i = 0; i < all.size(); i++)
+			{
+				table.targets[i] = all[i].target;
+				table.sources[i] = all[i].source;
+			}
+		};
+
+		auto runAll = [](size_t n, auto&& fn) {
+			auto pool = std::vector<std::thread>();
+			for(size_t i = 1; i < n; i++)
+				pool.emplace_back(fn, i);
+
+			fn(0);
+			for(auto& t : pool)
+				t.join();
+		};
+
+		runAll(threads, scan);
+
+		if(threads == 1)
+		{
+			for(size_t k = 0; k < NUM_XREF_KINDS; k++)
+				finish(k);
+		}
+		else
+		{
+			runAll(NUM_XREF_KINDS, finish);
+		}
+
+		return ret;
+	}
+}
@@ -0,0 +1,9 @@
+// tables.cpp
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+// the one definition of every table, for TUs that are built with INSTRAD_EXTERN_TABLES (see x86/table.h).
+// this goes into build/libinstrad.a.
+
+#define INSTRAD_DEFINE_TABLES
+#include "x86/table.h"
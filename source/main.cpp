@@ -3,342 +3,1360 @@
 // Licensed under the Apache License Version 2.0.
 
 #include <stdio.h>
+#include <stdlib.h>
 
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+#include <memory>
 #include <vector>
 #include <string>
 #include <fstream>
 #include <algorithm>
 
-#include "zpr.h"
-#include "buffer.h"
-#include "x86/decode.h"
+#include "driver.h"
+#include "x86/cfg.h"
+#include "x86/descent.h"
+#include "x86/functions.h"
+#include "x86/xrefs.h"
+#include "x86/gadgets.h"
+#include "x86/pattern.h"
+#include "x86/estimate.h"
+#include "x86/isa.h"
+#include "x86/incremental.h"
+#include "x86/filler.h"
+#include "x86/stack.h"
+#include "x86/decodecache.h"
+#include "x86/bitmap.h"
+#include "x86/randomaccess.h"
+#include "x86/stats.h"
+#include "x86/similarity.h"
+#include "x86/bindiff.h"
+#include "x86/compiletime.h"
+
+#include "index.h"
+
+constexpr uint8_t test_bytes[] = {
+	0xC5, 0xFB, 0x10, 0x07, 0xC5, 0xFB, 0x10, 0xC1, 0xC5, 0xF8, 0xAE, 0x10, 0xC4, 0xE2, 0x79, 0x18, 0x00, 0xC4, 0xE2, 0x79, 0x18, 0xC0,
+
+	0x48, 0x8d, 0x46, 0x10, 0x48, 0x89, 0x06, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x39, 0xd8,
+	0x75, 0x86, 0x66, 0x0f, 0x6f, 0x4c, 0x24, 0x20, 0x0f, 0x11, 0x4e, 0x10, 0xeb, 0x86, 0x65, 0xf3, 0xa4,
+
+	0x49, 0x8b, 0x7c, 0x24, 0x30,
 
-static std::string print_intel(const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes, size_t len)
+	0x48, 0xa1, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa
+};
+
+// the decoder works at compile time too, so these get checked on every build (except with
+// INSTRAD_EXTERN_TABLES, where the tables are only declared).
+#if !defined(INSTRAD_EXTERN_TABLES)
+
+constexpr instrad::x86::Instruction test_fixed()
 {
-	auto print_operand = [&ip](const instrad::x86::Operand& op) -> std::string {
-		if(op.isRegister())
+	auto buf = instrad::Buffer(test_bytes, sizeof(test_bytes));
+	return instrad::x86::read(buf, instrad::x86::ExecMode::Compat);
+}
+
+static_assert(test_fixed().op() == instrad::x86::ops::VMOVSD && test_fixed().length() == 4);
+
+constexpr auto test_decoded = instrad::x86::decode_all<test_bytes>();
+static_assert(test_decoded.size() == 16);
+static_assert(test_decoded[3].op() == instrad::x86::ops::VBROADCASTSS && test_decoded[3].length() == 5);
+static_assert(test_decoded.back().op() == instrad::x86::ops::MOV && test_decoded.back().length() == 10);
+
+#endif
+
+
+static void usage()
+{
+	zpr::println("usage: instrad [options] <file>...");
+	zpr::println("");
+	zpr::println("  --raw               treat the file as raw machine code, even if it is an elf");
+	zpr::println("  --base <addr>       load address of a raw file (default 0)");
+	zpr::println("  --bits <16|32|64>   execution mode (default: from the file, or 64)");
+	zpr::println("  --att               print in AT&T syntax");
+	zpr::println("  --threads <n>       number of worker threads (default: one per core)");
+	zpr::println("  --descent           recursive-descent disassembly instead of a linear sweep");
+	zpr::println("  --filler            find padding and embedded data first, and skip it in the linear sweep");
+	zpr::println("  --entry <addr>      extra entry point for --descent (can be repeated)");
+	zpr::println("  --cfg               print the control flow graph of every function");
+	zpr::println("  --functions         find function starts without using symbols");
+	zpr::println("  --stack             print the stack pointer delta at every instruction of every function");
+	zpr::println("  --xrefs             print every cross-reference found by --descent");
+	zpr::println("  --xref <addr>       print the references to one address (can be repeated)");
+	zpr::println("  --gadgets           find rop/jop gadgets ending in ret, jmp reg or call reg");
+	zpr::println("  --search <pattern>  find instruction sequences, eg. 'mov r64, [rsp + imm]; call *', in all");
+	zpr::println("                      the files given (see x86/pattern.h for the syntax)");
+	zpr::println("  --estimate <uarch>  estimate the cycles per iteration of every loop (skylake, zen2)");
+	zpr::println("  --features          list the instruction set extensions used by all the files given");
+	zpr::println("  --allow <exts>      check that only these extensions are used, eg. 'x86-64-v2,aes', stopping at");
+	zpr::println("                      the first instruction that needs something else");
+	zpr::println("  --function <addr>   only check the function at this address (can be repeated)");
+	zpr::println("  --stats             histograms of the ops, lengths, prefixes, operands, addressing forms and opcode");
+	zpr::println("                      maps in all the executable sections");
+	zpr::println("  --dupes             find near-duplicate functions across all the files given, ignoring addresses,");
+	zpr::println("                      immediates and register allocation");
+	zpr::println("  --diff <old> <new>  match the functions of two builds by name (or their instructions), and print the");
+	zpr::println("                      instructions that changed, ignoring branch offsets and rip-relative displacements");
+	zpr::println("  --similarity <x>    how similar (0 to 1) functions have to be for --dupes (default 0.8)");
+	zpr::println("  --decode-cache      time a linear sweep with and without the decode cache, instead of printing it");
+	zpr::println("  --index <path>      print the listing from the index at path, (re)building it first if it's missing");
+	zpr::println("                      or out of date");
+	zpr::println("  --at <addr>         print a few instructions from addr, without sweeping from the start (can be repeated)");
+	zpr::println("  --patch <addr>=<hex>  overwrite the bytes at addr (eg. 0x1234=9090) after the first sweep, and");
+	zpr::println("                      only re-decode around the patches (can be repeated)");
+}
+
+static bool parseOptions(Options& opts, int argc, char** argv)
+{
+	for(int i = 1; i < argc; i++)
+	{
+		auto arg = std::string(argv[i]);
+		auto next = [&]() -> const char* {
+			if(i + 1 >= argc)
+			{
+				zpr::println("expected argument after '%s'", arg);
+				return nullptr;
+			}
+			return argv[++i];
+		};
+
+		if(arg == "--raw")          opts.raw = true;
+		else if(arg == "--att")     opts.att = true;
+		else if(arg == "--descent") opts.descent = true;
+		else if(arg == "--cfg")     opts.cfg = true;
+		else if(arg == "--functions") opts.functions = true;
+		else if(arg == "--xrefs")   opts.xrefs = true;
+		else if(arg == "--gadgets") opts.gadgets = true;
+		else if(arg == "--features") opts.features = true;
+		else if(arg == "--filler")  opts.filler = true;
+		else if(arg == "--stack")   opts.stack = true;
+		else if(arg == "--decode-cache") opts.decodeCache = true;
+		else if(arg == "--stats")   opts.stats = true;
+		else if(arg == "--dupes")   opts.dupes = true;
+		else if(arg == "--diff")    opts.diff = true;
+		else if(arg == "--base" || arg == "--bits" || arg == "--threads" || arg == "--entry" || arg == "--xref"
+			|| arg == "--function" || arg == "--at")
 		{
-			return zpr::sprint("%s", op.reg().name());
+			auto val = next();
+			if(val == nullptr)
+				return false;
+
+			auto num = strtoull(val, nullptr, 0);
+			if(arg == "--base")         opts.base = num;
+			else if(arg == "--bits")    opts.bits = (int) num;
+			else if(arg == "--threads") opts.threads = num;
+			else if(arg == "--xref")    opts.xrefTargets.push_back(num);
+			else if(arg == "--function") opts.functionAddrs.push_back(num);
+			else if(arg == "--at")      opts.seeks.push_back(num);
+			else                        opts.entries.push_back(num);
 		}
-		else if(op.isImmediate())
+		else if(arg == "--search")
 		{
-			int64_t value = op.imm();
-			if(op.immediateSize() == 8)  value = (uint8_t) value;
-			if(op.immediateSize() == 16) value = (uint16_t) value;
-			if(op.immediateSize() == 32) value = (uint32_t) value;
+			auto val = next();
+			if(val == nullptr)
+				return false;
 
-			// printf("[%#lx]", op.imm());
-			return zpr::sprint("%#lx", value);
+			opts.search = val;
 		}
-		else if(op.isRelativeOffset())
+		else if(arg == "--estimate")
 		{
-			return zpr::sprint("%#lx", ip + op.ofs().offset());
+			auto val = next();
+			if(val == nullptr)
+				return false;
+
+			opts.uarch = val;
+			if(instrad::x86::uarch::find(val) == nullptr)
+			{
+				zpr::println("unknown microarchitecture '%s'", val);
+				return false;
+			}
 		}
-		else if(op.isMemory())
+		else if(arg == "--similarity")
 		{
-			auto& mem = op.mem();
-			auto& base = mem.base();
-			auto& idx = mem.index();
+			auto val = next();
+			if(val == nullptr)
+				return false;
 
-			std::string size = "";
-			switch(mem.bits())
+			opts.similarity = strtod(val, nullptr);
+			if(opts.similarity <= 0 || opts.similarity > 1)
 			{
-				case 8:     size = "BYTE PTR ";     break;
-				case 16:    size = "WORD PTR ";     break;
-				case 32:    size = "DWORD PTR ";    break;
-				case 64:    size = "QWORD PTR ";    break;
-				case 80:    size = "TWORD PTR ";    break;
-				case 128:   size = "XMMWORD PTR ";  break;
-				case 256:   size = "YMMWORD PTR ";  break;
-				case 512:   size = "ZMMWORD PTR ";  break;
-				default:    break;
+				zpr::println("invalid similarity '%s'", val);
+				return false;
 			}
+		}
+		else if(arg == "--index")
+		{
+			auto val = next();
+			if(val == nullptr)
+				return false;
 
+			opts.index = val;
+		}
+		else if(arg == "--allow")
+		{
+			auto val = next();
+			if(val == nullptr)
+				return false;
 
-			std::string segment = "";
-			if(mem.segment().present())
-				segment = zpr::sprint("%s:", mem.segment().name());
+			opts.allow = val;
+			opts.features = true;
+		}
+		else if(arg == "--patch")
+		{
+			auto val = next();
+			if(val == nullptr)
+				return false;
 
-			// you can't scale a displacement, so we're fine here.
-			if(!base.present() && !idx.present())
-				return size + segment + zpr::sprint("[%#x]", mem.displacement());
+			char* end = nullptr;
+			auto patch = Options::Patch();
+			patch.address = strtoull(val, &end, 0);
 
-			std::string tmp = size + segment + "[";
-			if(base.present())
+			auto hex = std::string(*end == '=' ? end + 1 : "");
+			for(size_t k = 0; k + 1 < hex.size(); k += 2)
+				patch.bytes.push_back((uint8_t) strtoul(hex.substr(k, 2).c_str(), nullptr, 16));
+
+			if(patch.bytes.empty() || hex.size() % 2 != 0)
 			{
-				tmp += zpr::sprint("%s", base.name());
-				if(idx.present() || op.mem().displacement() != 0 || op.mem().scale() != 1)
-					tmp += " + ";
+				zpr::println("invalid patch '%s'", val);
+				return false;
 			}
 
-			if(idx.present())
-				tmp += zpr::sprint("%s", idx.name());
+			opts.patches.push_back(std::move(patch));
+		}
+		else if(arg.size() > 1 && arg[0] == '-')
+		{
+			zpr::println("unknown option '%s'", arg);
+			return false;
+		}
+		else
+		{
+			opts.files.push_back(arg);
+		}
+	}
 
-			if(op.mem().scale() != 1)
-				tmp += zpr::sprint("*%d", op.mem().scale());
+	if(!opts.files.empty())
+		opts.filename = opts.files[0];
 
-			if(op.mem().displacement() != 0)
-			{
-				if(idx.present() || op.mem().scale() != 1)
-					tmp += " + ";
+	if(opts.filename.empty())
+	{
+		usage();
+		return false;
+	}
 
-				tmp += zpr::sprint("%#x", op.mem().displacement());
-			}
+	if(opts.bits != 0 && opts.bits != 16 && opts.bits != 32 && opts.bits != 64)
+	{
+		zpr::println("invalid bits '%d'", opts.bits);
+		return false;
+	}
 
-			return tmp + "]";
-		}
+	return true;
+}
 
-		return "<??>";
-	};
+static bool readFile(const std::string& name, std::vector<uint8_t>& out)
+{
+	auto file = std::ifstream(name, std::ios::binary);
+	if(!file)
+	{
+		perror("failed to open file");
+		return false;
+	}
+
+	file.seekg(0, std::ios::end);
+	size_t length = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	out.resize(length);
+	file.read((char*) out.data(), length);
+	return true;
+}
+
+static instrad::x86::ExecMode modeForBits(int bits)
+{
+	if(bits == 16)      return instrad::x86::ExecMode::Legacy;
+	else if(bits == 32) return instrad::x86::ExecMode::Compat;
+	else                return instrad::x86::ExecMode::Long;
+}
+
+static void printInstruction(const Options& opts, const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes)
+{
+	if(instr.op() == instrad::x86::ops::INVALID)
+		zpr::println("%8x:      %02x                            (bad)", ip, bytes[0]);
 
-	std::string margin = "    ";
+	else if(opts.att)
+		zpr::println("%8x:  %s", ip, print_att(instr, ip, bytes, instr.length()));
 
-	// print the bytes
-	size_t col = 0;
-	for(size_t i = 0; i < len; i++)
+	else
+		zpr::println("%8x:  %s", ip, print_intel(instr, ip, bytes, instr.length()));
+}
+
+static void linearSweep(const Options& opts, const instrad::x86::CodeRegion& region)
+{
+	uint64_t ip = region.base();
+	while(ip < region.end())
 	{
-		margin += zpr::sprint("%02x ", bytes[i]);
-		col += 3;
+		auto instr = region.decode(ip);
+		printInstruction(opts, instr, ip, region.bytes() + region.offsetOf(ip));
+
+		ip = region.nextBoundary(ip, instr);
 	}
+}
+
+// a (parallel) linear sweep that steps over padding and data instead of decoding junk out of it.
+static void fillerSweep(const Options& opts, const instrad::x86::CodeRegion& region)
+{
+	using instrad::x86::FillerKind;
+	constexpr const char* kinds[] = { "int3 padding", "nop padding", "zero padding", "data" };
+
+	auto fillers = instrad::x86::classifyFiller(region);
+	auto dis = instrad::x86::sweepRegion(region, fillers, opts.threads);
+
+	size_t f = 0;
+	size_t skipped[4] = { };
+	auto flush = [&](uint64_t upto) {
+		for(; f < fillers.size() && fillers[f].lo < upto; f++)
+		{
+			zpr::println("%8x:  (%s, %d bytes)", fillers[f].lo, kinds[(int) fillers[f].kind], fillers[f].hi - fillers[f].lo);
+			skipped[(int) fillers[f].kind] += fillers[f].hi - fillers[f].lo;
+		}
+	};
+
+	dis.forEach([&](uint64_t ip, const instrad::x86::Instruction& instr) {
+		flush(ip + 1);
+		printInstruction(opts, instr, ip, region.bytes() + region.offsetOf(ip));
+	});
 
-	while(col++ < 30)
-		margin += zpr::sprint(" ");
+	flush(region.end());
+	zpr::println("\n%d instructions; skipped %d bytes of padding and %d bytes of data", dis.instructionCount,
+		skipped[0] + skipped[1] + skipped[2], skipped[3]);
+}
+
+// times linear sweeps with and without a decode cache. the first pass goes over the section once, which
+// is the worst case for the cache (it has to win on repetition within the section alone); the second goes
+// over every 4k chunk a few times in a row, which is more like what the cfg and stack passes do when they
+// decode the same function again.
+static void benchDecodeCache(const instrad::x86::CodeRegion& region)
+{
+	using instrad::x86::Instruction;
 
-	std::string prefix = "";
-	if(instr.lockPrefix())  prefix = "lock ";
-	if(instr.repPrefix())   prefix = "rep ";
-	if(instr.repnzPrefix()) prefix = "repnz ";
+	constexpr size_t CHUNK = 4096;
+	constexpr int REPEATS = 8;
+
+	auto sweep = [&region](uint64_t lo, uint64_t hi, auto&& decode) -> size_t {
+		size_t sum = 0;
+		for(auto ip = lo; ip < hi; )
+		{
+			Instruction instr = decode(ip);
+			sum += instr.op().id() + instr.length();
+			ip = region.nextBoundary(ip, instr);
+		}
+		return sum;
+	};
+
+	auto timed = [](auto&& fn, size_t& sum) -> double {
+		auto start = std::chrono::steady_clock::now();
+		sum = fn();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
 
-	auto ret = zpr::sprint("%s%s%s ", margin, prefix, std::string(instr.op().mnemonic()));
-	if(instr.operandCount() == 1)
+	auto plain = [&region](uint64_t ip) { return region.decode(ip); };
+
+	auto once = [&](auto&& decode) {
+		return [&]() { return sweep(region.base(), region.end(), decode); };
+	};
+
+	auto chunked = [&](auto&& decode) {
+		return [&]() {
+			size_t sum = 0;
+			for(auto lo = region.base(); lo < region.end(); lo += CHUNK)
+			{
+				for(int k = 0; k < REPEATS; k++)
+					sum += sweep(lo, std::min(lo + CHUNK, region.end()), decode);
+			}
+			return sum;
+		};
+	};
+
+	auto report = [](const char* what, double plainMs, double cachedMs, bool same,
+		const instrad::x86::DecodeCacheStats& stats) {
+		zpr::println("  %-16s %8.2f ms  %8.2f ms  (%.2fx)  hit rate %.1f%%, %d evictions%s", what, plainMs, cachedMs,
+			plainMs / cachedMs, 100 * stats.hitRate(), stats.evictions, same ? "" : "  (MISMATCH)");
+	};
+
+	zpr::println("  %-16s %11s  %11s", "", "uncached", "cached");
+
+	size_t a = 0;
+	size_t b = 0;
+
+	auto cache = instrad::x86::DecodeCache();
+	auto cached = [&cache, &region](uint64_t ip) { return cache.decode(region, ip); };
+
+	auto t0 = timed(once(plain), a);
+	auto t1 = timed(once(cached), b);
+	report("one pass", t0, t1, a == b, cache.stats());
+
+	cache.clear();
+	cache.resetStats();
+
+	t0 = timed(chunked(plain), a);
+	t1 = timed(chunked(cached), b);
+	report(zpr::sprint("4k chunks x%d", REPEATS).c_str(), t0, t1, a == b, cache.stats());
+}
+
+// sweeps the section, applies the patches (straight into the image), and then only re-decodes
+// around them; prints the patched listing.
+static void patchedSweep(const Options& opts, instrad::Image& img, const instrad::Section& sec,
+	const instrad::x86::CodeRegion& region)
+{
+	auto sweep = instrad::x86::IncrementalSweep(region);
+	auto ranges = std::vector<instrad::x86::PatchRange>();
+
+	// a patch that doesn't start and end on an instruction boundary is usually a mistake, so say so.
+	auto before = instrad::x86::InstructionBitmap(region, sweep.starts());
+	for(auto& p : opts.patches)
 	{
-		ret += print_operand(instr.dst());
+		auto lo = p.address;
+		auto hi = p.address + p.bytes.size();
+
+		if(before.contains(lo) && !before.isInstructionStart(lo))
+		{
+			zpr::println("warning: patch at %#x starts inside instruction %d (at %#x)", lo, before.indexOf(lo),
+				before.boundaryBefore(lo));
+		}
+
+		if(before.contains(hi) && !before.isInstructionStart(hi))
+		{
+			zpr::println("warning: patch at %#x ends inside instruction %d (at %#x)", lo, before.indexOf(hi),
+				before.boundaryBefore(hi));
+		}
 	}
-	else if(instr.operandCount() == 2)
+
+	for(auto& p : opts.patches)
 	{
-		ret += print_operand(instr.dst()); ret += ", ";
-		ret += print_operand(instr.src());
+		for(size_t k = 0; k < p.bytes.size(); k++)
+		{
+			if(region.contains(p.address + k))
+				img.bytes[sec.offset + region.offsetOf(p.address + k)] = p.bytes[k];
+		}
+
+		ranges.push_back(instrad::x86::PatchRange { p.address, p.address + p.bytes.size() });
 	}
-	else if(instr.operandCount() == 3)
+
+	auto stats = sweep.update(ranges);
+	sweep.forEach([&](uint64_t ip, const instrad::x86::Instruction& instr) {
+		printInstruction(opts, instr, ip, region.bytes() + region.offsetOf(ip));
+	});
+
+	zpr::println("\n%d instructions; re-decoded %d instructions (%d bytes) in %d places", sweep.instructionCount(),
+		stats.instructions, stats.bytes, stats.ranges);
+}
+
+static std::vector<uint64_t> collectEntries(const Options& opts, const instrad::Image& img,
+	const instrad::x86::CodeRegion& region)
+{
+	auto entries = std::vector<uint64_t>();
+	if(img.hasEntry && region.contains(img.entry))
+		entries.push_back(img.entry);
+
+	for(auto& sym : img.symbols)
 	{
-		ret += print_operand(instr.dst()); ret += ", ";
-		ret += print_operand(instr.src()); ret += ", ";
-		ret += print_operand(instr.ext());
+		if(sym.function && region.contains(sym.address))
+			entries.push_back(sym.address);
 	}
-	else
+
+	for(auto e : opts.entries)
 	{
-		ret += print_operand(instr.dst()); ret += ", ";
-		ret += print_operand(instr.src()); ret += ", ";
-		ret += print_operand(instr.ext()); ret += ", ";
-		ret += print_operand(instr.op4());
+		if(region.contains(e))
+			entries.push_back(e);
 	}
 
-	return ret;
+	std::sort(entries.begin(), entries.end());
+	entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+	return entries;
 }
 
+// decodes a few instructions from each --at address, starting from the nearest checkpoint instead of the
+// start of the section. the function symbols and the entry point are the only checkpoints to begin with.
+static void seekInstructions(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	constexpr size_t COUNT = 16;
+
+	auto decoder = instrad::x86::RandomAccessDecoder(region);
+	for(auto addr : collectEntries(opts, img, region))
+		decoder.checkpoint(addr);
+
+	for(auto addr : opts.seeks)
+	{
+		if(!region.contains(addr))
+			continue;
+
+		auto res = decoder.seek(addr);
+		auto ip = res.address;
 
+		for(size_t i = 0; i < COUNT && ip < region.end(); i++)
+		{
+			auto instr = (i == 0) ? res.instr : region.decode(ip);
+			printInstruction(opts, instr, ip, region.bytes() + region.offsetOf(ip));
+
+			ip = region.nextBoundary(ip, instr);
+		}
 
-static std::string print_att(const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes, size_t len)
+		zpr::println("(%s, after decoding %d instructions)\n", res.exact ? "from a checkpoint" : "resynced; might be off",
+			res.decoded);
+	}
+}
+
+static void descend(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
 {
-	std::string instr_suffix = "";
+	auto read = [&img](uint64_t addr, void* out, size_t n) -> bool { return img.read(addr, out, n); };
+	auto dis = instrad::x86::recursiveDescent(region, collectEntries(opts, img, region), opts.threads, read);
 
-	auto print_operand = [&ip, &instr_suffix](const instrad::x86::Operand& op) -> std::string {
-		if(op.isRegister())
+	uint64_t expected = 0;
+	dis.forEach([&](uint64_t ip, const instrad::x86::Instruction& instr) {
+		if(expected != 0 && ip != expected)
+			zpr::println("          ...");
+
+		printInstruction(opts, instr, ip, region.bytes() + region.offsetOf(ip));
+		expected = ip + instr.length();
+	});
+
+	zpr::println("\n%d instructions, %d call targets, %d jump tables", dis.instructionCount, dis.calls.size(),
+		dis.jumpTables.size());
+}
+
+static void printGraphs(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	constexpr const char* kinds[] = { "fallthrough", "branch", "jump", "return", "switch" };
+	auto read = [&img](uint64_t addr, void* out, size_t n) -> bool { return img.read(addr, out, n); };
+
+	auto builder = instrad::x86::CFGBuilder();
+	for(auto entry : collectEntries(opts, img, region))
+	{
+		auto g = builder.build(region, entry, region.base(), region.end(), read);
+		zpr::println("function %#x: %d blocks, %d edges", entry, g.numBlocks(), g.numEdges());
+
+		for(size_t b = 0; b < g.numBlocks(); b++)
 		{
-			return zpr::sprint("%%%s", op.reg().name());
+			auto line = zpr::sprint("    %#x (%d bytes)", g.blockStarts[b], g.blockSizes[b]);
+			for(auto e = g.firstEdge(b); e < g.lastEdge(b); e++)
+			{
+				line += zpr::sprint("%s %#x (%s)", e == g.firstEdge(b) ? " ->" : ",",
+					g.blockStarts[g.edgeTargets[e]], kinds[(int) g.edgeKinds[e]]);
+			}
+
+			zpr::println("%s", line);
 		}
-		else if(op.isImmediate())
+	}
+}
+
+// estimates every block that branches back to itself or an earlier block (ie. the bottom of a loop).
+static void printEstimates(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	auto arch = instrad::x86::uarch::find(opts.uarch.c_str());
+	auto read = [&img](uint64_t addr, void* out, size_t n) -> bool { return img.read(addr, out, n); };
+
+	auto builder = instrad::x86::CFGBuilder();
+	auto instrs = std::vector<instrad::x86::Instruction>();
+
+	for(auto entry : collectEntries(opts, img, region))
+	{
+		auto g = builder.build(region, entry, region.base(), region.end(), read);
+		for(size_t b = 0; b < g.numBlocks(); b++)
 		{
-			int64_t value = op.imm();
-			if(op.immediateSize() == 8)  value = (uint8_t) value;   instr_suffix = "b";
-			if(op.immediateSize() == 16) value = (uint16_t) value;  instr_suffix = "w";
-			if(op.immediateSize() == 32) value = (uint32_t) value;  instr_suffix = "l";
-			if(op.immediateSize() == 64) value = (uint64_t) value;  instr_suffix = "absq";
+			bool loops = false;
+			for(auto e = g.firstEdge(b); e < g.lastEdge(b); e++)
+				loops |= (g.edgeTargets[e] <= b && g.edgeKinds[e] != instrad::x86::EdgeKind::Switch);
+
+			if(!loops)
+				continue;
 
-			// printf("[%#lx]", op.imm());
-			return zpr::sprint("$%#lx", value);
+			instrs.clear();
+			for(auto ip = g.blockStarts[b]; ip < g.blockStarts[b] + g.blockSizes[b]; )
+			{
+				instrs.push_back(region.decode(ip));
+				ip = region.nextBoundary(ip, instrs.back());
+			}
+
+			auto est = instrad::x86::estimateBlock(*arch, instrs);
+			auto why = std::string(est.bottleneck);
+			if(est.bottleneckPort >= 0)
+				why += zpr::sprint(" %s", arch->portNames[est.bottleneckPort]);
+
+			zpr::println("%8x: %d instructions, %d uops, %.2f cycles/iteration (ports %.2f, latency %.2f, frontend %.2f); bottleneck: %s",
+				g.blockStarts[b], instrs.size(), est.uops, est.cyclesPerIteration, est.portBound, est.latencyBound,
+				est.frontendBound, why);
 		}
-		else if(op.isRelativeOffset())
+	}
+}
+
+static void printStackDeltas(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	using instrad::x86::StackIssue;
+	constexpr const char* issues[] = { "lost", "conflict", "unbalanced", "unreached" };
+
+	auto read = [&img](uint64_t addr, void* out, size_t n) -> bool { return img.read(addr, out, n); };
+	auto builder = instrad::x86::CFGBuilder();
+	auto tracker = instrad::x86::StackTracker();
+	auto deltas = instrad::x86::StackDeltas();
+
+	auto show = [](int32_t d) -> std::string {
+		if(d == instrad::x86::UNKNOWN_DELTA)
+			return "?";
+
+		return d < 0 ? zpr::sprint("-%#x", -d) : zpr::sprint("+%#x", d);
+	};
+
+	for(auto entry : collectEntries(opts, img, region))
+	{
+		auto g = builder.build(region, entry, region.base(), region.end(), read);
+		tracker.analyse(region, g, deltas);
+
+		zpr::println("function %#x:", entry);
+
+		size_t n = 0;
+		deltas.forEach([&](uint64_t ip, int32_t delta) {
+			auto instr = region.decode(ip);
+			auto text = opts.att ? print_att(instr, ip, nullptr, 0) : print_intel(instr, ip, nullptr, 0);
+
+			auto line = zpr::sprint("%8x:  %6s  %s", ip, show(delta), text.substr(text.find_first_not_of(' ')));
+			while(n < deltas.notes.size() && deltas.notes[n].address == ip)
+			{
+				line += zpr::sprint("    # %s", issues[(int) deltas.notes[n].issue]);
+				if(deltas.notes[n].issue != StackIssue::Lost && deltas.notes[n].issue != StackIssue::Unreached)
+					line += zpr::sprint(" (%s)", show(deltas.notes[n].delta));
+
+				n++;
+			}
+
+			zpr::println("%s", line);
+		});
+
+		zpr::println("");
+	}
+}
+
+static void printFunctions(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	using instrad::x86::FunctionStart;
+
+	auto starts = instrad::x86::findFunctionStarts(region);
+	for(auto& f : starts)
+	{
+		std::string why;
+		if(f.reasons & FunctionStart::CALL_TARGET)      why += " call-target";
+		if(f.reasons & FunctionStart::ENDBR)            why += " endbr";
+		if(f.reasons & FunctionStart::FRAME_SETUP)      why += " frame-setup";
+		if(f.reasons & FunctionStart::STACK_ALLOC)      why += " stack-alloc";
+		if(f.reasons & FunctionStart::AFTER_PADDING)    why += " after-padding";
+
+		zpr::println("%8x:%s", f.address, why);
+	}
+
+	zpr::println("\n%d functions", starts.size());
+}
+
+static void printXrefs(const Options& opts, const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	using instrad::x86::XrefKind;
+	constexpr const char* kinds[] = { "call", "jump", "read", "address" };
+
+	auto read = [&img](uint64_t addr, void* out, size_t n) -> bool { return img.read(addr, out, n); };
+	auto dis = instrad::x86::recursiveDescent(region, collectEntries(opts, img, region), opts.threads, read);
+	auto index = instrad::x86::buildXrefs(dis, opts.threads);
+
+	auto print = [&](uint64_t target) {
+		for(size_t k = 0; k < instrad::x86::NUM_XREF_KINDS; k++)
 		{
-			return zpr::sprint("%#lx", ip + op.ofs().offset());
+			for(auto src : index.referencesTo((XrefKind) k, target))
+				zpr::println("%8x <- %8x (%s)", target, src, kinds[k]);
 		}
-		else if(op.isMemory())
+	};
+
+	if(!opts.xrefTargets.empty())
+	{
+		for(auto t : opts.xrefTargets)
+			print(t);
+	}
+	else
+	{
+		// every distinct target, in address order.
+		auto targets = std::vector<uint64_t>();
+		for(auto& t : index.tables)
+			targets.insert(targets.end(), t.targets.begin(), t.targets.end());
+
+		std::sort(targets.begin(), targets.end());
+		targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+		for(auto t : targets)
+			print(t);
+	}
+
+	zpr::println("\n%d calls, %d jumps, %d reads, %d addresses", index.count(XrefKind::Call), index.count(XrefKind::Jump),
+		index.count(XrefKind::Read), index.count(XrefKind::Address));
+}
+
+static void printGadgets(const Options& opts, const instrad::x86::CodeRegion& region)
+{
+	auto gopts = instrad::x86::GadgetOptions();
+	gopts.threads = opts.threads;
+
+	auto gadgets = instrad::x86::findGadgets(region, gopts);
+	for(auto& g : gadgets)
+	{
+		std::string line;
+		for(auto ip = g.address; ip <= g.terminator; )
 		{
-			auto& mem = op.mem();
-			auto& base = mem.base();
-			auto& idx = mem.index();
+			auto instr = region.decode(ip);
+			auto text = opts.att ? print_att(instr, ip, nullptr, 0) : print_intel(instr, ip, nullptr, 0);
+
+			// the printers pad the (empty) bytes column; we don't want that here.
+			text.erase(0, text.find_first_not_of(' '));
+			while(!text.empty() && text.back() == ' ')
+				text.pop_back();
+
+			line += (line.empty() ? "" : "; ") + text;
+			ip += instr.length();
+		}
+
+		zpr::println("%8x:  %s", g.address, line);
+	}
 
-			switch(mem.bits())
+	zpr::println("\n%d gadgets", gadgets.size());
+}
+
+// searches every file on its own thread (well, up to --threads of them at once); the output is
+// collected per file, so that it comes out in the order the files were given.
+static bool searchFiles(const Options& opts)
+{
+	auto pat = instrad::x86::Pattern();
+	auto error = std::string();
+	if(!instrad::x86::compilePattern(opts.search, pat, error))
+	{
+		zpr::println("invalid pattern: %s", error);
+		return false;
+	}
+
+	auto outputs = std::vector<std::string>(opts.files.size());
+	auto cursor = std::atomic<size_t>(0);
+
+	auto work = [&]() {
+		auto matcher = instrad::x86::PatternMatcher(pat);
+
+		size_t i = 0;
+		while((i = cursor.fetch_add(1)) < opts.files.size())
+		{
+			auto& out = outputs[i];
+			auto bytes = std::vector<uint8_t>();
+			if(!readFile(opts.files[i], bytes))
+				continue;
+
+			auto img = instrad::loadImage(std::move(bytes), opts.raw, opts.base, opts.bits == 0 ? 64 : opts.bits);
+			if(opts.bits != 0)
+				img.bits = opts.bits;
+
+			for(auto& sec : img.sections)
 			{
-				case 8:     instr_suffix = "b"; break;
-				case 16:    instr_suffix = "w"; break;
-				case 32:    instr_suffix = "l"; break;
-				case 64:    instr_suffix = "q"; break;
-
-				// there should be no ambiguity in these cases,
-				// so in theory we should not need a suffix.
-				// (either way, idk what the suffixes would be,
-				// and there don't seem to be any defined)
-				default:
-					break;
+				if(!sec.executable)
+					continue;
+
+				auto region = instrad::x86::CodeRegion(img.data(sec), sec.size, sec.address, modeForBits(img.bits));
+				instrad::x86::searchRegion(region, matcher, [&](const instrad::x86::PatternMatch& m) {
+					out += zpr::sprint("%s:%s:", opts.files[i], sec.name);
+					for(auto ip = m.address; ip < m.address + m.length; )
+					{
+						auto instr = region.decode(ip);
+						auto text = opts.att ? print_att(instr, ip, nullptr, 0) : print_intel(instr, ip, nullptr, 0);
+
+						out += zpr::sprint("%s%8x:  %s\n", ip == m.address ? "\n" : "", ip, text.substr(text.find_first_not_of(' ')));
+						ip += instr.length();
+					}
+				});
 			}
+		}
+	};
 
-			if(mem.isDisplacement64Bits())
-				instr_suffix = "abs" + instr_suffix;
+	auto threads = opts.threads;
+	if(threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
 
-			std::string segment = mem.segment().present()
-				? zpr::sprint("%%%s:", mem.segment().name())
-				: "";
+	auto pool = std::vector<std::thread>();
+	for(size_t t = 1; t < std::min(threads, opts.files.size()); t++)
+		pool.emplace_back(work);
 
-			// you can't scale a displacement, so we're fine here.
-			if(!base.present() && !idx.present())
-				return segment + zpr::sprint("%#x", mem.displacement());
+	work();
+	for(auto& t : pool)
+		t.join();
 
-			std::string tmp = segment;
-			if(op.mem().displacement() != 0)
-				tmp += zpr::sprint("%#lx", op.mem().displacement());
+	for(auto& out : outputs)
+		zpr::print("%s", out);
 
-			tmp += "(";
+	return true;
+}
 
-			if(base.present())
-				tmp += zpr::sprint("%%%s", base.name());
+struct NamedFunction
+{
+	uint64_t begin = 0;
+	uint64_t end = 0;
+	std::string name;       // empty if it didn't come from a symbol
+};
+
+// the functions in an executable section: the sized function symbols if there are any (aliases, and the
+// same symbol in both .symtab and .dynsym, are one function with all the names), and otherwise whatever
+// findFunctionStarts finds, each running until the next one starts.
+static std::vector<NamedFunction> collectFunctions(const instrad::Image& img, const instrad::x86::CodeRegion& region)
+{
+	auto ret = std::vector<NamedFunction>();
 
-			if(idx.present())
-				tmp += zpr::sprint(", %%%s", idx.name());
+	auto syms = std::vector<const instrad::Symbol*>();
+	for(auto& sym : img.symbols)
+	{
+		if(sym.function && sym.size > 0 && region.contains(sym.address))
+			syms.push_back(&sym);
+	}
 
-			if(op.mem().scale() != 1)
-				tmp += zpr::sprint(", %d", op.mem().scale());
+	std::sort(syms.begin(), syms.end(), [](auto a, auto b) {
+		return a->address != b->address ? a->address < b->address : a->name < b->name;
+	});
 
-			tmp += ")";
-			return tmp;
+	for(size_t k = 0; k < syms.size(); )
+	{
+		auto name = syms[k]->name;
+		auto j = k + 1;
+		for(; j < syms.size() && syms[j]->address == syms[k]->address; j++)
+		{
+			if(syms[j]->name != syms[j - 1]->name)
+				name += "/" + syms[j]->name;
 		}
 
-		return "??";
+		ret.push_back(NamedFunction { syms[k]->address, syms[k]->address + syms[k]->size, name });
+		k = j;
+	}
+
+	if(!ret.empty())
+		return ret;
+
+	auto starts = instrad::x86::findFunctionStarts(region);
+	for(size_t k = 0; k < starts.size(); k++)
+	{
+		auto end = (k + 1 < starts.size() ? starts[k + 1].address : region.end());
+		ret.push_back(NamedFunction { starts[k].address, end, "" });
+	}
+
+	return ret;
+}
+
+// fingerprints every function in every file (one file per thread, like --search), then clusters them all
+// together.
+static bool findDuplicates(const Options& opts)
+{
+	using namespace instrad::x86;
+
+	struct FileFunctions
+	{
+		std::vector<FunctionFingerprint> fps;
+		std::vector<std::string> names;
 	};
 
-	std::string margin = "    ";
+	auto files = std::vector<FileFunctions>(opts.files.size());
+	auto cursor = std::atomic<size_t>(0);
+
+	auto work = [&]() {
+		auto fopts = FingerprintOptions();
+
+		size_t i = 0;
+		while((i = cursor.fetch_add(1)) < opts.files.size())
+		{
+			auto& out = files[i];
+			auto bytes = std::vector<uint8_t>();
+			if(!readFile(opts.files[i], bytes))
+				continue;
+
+			auto img = instrad::loadImage(std::move(bytes), opts.raw, opts.base, opts.bits == 0 ? 64 : opts.bits);
+			if(opts.bits != 0)
+				img.bits = opts.bits;
+
+			for(auto& sec : img.sections)
+			{
+				if(!sec.executable)
+					continue;
+
+				auto region = CodeRegion(img.data(sec), sec.size, sec.address, modeForBits(img.bits));
+				for(auto& f : collectFunctions(img, region))
+				{
+					auto fp = FunctionFingerprint();
+					if(!fingerprintFunction(region, f.begin, f.end, fopts, fp))
+						continue;
+
+					out.fps.push_back(fp);
+					out.names.push_back(f.name.empty() ? zpr::sprint("%s:%x", opts.files[i], f.begin)
+						: zpr::sprint("%s:%s@%x", opts.files[i], f.name, f.begin));
+				}
+			}
+		}
+	};
+
+	auto threads = opts.threads;
+	if(threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+
+	auto pool = std::vector<std::thread>();
+	for(size_t t = 1; t < std::min(threads, opts.files.size()); t++)
+		pool.emplace_back(work);
+
+	work();
+	for(auto& t : pool)
+		t.join();
 
-	// print the bytes
-	size_t col = 0;
-	for(size_t i = 0; i < len; i++)
+	auto fps = std::vector<FunctionFingerprint>();
+	auto names = std::vector<std::string>();
+	for(auto& f : files)
 	{
-		margin += zpr::sprint("%02x ", bytes[i]);
-		col += 3;
+		fps.insert(fps.end(), f.fps.begin(), f.fps.end());
+		names.insert(names.end(), f.names.begin(), f.names.end());
 	}
 
-	while(col++ < 30)
-		margin += zpr::sprint(" ");
+	auto clusters = clusterFunctions(fps, opts.similarity);
+	for(auto& c : clusters)
+	{
+		zpr::println("%d functions:", c.size());
+		for(auto k : c)
+		{
+			zpr::println("  %.2f  %s (%d instructions)", similarity(fps[c[0]], fps[k]), names[k],
+				fps[k].instructions);
+		}
 
-	std::string prefix = "";
-	if(instr.lockPrefix())  prefix = "lock ";
-	if(instr.repPrefix())   prefix = "rep ";
-	if(instr.repnzPrefix()) prefix = "repnz ";
+		zpr::println("");
+	}
 
+	zpr::println("%d functions compared, %d clusters", fps.size(), clusters.size());
+	return true;
+}
 
-	// only print the instruction last, because we need to parse the operand to know the suffix.
+// decodes every function of both builds (spread over all the threads, not one file each), then matches
+// and diffs them; only the functions that changed get printed.
+static bool diffFiles(const Options& opts)
+{
+	using namespace instrad::x86;
 
-	std::string operands;
-	if(instr.operandCount() == 1)
+	if(opts.files.size() != 2)
 	{
-		operands += print_operand(instr.dst());
+		zpr::println("--diff needs exactly two files (old and new)");
+		return false;
 	}
-	else if(instr.operandCount() == 2)
+
+	instrad::Image imgs[2];
+	for(size_t k = 0; k < 2; k++)
 	{
-		operands += print_operand(instr.src()); operands += ", ";
-		operands += print_operand(instr.dst());
+		auto bytes = std::vector<uint8_t>();
+		if(!readFile(opts.files[k], bytes))
+			return false;
+
+		imgs[k] = instrad::loadImage(std::move(bytes), opts.raw, opts.base, opts.bits == 0 ? 64 : opts.bits);
+		if(opts.bits != 0)
+			imgs[k].bits = opts.bits;
 	}
-	else if(instr.operandCount() == 3)
+
+	struct Job
+	{
+		size_t side;
+		size_t index;
+		NamedFunction fn;
+	};
+
+	// the region of every function, so the instructions can be decoded again for printing.
+	std::vector<CodeRegion> regions[2];
+	std::vector<DiffFunction> funcs[2];
+
+	auto jobs = std::vector<Job>();
+	for(size_t k = 0; k < 2; k++)
 	{
-		operands += print_operand(instr.ext()); operands += ", ";
-		operands += print_operand(instr.src()); operands += ", ";
-		operands += print_operand(instr.dst());
+		auto& img = imgs[k];
+		for(auto& sec : img.sections)
+		{
+			if(!sec.executable)
+				continue;
+
+			auto region = CodeRegion(img.data(sec), sec.size, sec.address, modeForBits(img.bits));
+			for(auto& f : collectFunctions(img, region))
+			{
+				jobs.push_back(Job { k, regions[k].size(), std::move(f) });
+				regions[k].push_back(region);
+			}
+		}
+
+		funcs[k].resize(regions[k].size());
 	}
-	else
+
+	auto cursor = std::atomic<size_t>(0);
+	auto work = [&]() {
+		size_t i = 0;
+		while((i = cursor.fetch_add(1)) < jobs.size())
+		{
+			auto& job = jobs[i];
+			funcs[job.side][job.index] = makeDiffFunction(regions[job.side][job.index], job.fn.begin, job.fn.end, job.fn.name);
+		}
+	};
+
+	auto threads = opts.threads;
+	if(threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+
+	auto pool = std::vector<std::thread>();
+	for(size_t t = 1; t < std::min(threads, jobs.size()); t++)
+		pool.emplace_back(work);
+
+	work();
+	for(auto& t : pool)
+		t.join();
+
+	auto diff = diffBinaries(funcs[0], funcs[1], threads);
+
+	auto label = [](const DiffFunction& f) {
+		return f.name.empty() ? zpr::sprint("%x", f.address) : f.name;
+	};
+
+	auto print = [&](char sign, size_t side, size_t fn, size_t k) {
+		auto ip = funcs[side][fn].addresses[k];
+		auto instr = regions[side][fn].decode(ip);
+		auto text = opts.att ? print_att(instr, ip, nullptr, 0) : print_intel(instr, ip, nullptr, 0);
+
+		zpr::println("  %c %8x:  %s", sign, ip, text.substr(text.find_first_not_of(' ')));
+	};
+
+	size_t byName = 0;
+	size_t changed = 0;
+	for(auto& fd : diff.functions)
 	{
-		operands += print_operand(instr.op4()); operands += ", ";
-		operands += print_operand(instr.ext()); operands += ", ";
-		operands += print_operand(instr.src()); operands += ", ";
-		operands += print_operand(instr.dst());
+		byName += (fd.match == FunctionDiff::Match::Name);
+		if(fd.hunks.empty())
+			continue;
+
+		changed++;
+
+		auto& a = funcs[0][fd.before];
+		auto& b = funcs[1][fd.after];
+		zpr::println("%s: %x -> %x, %d -> %d instructions%s", label(b), a.address, b.address, a.hashes.size(),
+			b.hashes.size(), fd.rewritten ? " (too different to line up)" : "");
+
+		for(auto& h : fd.hunks)
+		{
+			zpr::println("  @@ -%d,%d +%d,%d @@", h.before, h.beforeEnd - h.before, h.after, h.afterEnd - h.after);
+			for(auto k = h.before; k < h.beforeEnd; k++)
+				print('-', 0, fd.before, k);
+
+			for(auto k = h.after; k < h.afterEnd; k++)
+				print('+', 1, fd.after, k);
+		}
+
+		zpr::println("");
 	}
 
-	return zpr::sprint("%s%s%s%s %s", margin, prefix, std::string(instr.op().mnemonic()), instr_suffix, operands);
+	auto where = [](const DiffFunction& f) {
+		return f.name.empty() ? zpr::sprint("%x", f.address) : zpr::sprint("%s (%x)", f.name, f.address);
+	};
+
+	for(auto i : diff.removed)
+		zpr::println("removed: %s", where(funcs[0][i]));
+
+	for(auto j : diff.added)
+		zpr::println("added: %s", where(funcs[1][j]));
+
+	zpr::println("\n%d functions matched (%d by name, %d by instructions), %d changed, %d removed, %d added",
+		diff.functions.size(), byName, diff.functions.size() - byName, changed, diff.removed.size(), diff.added.size());
+
+	return true;
 }
 
+// returns false if the file uses something it isn't allowed to (or can't be read at all).
+static bool checkFeatures(const Options& opts, const std::string& file)
+{
+	using namespace instrad::x86;
 
+	auto allowed = ExtSet();
+	auto error = std::string();
+	if(!opts.allow.empty() && !parseExtensions(opts.allow, allowed, error))
+	{
+		zpr::println("unknown extension '%s'", error);
+		return false;
+	}
 
+	auto stopOn = opts.allow.empty() ? ExtSet() : ~allowed;
 
+	auto bytes = std::vector<uint8_t>();
+	if(!readFile(file, bytes))
+		return false;
 
+	auto img = instrad::loadImage(std::move(bytes), opts.raw, opts.base, opts.bits == 0 ? 64 : opts.bits);
+	if(opts.bits != 0)
+		img.bits = opts.bits;
 
+	auto read = [&img](uint64_t addr, void* out, size_t n) -> bool { return img.read(addr, out, n); };
+	auto builder = CFGBuilder();
+	auto usage = ExtensionUsage();
 
+	uint64_t stopAt = 0;
+	const CodeRegion* stopRegion = nullptr;
 
+	auto region = CodeRegion();
+	for(auto& sec : img.sections)
+	{
+		if(!sec.executable)
+			continue;
 
-constexpr uint8_t test_bytes[] = {
-	0xC5, 0xFB, 0x10, 0x07, 0xC5, 0xFB, 0x10, 0xC1, 0xC5, 0xF8, 0xAE, 0x10, 0xC4, 0xE2, 0x79, 0x18, 0x00, 0xC4, 0xE2, 0x79, 0x18, 0xC0,
+		region = CodeRegion(img.data(sec), sec.size, sec.address, modeForBits(img.bits));
 
-	0x48, 0x8d, 0x46, 0x10, 0x48, 0x89, 0x06, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x39, 0xd8,
-	0x75, 0x86, 0x66, 0x0f, 0x6f, 0x4c, 0x24, 0x20, 0x0f, 0x11, 0x4e, 0x10, 0xeb, 0x86, 0x65, 0xf3, 0xa4,
+		bool ok = true;
+		if(opts.functionAddrs.empty())
+		{
+			ok = scanExtensions(region, region.base(), region.end(), usage, stopOn, &stopAt);
+		}
+		else
+		{
+			// only the blocks reachable from the function's entry, wherever they are.
+			for(size_t i = 0; ok && i < opts.functionAddrs.size(); i++)
+			{
+				if(!region.contains(opts.functionAddrs[i]))
+					continue;
+
+				auto g = builder.build(region, opts.functionAddrs[i], region.base(), region.end(), read);
+				for(size_t b = 0; ok && b < g.numBlocks(); b++)
+				{
+					ok = scanExtensions(region, g.blockStarts[b], g.blockStarts[b] + g.blockSizes[b], usage,
+						stopOn, &stopAt);
+				}
+			}
+		}
 
-	0x49, 0x8b, 0x7c, 0x24, 0x30,
+		if(!ok)
+		{
+			stopRegion = &region;
+			break;
+		}
+	}
 
-	0x48, 0xa1, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa
-};
+	zpr::println("%s: %d instructions", file, usage.instructions);
+	for(size_t i = 0; i < NUM_EXTENSIONS; i++)
+	{
+		if(usage.counts[i] > 0)
+			zpr::println("    %-10s %8d   first at %#x", extensionName((Ext) i), usage.counts[i], usage.first[i]);
+	}
 
-constexpr instrad::x86::Instruction test_fixed()
-{
-	auto buf = instrad::Buffer(test_bytes, sizeof(test_bytes));
-	return instrad::x86::read(buf, instrad::x86::ExecMode::Compat);
+	if(stopRegion != nullptr)
+	{
+		auto instr = stopRegion->decode(stopAt);
+		auto text = opts.att ? print_att(instr, stopAt, nullptr, 0) : print_intel(instr, stopAt, nullptr, 0);
+		auto bad = requiredExtensions(instr) & stopOn;
+
+		auto names = std::string();
+		for(size_t i = 0; i < NUM_EXTENSIONS; i++)
+		{
+			if(bad.has((Ext) i))
+				names += (names.empty() ? "" : ", ") + std::string(extensionName((Ext) i));
+		}
+
+		zpr::println("%s: not allowed: %#x: %s (needs %s)\n", file, stopAt, text.substr(text.find_first_not_of(' ')), names);
+		return false;
+	}
+
+	auto level = "beyond x86-64-v3";
+	if((usage.used & ~isa::X86_64_V1).empty())         level = "x86-64";
+	else if((usage.used & ~isa::X86_64_V2).empty())    level = "x86-64-v2";
+	else if((usage.used & ~isa::X86_64_V3).empty())    level = "x86-64-v3";
+
+	zpr::println("    needs %s%s\n", level, opts.allow.empty() ? "" : " (ok)");
+	return true;
 }
 
+static bool checkFeatures(const Options& opts)
+{
+	bool ok = true;
+	for(auto& f : opts.files)
+		ok &= checkFeatures(opts, f);
 
-int main(int argc, char** argv)
+	return ok;
+}
+
+// sweeps every executable section (on all the threads), and prints the histograms for all of them together.
+static void printStats(const Options& opts, const instrad::Image& img)
 {
-	// constexpr auto foo = test_fixed();
-	// printf("%zu\n", foo.numBytes());
+	namespace stats = instrad::x86::stats;
+
+	auto start = std::chrono::steady_clock::now();
 
-	if(argc < 2)
+	auto total = std::make_unique<instrad::x86::InstructionStats>();
+	for(auto& sec : img.sections)
 	{
-		zpr::println("give filename");
-		return 1;
+		if(!sec.executable)
+			continue;
+
+		auto region = instrad::x86::CodeRegion(img.data(sec), sec.size, sec.address, modeForBits(img.bits));
+		*total += instrad::x86::collectStats(region, opts.threads);
 	}
 
-	auto file = std::ifstream(argv[1], std::ios::binary);
-	if(!file)
+	auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	auto& st = *total;
+
+	auto pct = [](uint64_t n, uint64_t of) { return of == 0 ? 0.0 : (100.0 * n) / of; };
+	auto table = [&](const char* title, const uint64_t* counts, const char* const* names, size_t n, uint64_t of) {
+		zpr::println("%s:", title);
+		for(size_t i = 0; i < n; i++)
+		{
+			if(counts[i] != 0)
+				zpr::println("  %-22s %10d  %5.1f%", names[i], counts[i], pct(counts[i], of));
+		}
+		zpr::println("");
+	};
+
+	zpr::println("%d instructions, %d bytes, %d undecodable bytes (%.1f ms)\n", st.instructions, st.bytes, st.invalid, ms);
+
+	constexpr size_t TOP_OPS = 40;
+	auto order = std::vector<size_t>();
+	for(size_t i = 0; i < stats::OP_SLOTS; i++)
 	{
-		perror("failed to open file");
-		return 1;
+		if(st.ops[i] != 0 && st.opNames[i] != nullptr && i != stats::opSlot(instrad::x86::ops::INVALID))
+			order.push_back(i);
 	}
 
-	file.seekg(0, std::ios::end);
-	size_t length = file.tellg();
-	file.seekg(0, std::ios::beg);
+	std::sort(order.begin(), order.end(), [&st](size_t a, size_t b) { return st.ops[a] > st.ops[b]; });
+
+	zpr::println("ops (top %d of %d):", std::min(TOP_OPS, order.size()), order.size());
+	for(size_t i = 0; i < order.size() && i < TOP_OPS; i++)
+		zpr::println("  %-22s %10d  %5.1f%", st.opNames[order[i]], st.ops[order[i]], pct(st.ops[order[i]], st.instructions));
+
+	zpr::println("");
+	zpr::println("lengths:");
+	for(size_t i = 1; i < 16; i++)
+	{
+		if(st.lengths[i] != 0)
+			zpr::println("  %2d%s %10d  %5.1f%", i, i == 15 ? "+" : " ", st.lengths[i], pct(st.lengths[i], st.instructions));
+	}
+	zpr::println("");
+
+	uint64_t operands = 0;
+	uint64_t memory = 0;
+	for(auto n : st.operands)       operands += n;
+	for(auto n : st.memoryForms)    memory += n;
 
-	length = std::min(length, (size_t) 1024);
+	table("prefixes (% of instructions)", st.prefixes, stats::PREFIX_NAMES, (size_t) stats::Prefix::Count, st.instructions);
+	table("operands", st.operands, stats::OPERAND_NAMES, (size_t) stats::OperandKind::Count, operands);
+	table("memory operands", st.memoryForms, stats::MEMORY_FORM_NAMES, (size_t) stats::MemoryForm::Count, memory);
+	table("opcode maps", st.maps, stats::MAP_NAMES, (size_t) stats::OpcodeMap::Count, st.instructions);
+}
 
-	auto bytes = new uint8_t[length];
-	file.read((char*) &bytes[0], length);
+// prints the listing of every executable section straight out of the index, without decoding anything
+// (unless the index has to be built first).
+static bool printFromIndex(const Options& opts, const instrad::Image& img)
+{
+	namespace index = instrad::index;
 
-	if constexpr (true)
-		memcpy(bytes, test_bytes, sizeof(test_bytes));
+	auto start = std::chrono::steady_clock::now();
 
-	uint64_t ip = 0;
-	auto buf = instrad::Buffer(bytes, length);
+	bool rebuilt = false;
+	auto idx = instrad::ImageIndex();
+	if(!instrad::openIndex(opts.index, img, idx, &rebuilt))
+	{
+		zpr::println("failed to write index '%s'", opts.index);
+		return false;
+	}
 
-	while((ssize_t) buf.remaining() > 0)
+	auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	size_t total = 0;
+	for(size_t i = 0; i < idx.sectionCount(); i++)
 	{
-		auto pos = buf.position();
-		auto instr = instrad::x86::read(buf, instrad::x86::ExecMode::Long);
-		auto len = (pos - buf.position());
+		auto& sec = idx.section(i);
+		if(sec.instructionCount == 0)
+			continue;
+
+		zpr::println("%s:", idx.string(sec.name));
 
-		zpr::print("%4x:  %s\n", ip, print_intel(instr, ip, bytes, len));
+		auto recs = idx.records(sec);
+		for(size_t k = 0; k < sec.instructionCount; k++)
+		{
+			auto& rec = recs[k];
+			auto ip = sec.address + rec.offset;
 
-		ip += len;
+			if(rec.flags & index::FLAG_BRANCH)      zpr::println("%8x:  %s %#x", ip, idx.mnemonic(rec), rec.ref);
+			else if(rec.flags & index::FLAG_MEMORY) zpr::println("%8x:  %s [%#x]", ip, idx.mnemonic(rec), rec.ref);
+			else                                    zpr::println("%8x:  %s", ip, idx.mnemonic(rec));
+		}
+
+		total += sec.instructionCount;
+		zpr::println("");
 	}
 
-	delete[] bytes;
+	zpr::println("%s index '%s': %d instructions, %d symbols (%.1f ms)", rebuilt ? "built" : "mapped", opts.index,
+		total, idx.symbolCount(), ms);
+
+	return true;
 }
 
+int main(int argc, char** argv)
+{
+	auto opts = Options();
+	if(!parseOptions(opts, argc, argv))
+		return 1;
+
+	if(!opts.search.empty())
+		return searchFiles(opts) ? 0 : 1;
+
+	if(opts.features)
+		return checkFeatures(opts) ? 0 : 1;
+
+	if(opts.dupes)
+		return findDuplicates(opts) ? 0 : 1;
+
+	if(opts.diff)
+		return diffFiles(opts) ? 0 : 1;
+
+	auto bytes = std::vector<uint8_t>();
+	if(!readFile(opts.filename, bytes))
+		return 1;
+
+	auto img = instrad::loadImage(std::move(bytes), opts.raw, opts.base, opts.bits == 0 ? 64 : opts.bits);
+	if(opts.bits != 0)
+		img.bits = opts.bits;
 
+	if(!opts.index.empty())
+		return printFromIndex(opts, img) ? 0 : 1;
 
+	if(opts.stats)
+	{
+		printStats(opts, img);
+		return 0;
+	}
+
+	for(auto& sec : img.sections)
+	{
+		if(!sec.executable)
+			continue;
+
+		auto region = instrad::x86::CodeRegion(img.data(sec), sec.size, sec.address, modeForBits(img.bits));
+
+		zpr::println("%s:", sec.name);
+		if(opts.cfg)            printGraphs(opts, img, region);
+		else if(opts.functions) printFunctions(opts, img, region);
+		else if(opts.stack)     printStackDeltas(opts, img, region);
+		else if(opts.gadgets)   printGadgets(opts, region);
+		else if(!opts.uarch.empty())
+			printEstimates(opts, img, region);
+		else if(opts.xrefs || !opts.xrefTargets.empty())
+			printXrefs(opts, img, region);
+		else if(opts.descent)   descend(opts, img, region);
+		else if(opts.decodeCache)
+			benchDecodeCache(region);
+		else if(!opts.seeks.empty())
+			seekInstructions(opts, img, region);
+		else if(!opts.patches.empty())
+			patchedSweep(opts, img, sec, region);
+		else if(opts.filler)    fillerSweep(opts, region);
+		else                    linearSweep(opts, region);
+
+		zpr::println("");
+	}
+}
 
 
 
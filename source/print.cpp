@@ -0,0 +1,275 @@
+// print.cpp
+// Copyright (c) 2020, zhiayang
+// Licensed under the Apache License Version 2.0.
+
+#include "driver.h"
+
+// like objdump, show where rip-relative operands actually point.
+static std::string print_resolved(const instrad::x86::Instruction& instr, uint64_t ip)
+{
+	auto op = instrad::x86::memoryOperand(instr);
+	if(op == nullptr || op->mem().base() != instrad::x86::regs::RIP || !instrad::x86::hasStaticAddress(op->mem()))
+		return "";
+
+	return zpr::sprint("    # %#lx", instrad::x86::effectiveAddress(instr, ip, op->mem()));
+}
+
+std::string print_intel(const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes, size_t len)
+{
+	auto print_operand = [&ip, &instr](const instrad::x86::Operand& op) -> std::string {
+		if(op.isRegister())
+		{
+			return zpr::sprint("%s", op.reg().name());
+		}
+		else if(op.isImmediate())
+		{
+			int64_t value = op.imm();
+			if(op.immediateSize() == 8)  value = (uint8_t) value;
+			if(op.immediateSize() == 16) value = (uint16_t) value;
+			if(op.immediateSize() == 32) value = (uint32_t) value;
+
+			// printf("[%#lx]", op.imm());
+			return zpr::sprint("%#lx", value);
+		}
+		else if(op.isRelativeOffset())
+		{
+			return zpr::sprint("%#lx", instrad::x86::branchTarget(instr, ip));
+		}
+		else if(op.isMemory())
+		{
+			auto& mem = op.mem();
+			auto& base = mem.base();
+			auto& idx = mem.index();
+
+			std::string size = "";
+			switch(mem.bits())
+			{
+				case 8:     size = "BYTE PTR ";     break;
+				case 16:    size = "WORD PTR ";     break;
+				case 32:    size = "DWORD PTR ";    break;
+				case 64:    size = "QWORD PTR ";    break;
+				case 80:    size = "TWORD PTR ";    break;
+				case 128:   size = "XMMWORD PTR ";  break;
+				case 256:   size = "YMMWORD PTR ";  break;
+				case 512:   size = "ZMMWORD PTR ";  break;
+				default:    break;
+			}
+
+
+			std::string segment = "";
+			if(mem.segment().present())
+				segment = zpr::sprint("%s:", mem.segment().name());
+
+			// you can't scale a displacement, so we're fine here.
+			if(!base.present() && !idx.present())
+				return size + segment + zpr::sprint("[%#x]", mem.displacement());
+
+			std::string tmp = size + segment + "[";
+			if(base.present())
+			{
+				tmp += zpr::sprint("%s", base.name());
+				if(idx.present() || op.mem().displacement() != 0 || op.mem().scale() != 1)
+					tmp += " + ";
+			}
+
+			if(idx.present())
+				tmp += zpr::sprint("%s", idx.name());
+
+			if(op.mem().scale() != 1)
+				tmp += zpr::sprint("*%d", op.mem().scale());
+
+			if(op.mem().displacement() != 0)
+			{
+				if(idx.present() || op.mem().scale() != 1)
+					tmp += " + ";
+
+				tmp += zpr::sprint("%#x", op.mem().displacement());
+			}
+
+			return tmp + "]";
+		}
+
+		return "<??>";
+	};
+
+	std::string margin = "    ";
+
+	// print the bytes
+	size_t col = 0;
+	for(size_t i = 0; i < len; i++)
+	{
+		margin += zpr::sprint("%02x ", bytes[i]);
+		col += 3;
+	}
+
+	while(col++ < 30)
+		margin += zpr::sprint(" ");
+
+	std::string prefix = "";
+	if(instr.lockPrefix())  prefix = "lock ";
+	if(instr.repPrefix())   prefix = "rep ";
+	if(instr.repnzPrefix()) prefix = "repnz ";
+
+	auto ret = zpr::sprint("%s%s%s ", margin, prefix, std::string(instr.op().mnemonic()));
+	if(instr.operandCount() == 0)
+	{
+		// nothing
+	}
+	else if(instr.operandCount() == 1)
+	{
+		ret += print_operand(instr.dst());
+	}
+	else if(instr.operandCount() == 2)
+	{
+		ret += print_operand(instr.dst()); ret += ", ";
+		ret += print_operand(instr.src());
+	}
+	else if(instr.operandCount() == 3)
+	{
+		ret += print_operand(instr.dst()); ret += ", ";
+		ret += print_operand(instr.src()); ret += ", ";
+		ret += print_operand(instr.ext());
+	}
+	else
+	{
+		ret += print_operand(instr.dst()); ret += ", ";
+		ret += print_operand(instr.src()); ret += ", ";
+		ret += print_operand(instr.ext()); ret += ", ";
+		ret += print_operand(instr.op4());
+	}
+
+	return ret + print_resolved(instr, ip);
+}
+
+
+
+std::string print_att(const instrad::x86::Instruction& instr, uint64_t ip, const uint8_t* bytes, size_t len)
+{
+	std::string instr_suffix = "";
+
+	auto print_operand = [&ip, &instr, &instr_suffix](const instrad::x86::Operand& op) -> std::string {
+		if(op.isRegister())
+		{
+			return zpr::sprint("%%%s", op.reg().name());
+		}
+		else if(op.isImmediate())
+		{
+			int64_t value = op.imm();
+			if(op.immediateSize() == 8)  value = (uint8_t) value;   instr_suffix = "b";
+			if(op.immediateSize() == 16) value = (uint16_t) value;  instr_suffix = "w";
+			if(op.immediateSize() == 32) value = (uint32_t) value;  instr_suffix = "l";
+			if(op.immediateSize() == 64) value = (uint64_t) value;  instr_suffix = "absq";
+
+			// printf("[%#lx]", op.imm());
+			return zpr::sprint("$%#lx", value);
+		}
+		else if(op.isRelativeOffset())
+		{
+			return zpr::sprint("%#lx", instrad::x86::branchTarget(instr, ip));
+		}
+		else if(op.isMemory())
+		{
+			auto& mem = op.mem();
+			auto& base = mem.base();
+			auto& idx = mem.index();
+
+			switch(mem.bits())
+			{
+				case 8:     instr_suffix = "b"; break;
+				case 16:    instr_suffix = "w"; break;
+				case 32:    instr_suffix = "l"; break;
+				case 64:    instr_suffix = "q"; break;
+
+				// there should be no ambiguity in these cases,
+				// so in theory we should not need a suffix.
+				// (either way, idk what the suffixes would be,
+				// and there don't seem to be any defined)
+				default:
+					break;
+			}
+
+			if(mem.isDisplacement64Bits())
+				instr_suffix = "abs" + instr_suffix;
+
+			std::string segment = mem.segment().present()
+				? zpr::sprint("%%%s:", mem.segment().name())
+				: "";
+
+			// you can't scale a displacement, so we're fine here.
+			if(!base.present() && !idx.present())
+				return segment + zpr::sprint("%#x", mem.displacement());
+
+			std::string tmp = segment;
+			if(op.mem().displacement() != 0)
+				tmp += zpr::sprint("%#lx", op.mem().displacement());
+
+			tmp += "(";
+
+			if(base.present())
+				tmp += zpr::sprint("%%%s", base.name());
+
+			if(idx.present())
+				tmp += zpr::sprint(", %%%s", idx.name());
+
+			if(op.mem().scale() != 1)
+				tmp += zpr::sprint(", %d", op.mem().scale());
+
+			tmp += ")";
+			return tmp;
+		}
+
+		return "??";
+	};
+
+	std::string margin = "    ";
+
+	// print the bytes
+	size_t col = 0;
+	for(size_t i = 0; i < len; i++)
+	{
+		margin += zpr::sprint("%02x ", bytes[i]);
+		col += 3;
+	}
+
+	while(col++ < 30)
+		margin += zpr::sprint(" ");
+
+	std::string prefix = "";
+	if(instr.lockPrefix())  prefix = "lock ";
+	if(instr.repPrefix())   prefix = "rep ";
+	if(instr.repnzPrefix()) prefix = "repnz ";
+
+
+	// only print the instruction last, because we need to parse the operand to know the suffix.
+
+	std::string operands;
+	if(instr.operandCount() == 0)
+	{
+		// nothing
+	}
+	else if(instr.operandCount() == 1)
+	{
+		operands += print_operand(instr.dst());
+	}
+	else if(instr.operandCount() == 2)
+	{
+		operands += print_operand(instr.src()); operands += ", ";
+		operands += print_operand(instr.dst());
+	}
+	else if(instr.operandCount() == 3)
+	{
+		operands += print_operand(instr.ext()); operands += ", ";
+		operands += print_operand(instr.src()); operands += ", ";
+		operands += print_operand(instr.dst());
+	}
+	else
+	{
+		operands += print_operand(instr.op4()); operands += ", ";
+		operands += print_operand(instr.ext()); operands += ", ";
+		operands += print_operand(instr.src()); operands += ", ";
+		operands += print_operand(instr.dst());
+	}
+
+	return zpr::sprint("%s%s%s%s %s%s", margin, prefix, std::string(instr.op().mnemonic()), instr_suffix, operands,
+		print_resolved(instr, ip));
+}